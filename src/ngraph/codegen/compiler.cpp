@@ -14,7 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 
 #include <clang/Basic/DiagnosticOptions.h>
 #include <clang/Basic/TargetInfo.h>
@@ -33,14 +38,20 @@
 #include <clang/Lex/Preprocessor.h>
 #include <clang/Lex/PreprocessorOptions.h>
 #include <llvm/ADT/Statistic.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
 #include <llvm/ExecutionEngine/MCJIT.h> // forces JIT to link in
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Metadata.h>
 #include <llvm/IR/Module.h>
 #include <llvm/LinkAllPasses.h>
 #include <llvm/Option/Arg.h>
 #include <llvm/Option/ArgList.h>
 #include <llvm/Option/OptTable.h>
 #include <llvm/Support/ErrorHandling.h>
+#include <llvm/Support/Host.h>
 #include <llvm/Support/ManagedStatic.h>
+#include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/Signals.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/Timer.h>
@@ -80,6 +91,7 @@ public:
 };
 
 static unordered_map<string, CompilerInfo> s_compiler_info;
+static atomic<size_t> s_compile_count{0};
 
 static class StaticHandler
 {
@@ -129,8 +141,120 @@ void codegen::Compiler::add_header_search_path(const std::string& path)
     m_header_search_paths.push_back(path);
 }
 
+void codegen::Compiler::set_cache_directory(const std::string& path)
+{
+    m_cache_directory = path;
+}
+
+std::string codegen::Compiler::get_cache_key(const std::string& source) const
+{
+    // The object code is tuned for the host CPU, so it is part of the key
+    std::hash<std::string> hasher;
+    size_t key = ngraph::hash_combine({hasher(source),
+                                       hasher(m_precompiled_header_source),
+                                       hasher(llvm::sys::getHostCPUName().str())});
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << key;
+    return ss.str();
+}
+
+// Tags a module with a hash of its source, which is stored with its cached object code.
+// FNV-1a is independent of the std::hash in the cache key, so sources whose keys collide
+// don't also share object code.
+static void set_source_hash(llvm::Module& module, const std::string& source)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : source)
+    {
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+    NamedMDNode* metadata = module.getOrInsertNamedMetadata(codegen::SOURCE_HASH_METADATA);
+    metadata->clearOperands();
+    metadata->addOperand(
+        MDNode::get(module.getContext(), MDString::get(module.getContext(), ss.str())));
+}
+
+std::unique_ptr<codegen::Module> codegen::Compiler::load_cached_module(const std::string& key,
+                                                                       const std::string& source)
+{
+    string source_file = file_util::path_join(m_cache_directory, key + ".cpp");
+    string bitcode_file = file_util::path_join(m_cache_directory, key + ".bc");
+    if (!file_util::exists(source_file) || !file_util::exists(bitcode_file))
+    {
+        return nullptr;
+    }
+    // Guard against hash collisions by comparing the full source
+    if (file_util::read_file_to_string(source_file) != source)
+    {
+        return nullptr;
+    }
+
+    auto buffer = MemoryBuffer::getFile(bitcode_file);
+    if (!buffer)
+    {
+        return nullptr;
+    }
+    if (!m_cache_context)
+    {
+        m_cache_context.reset(new LLVMContext());
+    }
+    auto module = parseBitcodeFile((*buffer)->getMemBufferRef(), *m_cache_context);
+    if (!module)
+    {
+        NGRAPH_WARN << "Ignoring unreadable cached module " << bitcode_file << ": "
+                    << toString(module.takeError());
+        return nullptr;
+    }
+    (*module)->setModuleIdentifier(key);
+    set_source_hash(**module, source);
+    return unique_ptr<codegen::Module>(new codegen::Module(move(*module)));
+}
+
+void codegen::Compiler::store_cached_module(const std::string& key,
+                                            const std::string& source,
+                                            const llvm::Module& module)
+{
+    file_util::make_directory(m_cache_directory);
+    // Write to temporary files and rename them so that concurrent processes never
+    // see a partially written entry
+    auto store = [&](const string& extension, const function<void(ostream&)>& writer) {
+        string file = file_util::path_join(m_cache_directory, key + extension);
+        string tmp_file = file_util::tmp_filename_beside(file);
+        {
+            ofstream out(tmp_file, ios::binary);
+            writer(out);
+        }
+        if (rename(tmp_file.c_str(), file.c_str()) != 0)
+        {
+            file_util::remove_file(tmp_file);
+        }
+    };
+    store(".bc", [&](ostream& out) {
+        string bitcode;
+        raw_string_ostream bitcode_stream(bitcode);
+        WriteBitcodeToFile(&module, bitcode_stream);
+        bitcode_stream.flush();
+        out << bitcode;
+    });
+    // The source is written last; it marks the entry as complete
+    store(".cpp", [&](ostream& out) { out << source; });
+}
+
 std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& source)
 {
+    string key;
+    if (!m_cache_directory.empty())
+    {
+        key = get_cache_key(source);
+        if (auto cached_module = load_cached_module(key, source))
+        {
+            NGRAPH_DEBUG << "Loaded module " << key << " from " << m_cache_directory;
+            return cached_module;
+        }
+    }
+
     // lock_guard<mutex> lock(m_mutex);
     CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
     if (!compiler_info.compiler)
@@ -143,9 +267,24 @@ std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& s
         compiler_info.compiler->set_precompiled_header_source(m_precompiled_header_source);
     }
     auto rc = compiler_info.compiler->compile(m_compiler_action, source);
+    s_compile_count++;
+    if (rc && !key.empty())
+    {
+        // The execution engine names cached object code after the module
+        auto module = rc->take_module();
+        module->setModuleIdentifier(key);
+        set_source_hash(*module, source);
+        store_cached_module(key, source, *module);
+        rc.reset(new codegen::Module(move(module)));
+    }
     return rc;
 }
 
+size_t codegen::Compiler::get_compile_count()
+{
+    return s_compile_count;
+}
+
 static std::string GetExecutablePath(const char* Argv0)
 {
     // This just needs to be some symbol in the binary; C++ doesn't
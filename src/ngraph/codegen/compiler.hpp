@@ -27,6 +27,9 @@ namespace ngraph
         class Module;
         class Compiler;
         class CompilerCore;
+
+        /// Named metadata holding a hash of the source a module was compiled from
+        constexpr const char* SOURCE_HASH_METADATA = "ngraph.source_hash";
     }
 }
 
@@ -38,6 +41,7 @@ namespace clang
 
 namespace llvm
 {
+    class LLVMContext;
     class Module;
 }
 
@@ -59,13 +63,29 @@ public:
     ~Compiler();
     void set_precompiled_header_source(const std::string& source);
     void add_header_search_path(const std::string& path);
+    /// \brief Keep the bitcode of compiled modules in path, keyed by a hash of the source,
+    ///        and reuse it instead of invoking clang when the same source is compiled again
+    void set_cache_directory(const std::string& path);
     std::unique_ptr<ngraph::codegen::Module> compile(const std::string& source);
     std::unique_ptr<clang::CodeGenAction>& get_compiler_action() { return m_compiler_action; }
+    /// \returns The number of sources this process has compiled with clang
+    static size_t get_compile_count();
+
 private:
+    std::string get_cache_key(const std::string& source) const;
+    std::unique_ptr<ngraph::codegen::Module> load_cached_module(const std::string& key,
+                                                                const std::string& source);
+    void store_cached_module(const std::string& key,
+                             const std::string& source,
+                             const llvm::Module& module);
+
     std::unique_ptr<clang::CodeGenAction> m_compiler_action;
     std::shared_ptr<CompilerCore> m_compiler_core;
     std::string m_precompiled_header_source;
     std::vector<std::string> m_header_search_paths;
+    std::string m_cache_directory;
+    // Owns the modules loaded from the cache
+    std::unique_ptr<llvm::LLVMContext> m_cache_context;
 };
 
 class ngraph::codegen::CompilerCore
@@ -14,12 +14,96 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdio>
+#include <fstream>
+
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/IR/Metadata.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/MemoryBuffer.h>
 
 #include "ngraph/codegen/execution_engine.hpp"
+#include "ngraph/file_util.hpp"
 
 using namespace ngraph;
 
+namespace
+{
+    // Object code is stored after a line holding the hash of the module's source, and is
+    // only loaded for a module compiled from a source with the same hash
+    class FileObjectCache : public llvm::ObjectCache
+    {
+    public:
+        FileObjectCache(const std::string& directory)
+            : m_directory(directory)
+        {
+        }
+
+        void notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef obj) override
+        {
+            std::string source_hash = get_source_hash(module);
+            if (source_hash.empty())
+            {
+                return;
+            }
+            std::string file = get_object_file(module);
+            std::string tmp_file = file_util::tmp_filename_beside(file);
+            {
+                std::ofstream out(tmp_file, std::ios::binary);
+                out << source_hash << "\n";
+                out.write(obj.getBufferStart(), obj.getBufferSize());
+            }
+            if (std::rename(tmp_file.c_str(), file.c_str()) != 0)
+            {
+                file_util::remove_file(tmp_file);
+            }
+        }
+
+        std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override
+        {
+            std::string source_hash = get_source_hash(module);
+            if (source_hash.empty())
+            {
+                return nullptr;
+            }
+            auto buffer = llvm::MemoryBuffer::getFile(get_object_file(module));
+            if (!buffer)
+            {
+                return nullptr;
+            }
+            llvm::StringRef contents = (*buffer)->getBuffer();
+            if (!contents.startswith(source_hash + "\n"))
+            {
+                return nullptr;
+            }
+            return llvm::MemoryBuffer::getMemBufferCopy(
+                contents.drop_front(source_hash.size() + 1), (*buffer)->getBufferIdentifier());
+        }
+
+    private:
+        std::string get_object_file(const llvm::Module* module)
+        {
+            return file_util::path_join(m_directory, module->getModuleIdentifier() + ".o");
+        }
+
+        // Modules the compiler did not tag are not cached
+        std::string get_source_hash(const llvm::Module* module)
+        {
+            auto metadata = module->getNamedMetadata(codegen::SOURCE_HASH_METADATA);
+            if (metadata == nullptr || metadata->getNumOperands() != 1 ||
+                metadata->getOperand(0)->getNumOperands() != 1)
+            {
+                return "";
+            }
+            auto hash = llvm::dyn_cast<llvm::MDString>(metadata->getOperand(0)->getOperand(0));
+            return hash ? hash->getString().str() : "";
+        }
+
+        std::string m_directory;
+    };
+}
+
 codegen::ExecutionEngine::ExecutionEngine()
     : m_execution_engine{nullptr}
 {
@@ -33,6 +117,11 @@ codegen::ExecutionEngine::~ExecutionEngine()
     }
 }
 
+void codegen::ExecutionEngine::set_cache_directory(const std::string& path)
+{
+    m_object_cache.reset(new FileObjectCache(path));
+}
+
 bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Module>& module)
 {
     if (module)
@@ -51,6 +140,10 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
             {
                 return false;
             }
+            if (m_object_cache)
+            {
+                m_execution_engine->setObjectCache(m_object_cache.get());
+            }
         }
     }
     else
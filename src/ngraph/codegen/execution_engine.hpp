@@ -18,6 +18,7 @@
 
 #include <functional>
 #include <memory>
+#include <string>
 
 #include "ngraph/codegen/compiler.hpp"
 
@@ -33,6 +34,7 @@ namespace llvm
 {
     class Module;
     class ExecutionEngine;
+    class ObjectCache;
 }
 
 class ngraph::codegen::ExecutionEngine
@@ -41,6 +43,10 @@ public:
     ExecutionEngine();
     ~ExecutionEngine();
 
+    /// \brief Keep the object code of added modules in path, named after the module
+    ///        identifier, and load it instead of generating code when it was stored for a
+    ///        module compiled from the same source
+    void set_cache_directory(const std::string& path);
     bool add_module(std::unique_ptr<ngraph::codegen::Module>& module);
     void finalize();
 
@@ -51,6 +57,7 @@ public:
     }
 
 private:
+    std::unique_ptr<llvm::ObjectCache> m_object_cache;
     std::unique_ptr<llvm::ExecutionEngine> m_execution_engine;
     std::string m_jit_error;
 
@@ -36,6 +36,7 @@ void Input::replace_output(Output& new_output)
     m_output->remove_input(this);
     new_output.add_input(this);
     m_output = &new_output;
+    m_node->m_inputs_version = Node::graph_changed(m_node, m_src_node.get());
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
 
     static const auto nerc = std::getenv("NGRAPH_ENABLE_REPLACE_CHECK");
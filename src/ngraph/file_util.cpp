@@ -355,6 +355,23 @@ string file_util::tmp_filename(const string& extension)
     return rc;
 }
 
+string file_util::tmp_filename_beside(const string& path)
+{
+    string rc;
+#ifdef WIN32
+    rc = _tempnam(file_util::get_directory(path).c_str(), "ngraph_");
+#else
+    char* tmpname = strdup((path + ".XXXXXX").c_str());
+
+    // mkstemp opens the file with open() so we need to close it
+    close(mkstemp(tmpname));
+
+    rc = tmpname;
+    free(tmpname);
+#endif
+    return rc;
+}
+
 bool file_util::exists(const string& filename)
 {
     struct stat buffer;
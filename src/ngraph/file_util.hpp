@@ -91,6 +91,12 @@ namespace ngraph
         /// \return Name of the temporary file
         std::string tmp_filename(const std::string& extension = "");
 
+        /// \brief Create a uniquely named empty file in the directory of another file, to be
+        ///        written and then renamed over it
+        /// \param path The file the temporary file will replace
+        /// \return Name of the temporary file
+        std::string tmp_filename_beside(const std::string& path);
+
         /// \brief Test for the existence of a path or file
         /// \param path The path to test
         /// \return true if the path exists, false otherwise
@@ -17,6 +17,9 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <queue>
+#include <unordered_set>
+#include <vector>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -81,6 +84,44 @@ void Function::validate_nodes_and_infer_types()
     ngraph::validate_nodes_and_infer_types(get_ops());
 }
 
+void Function::validate_nodes_and_infer_types(size_t since_version)
+{
+    // Nodes whose output types changed on revalidation; their users must be revalidated too
+    unordered_set<Node*> retyped;
+    for (auto node : get_ordered_ops())
+    {
+        bool stale = node->get_inputs_version() > since_version;
+        for (size_t i = 0; !stale && !retyped.empty() && i < node->get_input_size(); i++)
+        {
+            stale = retyped.count(node->get_inputs().at(i).get_output().get_node().get()) != 0;
+        }
+        if (!stale)
+        {
+            continue;
+        }
+
+        vector<pair<element::Type, PartialShape>> output_types;
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            output_types.emplace_back(node->get_output_element_type(i),
+                                      node->get_output_partial_shape(i));
+        }
+        // Not delayed_validate_and_infer_types, which does nothing while ops still infer their
+        // types in their constructors
+        node->revalidate_and_infer_types();
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            if (i >= output_types.size() ||
+                output_types[i].first != node->get_output_element_type(i) ||
+                !output_types[i].second.same_scheme(node->get_output_partial_shape(i)))
+            {
+                retyped.insert(node.get());
+                break;
+            }
+        }
+    }
+}
+
 void Function::init()
 {
     validate_nodes_and_infer_types();
@@ -99,9 +140,266 @@ void Function::init()
                    true /*include control dependencies*/);
 }
 
+namespace
+{
+    // Spacing of the keys of freshly indexed ordered ops
+    const size_t ordered_op_key_gap = 1 << 16;
+
+    template <typename F>
+    void for_each_arg(Node* node, F f)
+    {
+        for (const auto& control_dep : node->get_control_dependencies())
+        {
+            f(control_dep);
+        }
+        auto& inputs = node->get_inputs();
+        for (auto input = inputs.rbegin(); input != inputs.rend(); ++input)
+        {
+            f(input->get_output().get_node());
+        }
+    }
+}
+
 std::list<shared_ptr<Node>> Function::get_ordered_ops(bool include_control_deps) const
 {
-    return topological_sort(get_ops(include_control_deps), include_control_deps);
+    if (!include_control_deps)
+    {
+        return topological_sort(get_ops(false), false);
+    }
+
+    lock_guard<mutex> lock(m_ops_mutex);
+    size_t version = Node::get_graph_version();
+    if (m_ordered_ops.empty())
+    {
+        sort_ordered_ops();
+    }
+    else if (m_ordered_ops_version != version)
+    {
+        vector<Node::GraphEdit> edits;
+        if (Node::get_graph_edits(m_ordered_ops_version, edits) && patch_ordered_ops(edits))
+        {
+            version = edits.empty() ? m_ordered_ops_version : edits.back().version;
+        }
+        else
+        {
+            sort_ordered_ops();
+        }
+    }
+    m_ordered_ops_version = version;
+    return m_ordered_ops;
+}
+
+void Function::sort_ordered_ops() const
+{
+    list<shared_ptr<Node>> ops;
+    traverse_nodes(this, [&](shared_ptr<Node> node) { ops.push_back(node); }, true);
+    if (m_ordered_ops.empty())
+    {
+        m_ordered_ops = topological_sort(ops, true);
+    }
+    else
+    {
+        // Emit the ops still in the function in their previous order, each after those of its
+        // arguments not emitted yet
+        unordered_set<Node*> remaining;
+        for (const auto& node : ops)
+        {
+            remaining.insert(node.get());
+        }
+        list<shared_ptr<Node>> ordered_ops;
+        vector<pair<shared_ptr<Node>, bool>> stack;
+        for (const auto& node : m_ordered_ops)
+        {
+            if (remaining.count(node.get()) != 0)
+            {
+                stack.push_back({node, false});
+            }
+            while (!stack.empty())
+            {
+                auto top = stack.back();
+                stack.pop_back();
+                if (top.second)
+                {
+                    ordered_ops.push_back(top.first);
+                    continue;
+                }
+                if (remaining.erase(top.first.get()) == 0)
+                {
+                    continue;
+                }
+                stack.push_back({top.first, true});
+                for_each_arg(top.first.get(),
+                             [&](const shared_ptr<Node>& arg) { stack.push_back({arg, false}); });
+            }
+        }
+        m_ordered_ops.swap(ordered_ops);
+    }
+    index_ordered_ops();
+}
+
+void Function::index_ordered_ops() const
+{
+    m_ordered_op_positions.clear();
+    m_ordered_ops_have_control_deps = false;
+    size_t key = 0;
+    for (auto it = m_ordered_ops.begin(); it != m_ordered_ops.end(); ++it)
+    {
+        key += ordered_op_key_gap;
+        m_ordered_op_positions[it->get()] = {it, key};
+        m_ordered_ops_have_control_deps |= !(*it)->get_control_dependencies().empty();
+    }
+}
+
+bool Function::patch_ordered_ops(const vector<Node::GraphEdit>& edits) const
+{
+    // The address of an op in the cache cannot have been reused while the cache holds it, but
+    // an edit may be of an older node freed before the op was created at the same address
+    auto contains = [this](Node* node, size_t instance_id) {
+        auto position = m_ordered_op_positions.find(node);
+        return position != m_ordered_op_positions.end() &&
+               node->get_instance_id() == instance_id;
+    };
+
+    // Ops that lost a user, dropped after the edits if no other user is left
+    vector<Node*> unlinked;
+    for (const auto& edit : edits)
+    {
+        if (!contains(edit.node, edit.node_id))
+        {
+            continue;
+        }
+        if (edit.old_arg != nullptr && contains(edit.old_arg, edit.old_arg_id))
+        {
+            unlinked.push_back(edit.old_arg);
+        }
+        if (!insert_missing_args(edit.node))
+        {
+            return false;
+        }
+    }
+    return remove_unused_ops(unlinked);
+}
+
+bool Function::insert_missing_args(Node* node) const
+{
+    auto position = &m_ordered_op_positions.at(node);
+
+    // Arguments of node not in the cache yet, and theirs, in topological order
+    list<shared_ptr<Node>> missing;
+    unordered_set<Node*> visited;
+    vector<pair<shared_ptr<Node>, bool>> stack;
+    auto push_arg = [&](const shared_ptr<Node>& arg) { stack.push_back({arg, false}); };
+    for_each_arg(node, push_arg);
+    while (!stack.empty())
+    {
+        auto top = stack.back();
+        stack.pop_back();
+        if (top.second)
+        {
+            missing.push_back(top.first);
+            continue;
+        }
+        auto arg_position = m_ordered_op_positions.find(top.first.get());
+        if (arg_position != m_ordered_op_positions.end())
+        {
+            if (arg_position->second.key > position->key)
+            {
+                // Linked to an op placed later; let the caller sort again
+                return false;
+            }
+            continue;
+        }
+        if (visited.insert(top.first.get()).second)
+        {
+            stack.push_back({top.first, true});
+            for_each_arg(top.first.get(), push_arg);
+        }
+    }
+    if (missing.empty())
+    {
+        return true;
+    }
+
+    // Place the new ops between node and the op before it. The arguments already in the cache
+    // are before node, so they are at or before that op.
+    auto previous_key = [&]() {
+        return position->it == m_ordered_ops.begin()
+                   ? 0
+                   : m_ordered_op_positions.at(prev(position->it)->get()).key;
+    };
+    if (position->key - previous_key() <= missing.size())
+    {
+        index_ordered_ops();
+        position = &m_ordered_op_positions.at(node);
+    }
+    size_t step = (position->key - previous_key()) / (missing.size() + 1);
+    size_t key = previous_key();
+    auto it = position->it;
+    for (const auto& op : missing)
+    {
+        key += step;
+        m_ordered_op_positions[op.get()] = {m_ordered_ops.insert(it, op), key};
+        m_ordered_ops_have_control_deps |= !op->get_control_dependencies().empty();
+    }
+    return true;
+}
+
+bool Function::remove_unused_ops(const vector<Node*>& unlinked) const
+{
+    // Drop unused ops from the last one, so the users of an op are looked at before it
+    priority_queue<pair<size_t, Node*>> candidates;
+    for (auto op : unlinked)
+    {
+        candidates.push({m_ordered_op_positions.at(op).key, op});
+    }
+    while (!candidates.empty())
+    {
+        auto op = candidates.top().second;
+        candidates.pop();
+        auto position = m_ordered_op_positions.find(op);
+        if (position == m_ordered_op_positions.end() || op->is_output() || op->is_parameter())
+        {
+            continue;
+        }
+        bool used = false;
+        for (const auto& output : op->get_outputs())
+        {
+            for (auto input : output.get_inputs())
+            {
+                used |= m_ordered_op_positions.count(input->get_node().get()) != 0;
+            }
+        }
+        if (used)
+        {
+            continue;
+        }
+        if (m_ordered_ops_have_control_deps)
+        {
+            // Users through control dependencies are not tracked; let the caller sort again
+            return false;
+        }
+
+        // Keep op alive until its arguments are queued
+        auto node = *position->second.it;
+        m_ordered_ops.erase(position->second.it);
+        m_ordered_op_positions.erase(position);
+        for_each_arg(node.get(), [&](const shared_ptr<Node>& arg) {
+            auto arg_position = m_ordered_op_positions.find(arg.get());
+            if (arg_position != m_ordered_op_positions.end())
+            {
+                candidates.push({arg_position->second.key, arg.get()});
+            }
+        });
+    }
+    return true;
+}
+
+void Function::set_ordered_ops(const list<shared_ptr<Node>>& ordered_ops)
+{
+    lock_guard<mutex> lock(m_ops_mutex);
+    m_ordered_ops = ordered_ops;
+    index_ordered_ops();
+    m_ordered_ops_version = Node::get_graph_version();
 }
 
 const std::string& Function::get_friendly_name() const
@@ -182,6 +480,11 @@ shared_ptr<Node> Function::get_result() const
 
 std::list<shared_ptr<Node>> Function::get_ops(bool include_control_deps) const
 {
+    if (include_control_deps)
+    {
+        return get_ordered_ops();
+    }
+
     std::list<std::shared_ptr<Node>> ops;
     traverse_nodes(this, [&](shared_ptr<Node> node) { ops.push_back(node); }, include_control_deps);
     return ops;
@@ -20,7 +20,9 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ngraph/node.hpp"
@@ -76,8 +78,17 @@ namespace ngraph
         // so we can use `dynamic_cast` in FunctionCall to double check if we are dealing with
         //  an XLA or regular function
         void set_name(const std::string& name);
+        /// \brief Returns the ops of the function. With control dependencies these are the
+        ///     cached ops of get_ordered_ops.
         std::list<std::shared_ptr<Node>> get_ops(bool include_control_deps = true) const;
+        /// \brief Returns the ops in topological order. The order is cached and patched with
+        ///     the graph edits made since: edits of nodes outside the function are skipped, new
+        ///     ops are placed right before the user they were linked to, and ops left without
+        ///     users are dropped. The ops kept stay in the same order.
         std::list<std::shared_ptr<Node>> get_ordered_ops(bool include_control_deps = true) const;
+        /// \brief Sets the order returned by get_ordered_ops, such as a schedule chosen to
+        ///     reduce memory. It must be a topological order of the function's ops.
+        void set_ordered_ops(const std::list<std::shared_ptr<Node>>& ordered_ops);
         friend std::ostream& operator<<(std::ostream&, const Function&);
         size_t get_instance_id() { return m_instance_id; }
         size_t get_temporary_pool_size();
@@ -86,6 +97,9 @@ namespace ngraph
         void replace_node(std::shared_ptr<Node> old, std::shared_ptr<Node> repl);
 
         void validate_nodes_and_infer_types();
+        /// \brief Revalidates only the nodes whose inputs were replaced after graph version
+        ///     `since_version`, and the nodes downstream of those whose output types changed
+        void validate_nodes_and_infer_types(size_t since_version);
 
     protected:
         ResultVector m_results;
@@ -100,6 +114,26 @@ namespace ngraph
         static std::atomic<size_t> m_next_instance_id;
         size_t m_instance_id;
         std::string m_name;
+        struct OrderedOpPosition
+        {
+            std::list<std::shared_ptr<Node>>::iterator it;
+            // Increasing along m_ordered_ops, with gaps to insert ops without renumbering
+            size_t key;
+        };
+
+        void sort_ordered_ops() const;
+        void index_ordered_ops() const;
+        bool patch_ordered_ops(const std::vector<Node::GraphEdit>& edits) const;
+        bool insert_missing_args(Node* node) const;
+        bool remove_unused_ops(const std::vector<Node*>& unlinked) const;
+
+        // Cache of get_ordered_ops with control dependencies, up to date with the graph edits
+        // up to m_ordered_ops_version
+        mutable std::mutex m_ops_mutex;
+        mutable std::list<std::shared_ptr<Node>> m_ordered_ops;
+        mutable std::unordered_map<Node*, OrderedOpPosition> m_ordered_op_positions;
+        mutable bool m_ordered_ops_have_control_deps = false;
+        mutable size_t m_ordered_ops_version = 0;
         const std::string m_unique_name;
     };
 }
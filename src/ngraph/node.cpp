@@ -14,7 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <typeindex>
 #include <typeinfo>
@@ -25,11 +28,58 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/placement.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::m_graph_version(0);
+
+namespace
+{
+    // Recent graph edits, so cached orders can be patched instead of rebuilt. Orders that fall
+    // further behind than this are rebuilt.
+    const size_t max_graph_edits = 1 << 14;
+    mutex graph_edits_mutex;
+    deque<Node::GraphEdit> graph_edits;
+}
+
+size_t Node::graph_changed(Node* node, Node* old_arg)
+{
+    lock_guard<mutex> lock(graph_edits_mutex);
+    size_t version = ++m_graph_version;
+    if (graph_edits.size() == max_graph_edits)
+    {
+        graph_edits.pop_front();
+    }
+    graph_edits.push_back({version,
+                           node,
+                           node->get_instance_id(),
+                           old_arg,
+                           old_arg == nullptr ? 0 : old_arg->get_instance_id()});
+    return version;
+}
+
+bool Node::get_graph_edits(size_t since_version, vector<GraphEdit>& edits)
+{
+    lock_guard<mutex> lock(graph_edits_mutex);
+    if (since_version == m_graph_version)
+    {
+        return true;
+    }
+    if (graph_edits.empty() || graph_edits.front().version > since_version + 1)
+    {
+        return false;
+    }
+    for (auto it = graph_edits.begin() + (since_version + 1 - graph_edits.front().version);
+         it != graph_edits.end();
+         ++it)
+    {
+        edits.push_back(*it);
+    }
+    return true;
+}
 
 Node::Node(const std::string& node_type, const NodeVector& arguments, size_t output_size)
     : m_node_type(node_type)
@@ -114,6 +164,55 @@ bool Node::is_constant() const
     return false;
 }
 
+// The outputs read by a node's inputs, in a canonical order for commutative ops
+static vector<const descriptor::Output*> get_input_outputs(const Node& node)
+{
+    vector<const descriptor::Output*> outputs;
+    for (auto& input : node.get_inputs())
+    {
+        outputs.push_back(&input.get_output());
+    }
+    if (node.is_commutative())
+    {
+        sort(outputs.begin(), outputs.end());
+    }
+    return outputs;
+}
+
+bool Node::is_structurally_equal(const Node& other) const
+{
+    if (this == &other)
+    {
+        return true;
+    }
+    if (type_index(typeid(*this)) != type_index(typeid(other)) ||
+        get_input_size() != other.get_input_size() ||
+        get_output_size() != other.get_output_size() || m_placement != other.m_placement ||
+        m_control_dependencies != other.m_control_dependencies)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < get_output_size(); i++)
+    {
+        if (get_output_element_type(i) != other.get_output_element_type(i) ||
+            !get_output_partial_shape(i).same_scheme(other.get_output_partial_shape(i)))
+        {
+            return false;
+        }
+    }
+    return get_input_outputs(*this) == get_input_outputs(other) && has_same_attributes(other);
+}
+
+size_t Node::get_structural_hash() const
+{
+    vector<size_t> values{type_index(typeid(*this)).hash_code(), get_attributes_hash()};
+    for (const descriptor::Output* output : get_input_outputs(*this))
+    {
+        values.push_back(hash<const descriptor::Output*>()(output));
+    }
+    return hash_combine(values);
+}
+
 const std::string& Node::get_friendly_name() const
 {
     if (m_name.empty())
@@ -198,6 +297,13 @@ const std::set<std::shared_ptr<Node>>& Node::get_control_dependencies() const
 void Node::add_control_dependency(std::shared_ptr<Node> node)
 {
     m_control_dependencies.insert(node);
+    graph_changed(this, nullptr);
+}
+
+void Node::remove_control_dependency(std::shared_ptr<Node> node)
+{
+    m_control_dependencies.erase(node);
+    graph_changed(this, node.get());
 }
 
 std::vector<std::shared_ptr<Function>> Node::get_functions() const
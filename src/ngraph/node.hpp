@@ -140,7 +140,20 @@ namespace ngraph
         bool is_parameter() const;
         virtual bool is_output() const;
         virtual bool is_constant() const;
-        virtual bool is_commutative() { return false; }
+        virtual bool is_commutative() const { return false; }
+        /// \brief Whether other computes the same values as this node: an op of the same class
+        ///     with the same attributes, reading the same outputs (in either order when the op
+        ///     is commutative) and producing the same element types and shapes
+        bool is_structurally_equal(const Node& other) const;
+        /// \brief A hash that is the same for structurally equal nodes
+        size_t get_structural_hash() const;
+        /// \brief Whether other, an op of the same class, has the same attributes. Ops override
+        ///     this to compare every attribute that affects their result; by default nodes are
+        ///     never structurally equal, since their attributes are unknown.
+        virtual bool has_same_attributes(const Node& other) const { return false; }
+        /// \brief A hash of the attributes compared by has_same_attributes, for ops whose
+        ///     arguments alone do not tell them apart, such as constants
+        virtual size_t get_attributes_hash() const { return 0; }
         size_t get_instance_id() const { return m_instance_id; }
         friend std::ostream& operator<<(std::ostream&, const Node&);
         virtual std::ostream& write_short_description(std::ostream&) const;
@@ -162,10 +175,31 @@ namespace ngraph
 
         void add_control_dependency(std::shared_ptr<Node> node);
 
-        void remove_control_dependency(std::shared_ptr<Node> node)
+        void remove_control_dependency(std::shared_ptr<Node> node);
+
+        /// \brief An input of `node` was replaced or one of its control dependencies was added
+        ///     or removed. `old_arg` is the node it stopped depending on, if any. Nodes are
+        ///     identified by address and instance id since they may have been freed since.
+        struct GraphEdit
         {
-            m_control_dependencies.erase(node);
-        }
+            size_t version;
+            Node* node;
+            size_t node_id;
+            Node* old_arg;
+            size_t old_arg_id;
+        };
+
+        /// \brief Changes whenever an edge of any graph is replaced or a control dependency is
+        ///     added or removed, so that orders computed from a graph can tell if they are stale
+        static size_t get_graph_version() { return m_graph_version; }
+        /// \brief Records an edit of `node`, bumps the graph version and returns the new one
+        static size_t graph_changed(Node* node, Node* old_arg);
+        /// \brief Appends the edits made after graph version `since_version` to `edits`, oldest
+        ///     first. Returns false if older edits were already dropped from the log.
+        static bool get_graph_edits(size_t since_version, std::vector<GraphEdit>& edits);
+        /// \brief The graph version at which one of this node's inputs was last replaced, so a
+        ///     pass manager can revalidate only the nodes a pass touched
+        size_t get_inputs_version() const { return m_inputs_version; }
 
         /// Returns the number of outputs on the for the node.
         size_t get_output_size() const;
@@ -238,6 +272,10 @@ namespace ngraph
         /// Set device placement
         void set_placement(size_t placement);
 
+        /// Offset in the temporary pool of the memory lent to the functions this op calls
+        size_t get_nested_pool_offset() const { return m_nested_pool_offset; }
+        void set_nested_pool_offset(size_t offset) { m_nested_pool_offset = offset; }
+
         /// Get input descriptor that is connected to src
         descriptor::Input* get_input_from(const std::shared_ptr<Node>& src);
 
@@ -259,11 +297,14 @@ namespace ngraph
         std::string m_name;
         const std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        static std::atomic<size_t> m_graph_version;
         std::deque<descriptor::Input> m_inputs;
         std::deque<descriptor::Output> m_outputs;
         std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
         Placement m_placement = Placement::DEFAULT;
         size_t m_placement_size = 0;
+        size_t m_nested_pool_offset = 0;
+        size_t m_inputs_version = 0;
     };
 
     class NodeValidationError : public AssertionFailure
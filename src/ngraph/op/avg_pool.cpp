@@ -96,6 +96,15 @@ shared_ptr<Node> op::AvgPool::copy_with_new_args(const NodeVector& new_args) con
                                 m_include_padding_in_avg_computation);
 }
 
+bool op::AvgPool::has_same_attributes(const Node& other) const
+{
+    auto& pool = static_cast<const AvgPool&>(other);
+    return m_window_shape == pool.m_window_shape &&
+           m_window_movement_strides == pool.m_window_movement_strides &&
+           m_padding_below == pool.m_padding_below && m_padding_above == pool.m_padding_above &&
+           m_include_padding_in_avg_computation == pool.m_include_padding_in_avg_computation;
+}
+
 op::AvgPoolBackprop::AvgPoolBackprop(const Shape& forward_arg_shape,
                                      const shared_ptr<Node>& delta,
                                      const Shape& window_shape,
@@ -155,6 +164,16 @@ shared_ptr<Node> op::AvgPoolBackprop::copy_with_new_args(const NodeVector& new_a
     return shared_ptr<op::AvgPoolBackprop>(avpn);
 }
 
+bool op::AvgPoolBackprop::has_same_attributes(const Node& other) const
+{
+    auto& pool = static_cast<const AvgPoolBackprop&>(other);
+    return m_forward_arg_shape == pool.m_forward_arg_shape &&
+           m_window_shape == pool.m_window_shape &&
+           m_window_movement_strides == pool.m_window_movement_strides &&
+           m_padding_below == pool.m_padding_below && m_padding_above == pool.m_padding_above &&
+           m_include_padding_in_avg_computation == pool.m_include_padding_in_avg_computation;
+}
+
 void op::AvgPool::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     auto delta = deltas.at(0);
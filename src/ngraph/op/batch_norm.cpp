@@ -96,6 +96,12 @@ std::shared_ptr<ngraph::Node>
         m_epsilon, new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), new_args.at(4));
 }
 
+bool ngraph::op::BatchNormInference::has_same_attributes(const Node& other) const
+{
+    auto& bn = static_cast<const BatchNormInference&>(other);
+    return m_epsilon == bn.m_epsilon;
+}
+
 std::shared_ptr<ngraph::Node>
     ngraph::op::BatchNormTraining::copy_with_new_args(const NodeVector& new_args) const
 {
@@ -104,6 +110,12 @@ std::shared_ptr<ngraph::Node>
         m_epsilon, new_args.at(0), new_args.at(1), new_args.at(2));
 }
 
+bool ngraph::op::BatchNormTraining::has_same_attributes(const Node& other) const
+{
+    auto& bn = static_cast<const BatchNormTraining&>(other);
+    return m_epsilon == bn.m_epsilon;
+}
+
 ngraph::op::BatchNormTrainingBackprop::BatchNormTrainingBackprop(
     double eps,
     std::shared_ptr<ngraph::Node> gamma,
@@ -176,6 +188,12 @@ std::shared_ptr<ngraph::Node>
                                                            new_args.at(5));
 }
 
+bool ngraph::op::BatchNormTrainingBackprop::has_same_attributes(const Node& other) const
+{
+    auto& bn = static_cast<const BatchNormTrainingBackprop&>(other);
+    return m_epsilon == bn.m_epsilon;
+}
+
 void ngraph::op::BatchNormTraining::generate_adjoints(autodiff::Adjoints& adjoints,
                                                       const NodeVector& deltas)
 {
@@ -73,6 +73,12 @@ shared_ptr<Node> op::Broadcast::copy_with_new_args(const NodeVector& new_args) c
     return make_shared<Broadcast>(new_args.at(0), m_shape, m_broadcast_axes);
 }
 
+bool op::Broadcast::has_same_attributes(const Node& other) const
+{
+    auto& broadcast = static_cast<const Broadcast&>(other);
+    return m_shape == broadcast.m_shape && m_broadcast_axes == broadcast.m_broadcast_axes;
+}
+
 void op::Broadcast::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     auto delta = deltas.at(0);
@@ -100,6 +106,13 @@ shared_ptr<Node> op::BroadcastLike::copy_with_new_args(const NodeVector& new_arg
     return make_shared<BroadcastLike>(new_args.at(0), new_args.at(1), m_initial_broadcast_axes);
 }
 
+bool op::BroadcastLike::has_same_attributes(const Node& other) const
+{
+    auto& broadcast = static_cast<const BroadcastLike&>(other);
+    return Broadcast::has_same_attributes(other) &&
+           m_initial_broadcast_axes == broadcast.m_initial_broadcast_axes;
+}
+
 void op::BroadcastLike::infer_shape()
 {
     const Shape& in_shape = get_input_shape(0);
@@ -83,6 +83,12 @@ shared_ptr<Node> op::Concat::copy_with_new_args(const NodeVector& new_args) cons
     return make_shared<Concat>(new_args, m_concatenation_axis);
 }
 
+bool op::Concat::has_same_attributes(const Node& other) const
+{
+    auto& concat = static_cast<const Concat&>(other);
+    return m_concatenation_axis == concat.m_concatenation_axis;
+}
+
 void op::Concat::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     auto delta = deltas.at(0);
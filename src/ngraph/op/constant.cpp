@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 
 #include "ngraph/log.hpp"
 #include "ngraph/op/constant.hpp"
@@ -164,6 +165,40 @@ shared_ptr<Node> op::Constant::copy_with_new_args(const NodeVector& new_args) co
     return make_shared<Constant>(m_element_type, m_shape, m_data);
 }
 
+bool op::Constant::has_same_attributes(const Node& other) const
+{
+    auto& constant = static_cast<const Constant&>(other);
+    if (m_element_type != constant.m_element_type || m_shape != constant.m_shape ||
+        m_data == nullptr || constant.m_data == nullptr)
+    {
+        return false;
+    }
+    return m_data == constant.m_data ||
+           memcmp(m_data, constant.m_data, shape_size(m_shape) * m_element_type.size()) == 0;
+}
+
+size_t op::Constant::get_attributes_hash() const
+{
+    // Hash the contents a word at a time; the tail is folded into the final word
+    vector<size_t> hashes{m_element_type.hash(), shape_size(m_shape)};
+    if (m_data != nullptr)
+    {
+        size_t byte_count = shape_size(m_shape) * m_element_type.size();
+        const char* bytes = static_cast<const char*>(m_data);
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= byte_count; i += sizeof(uint64_t))
+        {
+            uint64_t word;
+            memcpy(&word, bytes + i, sizeof(word));
+            hashes.push_back(std::hash<uint64_t>()(word));
+        }
+        uint64_t tail = 0;
+        memcpy(&tail, bytes + i, byte_count - i);
+        hashes.push_back(std::hash<uint64_t>()(tail));
+    }
+    return hash_combine(hashes);
+}
+
 shared_ptr<op::Constant> op::ScalarConstantLikeBase::as_constant() const
 {
     return std::make_shared<op::Constant>(m_element_type, m_shape, m_data);
@@ -143,6 +143,8 @@ namespace ngraph
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+            bool has_same_attributes(const Node& other) const override;
+            size_t get_attributes_hash() const override;
 
             /// \return The initialization literals for the tensor constant.
             std::vector<std::string> get_value_strings() const;
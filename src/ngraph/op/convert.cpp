@@ -39,6 +39,12 @@ shared_ptr<Node> op::Convert::copy_with_new_args(const NodeVector& new_args) con
     return make_shared<Convert>(new_args.at(0), m_element_type);
 }
 
+bool op::Convert::has_same_attributes(const Node& other) const
+{
+    auto& convert = static_cast<const Convert&>(other);
+    return m_element_type == convert.m_element_type;
+}
+
 void op::Convert::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     auto delta = deltas.at(0);
@@ -195,6 +195,15 @@ shared_ptr<Node> op::Convolution::copy_with_new_args(const NodeVector& new_args)
                                     m_data_dilation_strides);
 }
 
+bool op::Convolution::has_same_attributes(const Node& other) const
+{
+    auto& conv = static_cast<const Convolution&>(other);
+    return m_window_movement_strides == conv.m_window_movement_strides &&
+           m_window_dilation_strides == conv.m_window_dilation_strides &&
+           m_padding_below == conv.m_padding_below && m_padding_above == conv.m_padding_above &&
+           m_data_dilation_strides == conv.m_data_dilation_strides;
+}
+
 void op::Convolution::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     auto delta = deltas.at(0);
@@ -422,6 +431,17 @@ shared_ptr<Node> op::ConvolutionBackpropData::copy_with_new_args(const NodeVecto
                                                 m_data_dilation_strides_forward);
 }
 
+bool op::ConvolutionBackpropData::has_same_attributes(const Node& other) const
+{
+    auto& conv = static_cast<const ConvolutionBackpropData&>(other);
+    return m_data_batch_shape == conv.m_data_batch_shape &&
+           m_window_movement_strides_forward == conv.m_window_movement_strides_forward &&
+           m_window_dilation_strides_forward == conv.m_window_dilation_strides_forward &&
+           m_padding_below_forward == conv.m_padding_below_forward &&
+           m_padding_above_forward == conv.m_padding_above_forward &&
+           m_data_dilation_strides_forward == conv.m_data_dilation_strides_forward;
+}
+
 op::ConvolutionBackpropFilters::ConvolutionBackpropFilters(
     const shared_ptr<Node>& data_batch,
     const Shape& filters_shape,
@@ -544,6 +564,17 @@ shared_ptr<Node>
                                                    m_data_dilation_strides_forward);
 }
 
+bool op::ConvolutionBackpropFilters::has_same_attributes(const Node& other) const
+{
+    auto& conv = static_cast<const ConvolutionBackpropFilters&>(other);
+    return m_filters_shape == conv.m_filters_shape &&
+           m_window_movement_strides_forward == conv.m_window_movement_strides_forward &&
+           m_window_dilation_strides_forward == conv.m_window_dilation_strides_forward &&
+           m_padding_below_forward == conv.m_padding_below_forward &&
+           m_padding_above_forward == conv.m_padding_above_forward &&
+           m_data_dilation_strides_forward == conv.m_data_dilation_strides_forward;
+}
+
 //
 // This is a legacy function, retained because the CPU backend uses it for now.
 // TODO(amprocte): Update CPU backend to use the new stuff in validation_util.hpp, and remove this
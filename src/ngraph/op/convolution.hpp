@@ -129,6 +129,8 @@ namespace ngraph
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+
+            bool has_same_attributes(const Node& other) const override;
             void generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas) override;
 
             /// \return The window movement strides.
@@ -192,6 +194,8 @@ namespace ngraph
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
 
+            bool has_same_attributes(const Node& other) const override;
+
             /// \return The data batch shape.
             const Shape& get_data_batch_shape() const { return m_data_batch_shape; }
             /// \return The window movement strides from the forward prop.
@@ -289,6 +293,8 @@ namespace ngraph
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
 
+            bool has_same_attributes(const Node& other) const override;
+
             /// \return The filters tensor shape.
             const Shape& get_filters_shape() const { return m_filters_shape; }
             /// \return The window movement strides from the forward prop.
@@ -33,6 +33,7 @@ namespace ngraph
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+            bool has_same_attributes(const Node& other) const override { return true; }
 
         protected:
             virtual void generate_adjoints(autodiff::Adjoints& adjoints,
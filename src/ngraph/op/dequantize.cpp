@@ -126,6 +126,12 @@ shared_ptr<Node> op::Dequantize::copy_with_new_args(const NodeVector& new_args)
     return make_shared<Dequantize>(new_args.at(0), new_args.at(1), new_args.at(2), m_type, m_axes);
 }
 
+bool op::Dequantize::has_same_attributes(const Node& other) const
+{
+    auto& dequantize = static_cast<const Dequantize&>(other);
+    return m_type == dequantize.m_type && m_axes == dequantize.m_axes;
+}
+
 void op::Dequantize::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     throw ngraph_error("Forward-propagation-only operation");
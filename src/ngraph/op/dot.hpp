@@ -60,6 +60,11 @@ namespace ngraph
                 return std::make_shared<Dot>(
                     new_args.at(0), new_args.at(1), m_reduction_axes_count);
             }
+            bool has_same_attributes(const Node& other) const override
+            {
+                return m_reduction_axes_count ==
+                       static_cast<const Dot&>(other).m_reduction_axes_count;
+            }
 
         protected:
             size_t m_reduction_axes_count;
@@ -36,6 +36,8 @@ namespace ngraph
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+
+            bool has_same_attributes(const Node& other) const override;
             void validate_and_infer_types() override;
 
             /// \return The index of the tuple element to get.
@@ -47,6 +47,13 @@ shared_ptr<Node> op::LRN::copy_with_new_args(const NodeVector& new_args) const
     return make_shared<op::LRN>(new_args.at(0), m_alpha, m_beta, m_bias, m_size);
 }
 
+bool op::LRN::has_same_attributes(const Node& other) const
+{
+    auto& lrn = static_cast<const LRN&>(other);
+    return m_alpha == lrn.m_alpha && m_beta == lrn.m_beta && m_bias == lrn.m_bias &&
+           m_size == lrn.m_size;
+}
+
 void op::LRN::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     throw ngraph_error("NYI");
@@ -50,6 +50,8 @@ namespace ngraph
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
 
+            bool has_same_attributes(const Node& other) const override;
+
             double get_alpha() const { return m_alpha; }
             double get_beta() const { return m_beta; }
             double get_bias() const { return m_bias; }
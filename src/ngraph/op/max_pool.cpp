@@ -97,6 +97,14 @@ shared_ptr<Node> op::MaxPool::copy_with_new_args(const NodeVector& new_args) con
                                 m_padding_above);
 }
 
+bool op::MaxPool::has_same_attributes(const Node& other) const
+{
+    auto& pool = static_cast<const MaxPool&>(other);
+    return m_window_shape == pool.m_window_shape &&
+           m_window_movement_strides == pool.m_window_movement_strides &&
+           m_padding_below == pool.m_padding_below && m_padding_above == pool.m_padding_above;
+}
+
 op::MaxPoolBackprop::MaxPoolBackprop(const shared_ptr<Node>& arg_forward,
                                      const shared_ptr<Node>& delta,
                                      const Shape& window_shape,
@@ -168,6 +176,14 @@ shared_ptr<Node> op::MaxPoolBackprop::copy_with_new_args(const NodeVector& new_a
                                             m_padding_above);
 }
 
+bool op::MaxPoolBackprop::has_same_attributes(const Node& other) const
+{
+    auto& pool = static_cast<const MaxPoolBackprop&>(other);
+    return m_window_shape == pool.m_window_shape &&
+           m_window_movement_strides == pool.m_window_movement_strides &&
+           m_padding_below == pool.m_padding_below && m_padding_above == pool.m_padding_above;
+}
+
 void op::MaxPool::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     auto delta = deltas.at(0);
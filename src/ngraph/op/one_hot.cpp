@@ -79,3 +79,9 @@ shared_ptr<Node> op::OneHot::copy_with_new_args(const NodeVector& new_args) cons
     check_new_args_count(this, new_args);
     return make_shared<OneHot>(new_args.at(0), m_shape, m_one_hot_axis);
 }
+
+bool op::OneHot::has_same_attributes(const Node& other) const
+{
+    auto& one_hot = static_cast<const OneHot&>(other);
+    return m_one_hot_axis == one_hot.m_one_hot_axis;
+}
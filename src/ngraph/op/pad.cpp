@@ -91,6 +91,13 @@ shared_ptr<Node> op::Pad::copy_with_new_args(const NodeVector& new_args) const
         new_args.at(0), new_args.at(1), m_padding_below, m_padding_above, m_padding_interior);
 }
 
+bool op::Pad::has_same_attributes(const Node& other) const
+{
+    auto& pad = static_cast<const Pad&>(other);
+    return m_padding_below == pad.m_padding_below && m_padding_above == pad.m_padding_above &&
+           m_padding_interior == pad.m_padding_interior;
+}
+
 /* The "y" half of this is going to be a bit tricky... best way to handle it, I think,
    is to ReplaceSlice the non-padded values in the incoming delta tensor with a zero
    broadcasted to x's shape; then sum that and backprop the result to y.
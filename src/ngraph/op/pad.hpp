@@ -41,6 +41,8 @@ namespace ngraph
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+
+            bool has_same_attributes(const Node& other) const override;
             /// \return The padding-below sizes.
             const Shape& get_padding_below() const { return m_padding_below; }
             /// \return The padding-above sizes.
@@ -129,6 +129,13 @@ shared_ptr<Node> op::Quantize::copy_with_new_args(const NodeVector& new_args) co
         new_args.at(0), new_args.at(1), new_args.at(2), m_type, m_axes, m_round_mode);
 }
 
+bool op::Quantize::has_same_attributes(const Node& other) const
+{
+    auto& quantize = static_cast<const Quantize&>(other);
+    return m_type == quantize.m_type && m_axes == quantize.m_axes &&
+           m_round_mode == quantize.m_round_mode;
+}
+
 void op::Quantize::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     throw ngraph_error("Forward-propagation-only operation");
@@ -133,6 +133,13 @@ shared_ptr<Node> op::ReplaceSlice::copy_with_new_args(const NodeVector& new_args
         new_args.at(0), new_args.at(1), m_lower_bounds, m_upper_bounds, m_strides);
 }
 
+bool op::ReplaceSlice::has_same_attributes(const Node& other) const
+{
+    auto& slice = static_cast<const ReplaceSlice&>(other);
+    return m_lower_bounds == slice.m_lower_bounds && m_upper_bounds == slice.m_upper_bounds &&
+           m_strides == slice.m_strides;
+}
+
 void op::ReplaceSlice::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     auto delta = deltas.at(0);
@@ -92,6 +92,12 @@ shared_ptr<Node> op::Reshape::copy_with_new_args(const NodeVector& new_args) con
     return make_shared<Reshape>(new_args.at(0), m_input_order, m_output_shape);
 }
 
+bool op::Reshape::has_same_attributes(const Node& other) const
+{
+    auto& reshape = static_cast<const Reshape&>(other);
+    return m_input_order == reshape.m_input_order && m_output_shape == reshape.m_output_shape;
+}
+
 void op::Reshape::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     auto delta = deltas.at(0);
@@ -55,6 +55,12 @@ shared_ptr<Node> op::Reverse::copy_with_new_args(const NodeVector& new_args) con
     return make_shared<Reverse>(new_args.at(0), m_reversed_axes);
 }
 
+bool op::Reverse::has_same_attributes(const Node& other) const
+{
+    auto& reverse = static_cast<const Reverse&>(other);
+    return m_reversed_axes == reverse.m_reversed_axes;
+}
+
 void op::Reverse::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     auto delta = deltas.at(0);
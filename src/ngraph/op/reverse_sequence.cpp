@@ -82,6 +82,12 @@ shared_ptr<Node> op::ReverseSequence::copy_with_new_args(const NodeVector& new_a
     return res;
 }
 
+bool op::ReverseSequence::has_same_attributes(const Node& other) const
+{
+    auto& reverse = static_cast<const ReverseSequence&>(other);
+    return m_batch_axis == reverse.m_batch_axis && m_seq_axis == reverse.m_seq_axis;
+}
+
 void op::ReverseSequence::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     auto x = get_argument(0);
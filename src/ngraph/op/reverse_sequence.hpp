@@ -40,6 +40,8 @@ namespace ngraph
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
 
+            bool has_same_attributes(const Node& other) const override;
+
             size_t get_batch_axis() const { return m_batch_axis; }
             size_t get_sequence_axis() const { return m_seq_axis; }
         protected:
@@ -101,6 +101,13 @@ shared_ptr<Node> op::Slice::copy_with_new_args(const NodeVector& new_args) const
     return make_shared<Slice>(new_args.at(0), m_lower_bounds, m_upper_bounds, m_strides);
 }
 
+bool op::Slice::has_same_attributes(const Node& other) const
+{
+    auto& slice = static_cast<const Slice&>(other);
+    return m_lower_bounds == slice.m_lower_bounds && m_upper_bounds == slice.m_upper_bounds &&
+           m_strides == slice.m_strides;
+}
+
 void op::Slice::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     auto delta = deltas.at(0);
@@ -58,6 +58,12 @@ shared_ptr<Node> op::Softmax::copy_with_new_args(const NodeVector& new_args) con
     return make_shared<Softmax>(new_args.at(0), m_axes);
 }
 
+bool op::Softmax::has_same_attributes(const Node& other) const
+{
+    auto& softmax = static_cast<const Softmax&>(other);
+    return m_axes == softmax.m_axes;
+}
+
 void op::Softmax::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     auto delta = deltas.at(0);
@@ -90,6 +90,13 @@ shared_ptr<Node> op::TopK::copy_with_new_args(const NodeVector& new_args) const
         new_args.at(0), m_top_k_axis, m_index_element_type, m_k, m_compute_max);
 }
 
+bool op::TopK::has_same_attributes(const Node& other) const
+{
+    auto& topk = static_cast<const TopK&>(other);
+    return m_top_k_axis == topk.m_top_k_axis && m_index_element_type == topk.m_index_element_type &&
+           m_k == topk.m_k && m_compute_max == topk.m_compute_max;
+}
+
 void op::TopK::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
     throw ngraph_error("Forward-propagation-only operation");
@@ -27,6 +27,12 @@ op::util::ArithmeticReduction::ArithmeticReduction(const std::string& node_type,
 {
 }
 
+bool op::util::ArithmeticReduction::has_same_attributes(const Node& other) const
+{
+    auto& reduction = static_cast<const ArithmeticReduction&>(other);
+    return m_reduction_axes == reduction.m_reduction_axes;
+}
+
 void op::util::ArithmeticReduction::validate_and_infer_types()
 {
     auto input_shape = get_input_partial_shape(0);
@@ -39,6 +39,8 @@ namespace ngraph
 
                 void validate_and_infer_types() override;
 
+                bool has_same_attributes(const Node& other) const override;
+
                 /// \return The axis positions (0-based) to be eliminated through reduction.
                 const AxisSet& get_reduction_axes() const { return m_reduction_axes; }
             protected:
@@ -32,6 +32,12 @@ op::util::IndexReduction::IndexReduction(const std::string& node_type,
     constructor_validate_and_infer_types();
 }
 
+bool op::util::IndexReduction::has_same_attributes(const Node& other) const
+{
+    auto& reduction = static_cast<const IndexReduction&>(other);
+    return m_axis == reduction.m_axis && m_index_element_type == reduction.m_index_element_type;
+}
+
 void op::util::IndexReduction::validate_and_infer_types()
 {
     const PartialShape& arg_shape = get_input_partial_shape(0);
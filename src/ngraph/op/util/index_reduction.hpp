@@ -34,6 +34,8 @@ namespace ngraph
                                size_t axis,
                                const element::Type& index_element_type);
 
+                bool has_same_attributes(const Node& other) const override;
+
             protected:
                 size_t m_axis;
                 element::Type m_index_element_type;
@@ -31,6 +31,15 @@ namespace ngraph
                 bool destructive;
             };
 
+            /// \brief A tensor that is placed inside the buffer of another tensor
+            struct view_pair
+            {
+                size_t output;
+                size_t input;
+                // byte offset of the view in the buffer it is placed in
+                size_t offset;
+            };
+
             /// \brief Base class for annotations added to graph ops
             class OpAnnotations
             {
@@ -54,11 +63,35 @@ namespace ngraph
                     return m_in_place_oi_pairs;
                 }
 
+                /// \brief The output is a view of the input starting at offset bytes
+                void add_output_view(const struct view_pair& view)
+                {
+                    m_output_views.emplace_back(view);
+                }
+
+                const std::vector<struct view_pair>& get_output_views() const
+                {
+                    return m_output_views;
+                }
+
+                /// \brief The input is computed directly into the output, offset bytes in
+                void add_input_view(const struct view_pair& view)
+                {
+                    m_input_views.emplace_back(view);
+                }
+
+                const std::vector<struct view_pair>& get_input_views() const
+                {
+                    return m_input_views;
+                }
+
                 bool is_cacheable() const { return m_cacheable; }
                 void set_cacheable(bool val) { m_cacheable = val; }
             private:
                 // map of output-input pairs for which in-place computation is valid
                 std::vector<struct oi_pair> m_in_place_oi_pairs;
+                std::vector<struct view_pair> m_output_views;
+                std::vector<struct view_pair> m_input_views;
 
                 bool m_cacheable = false;
             };
@@ -51,6 +51,8 @@ namespace ngraph
                                            const std::shared_ptr<Node>& arg);
 
                 void validate_and_infer_types() override;
+                /// \brief Ops derived from this one must compare their own attributes, if any
+                bool has_same_attributes(const Node& other) const override = 0;
             };
         }
     }
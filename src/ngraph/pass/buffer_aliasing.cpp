@@ -0,0 +1,341 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/descriptor/input.hpp"
+#include "ngraph/descriptor/layout/tensor_layout.hpp"
+#include "ngraph/descriptor/output.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/acos.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/and.hpp"
+#include "ngraph/op/asin.hpp"
+#include "ngraph/op/atan.hpp"
+#include "ngraph/op/ceiling.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/cos.hpp"
+#include "ngraph/op/cosh.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/floor.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/not.hpp"
+#include "ngraph/op/or.hpp"
+#include "ngraph/op/pad.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/power.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/replace_slice.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sign.hpp"
+#include "ngraph/op/sin.hpp"
+#include "ngraph/op/sinh.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tan.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/pass/buffer_aliasing.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+// Ops whose output element i depends only on element i of each input, so the output may
+// overwrite an input. Elementwise base classes are not enough: LRN, for one, reads
+// neighbouring channels of its input.
+static bool is_pointwise(const Node* node)
+{
+    static const unordered_set<type_index> pointwise_ops{
+        TI(op::Abs),             TI(op::Acos),            TI(op::Add),
+        TI(op::And),             TI(op::Asin),            TI(op::Atan),
+        TI(op::Ceiling),         TI(op::Cos),             TI(op::Cosh),
+        TI(op::Divide),          TI(op::Exp),             TI(op::Floor),
+        TI(op::Log),             TI(op::Maximum),         TI(op::Minimum),
+        TI(op::Multiply),        TI(op::Negative),        TI(op::Not),
+        TI(op::Or),              TI(op::Power),           TI(op::Relu),
+        TI(op::ReluBackprop),    TI(op::Sigmoid),         TI(op::SigmoidBackprop),
+        TI(op::Sign),            TI(op::Sin),             TI(op::Sinh),
+        TI(op::Sqrt),            TI(op::Subtract),        TI(op::Tan),
+        TI(op::Tanh)};
+    return pointwise_ops.count(TI(*node)) != 0;
+}
+
+// If the elements of shape from lower to upper are one contiguous range in row-major order,
+// sets offset to the index of the first of them
+static bool get_contiguous_offset(const Shape& shape,
+                                  const Coordinate& lower,
+                                  const Coordinate& upper,
+                                  size_t& offset)
+{
+    // Axes after the last partial axis must be whole, and axes before it must have extent 1
+    size_t partial_axis = 0;
+    for (size_t i = shape.size(); i-- > 0;)
+    {
+        if (lower[i] != 0 || upper[i] != shape[i])
+        {
+            partial_axis = i;
+            break;
+        }
+    }
+    for (size_t i = 0; i < partial_axis; i++)
+    {
+        if (upper[i] - lower[i] != 1)
+        {
+            return false;
+        }
+    }
+    offset = 0;
+    Strides strides = row_major_strides(shape);
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        offset += lower[i] * strides[i];
+    }
+    return true;
+}
+
+// Byte offset of each input of a Concat or Pad that is a contiguous range of the output
+static vector<pair<size_t, size_t>> get_input_view_offsets(const shared_ptr<Node>& node)
+{
+    vector<pair<size_t, size_t>> views;
+    const Shape& output_shape = node->get_output_shape(0);
+    size_t element_size = node->get_output_element_type(0).size();
+    if (auto concat = dynamic_pointer_cast<op::Concat>(node))
+    {
+        size_t axis = concat->get_concatenation_axis();
+        Coordinate lower(output_shape.size(), 0);
+        Coordinate upper = output_shape;
+        for (size_t i = 0; i < node->get_input_size(); i++)
+        {
+            upper[axis] = lower[axis] + node->get_input_shape(i)[axis];
+            size_t offset;
+            if (shape_size(node->get_input_shape(i)) != 0 &&
+                get_contiguous_offset(output_shape, lower, upper, offset))
+            {
+                views.emplace_back(i, offset * element_size);
+            }
+            lower[axis] = upper[axis];
+        }
+    }
+    else if (auto pad = dynamic_pointer_cast<op::Pad>(node))
+    {
+        const Shape& padding_interior = pad->get_padding_interior();
+        const Shape& arg_shape = node->get_input_shape(0);
+        Coordinate lower(pad->get_padding_below().begin(), pad->get_padding_below().end());
+        Coordinate upper = lower;
+        for (size_t i = 0; i < arg_shape.size(); i++)
+        {
+            upper[i] += arg_shape[i];
+        }
+        size_t offset;
+        if (shape_size(padding_interior) == 0 && shape_size(arg_shape) != 0 &&
+            get_contiguous_offset(output_shape, lower, upper, offset))
+        {
+            views.emplace_back(0, offset * element_size);
+        }
+    }
+    return views;
+}
+
+bool pass::BufferAliasing::run_on_function(shared_ptr<Function> function)
+{
+    // Ops skipped by backends that cache the outputs of ops computed only from constants and
+    // cacheable parameters. Such an output must not be overwritten by an op that runs on every
+    // call.
+    unordered_map<const Node*, bool> cacheable;
+    for (const auto& node : function->get_ordered_ops())
+    {
+        bool is_cacheable = true;
+        if (auto parameter = dynamic_pointer_cast<op::Parameter>(node))
+        {
+            is_cacheable = parameter->get_cacheable();
+        }
+        else if (!node->is_constant())
+        {
+            for (const descriptor::Input& input : node->get_inputs())
+            {
+                is_cacheable = is_cacheable && cacheable.at(input.get_output().get_node().get());
+            }
+        }
+        cacheable[node.get()] = is_cacheable;
+    }
+
+    auto get_op_annotations = [this](const shared_ptr<op::Op>& op) {
+        auto op_annotations = op->get_op_annotations();
+        if (!op_annotations)
+        {
+            op_annotations = op_annotations_factory();
+            op->set_op_annotations(op_annotations);
+        }
+        return op_annotations;
+    };
+
+    // An input that no other op reads is computed directly into its slot of a Concat or Pad
+    // output. This runs first because it removes a copy, where overwriting an input only saves
+    // memory.
+    unordered_set<const descriptor::Tensor*> placed;
+    unordered_set<const Node*> hosts;
+    for (const auto& node : function->get_ordered_ops())
+    {
+        auto op = dynamic_pointer_cast<op::Op>(node);
+        auto op_annotations = op ? op->get_op_annotations() : nullptr;
+        if (op_annotations && !op_annotations->get_input_views().empty())
+        {
+            // Views from an earlier run
+            for (auto view : op_annotations->get_input_views())
+            {
+                placed.insert(&node->get_inputs().at(view.input).get_tensor());
+            }
+            hosts.insert(node.get());
+            continue;
+        }
+        if (!op || (op_annotations && !op_annotations->get_in_place_oi_pairs().empty()))
+        {
+            continue;
+        }
+        for (const pair<size_t, size_t>& view : get_input_view_offsets(node))
+        {
+            const descriptor::Input& input = node->get_inputs().at(view.first);
+            const descriptor::Output& output = input.get_output();
+            const Node* arg = output.get_node().get();
+            // Views of views would need the outer buffer before the inner one is placed
+            if (arg->is_parameter() || arg->is_constant() || hosts.count(arg) != 0 ||
+                output.get_inputs().size() != 1 || cacheable.at(arg) != cacheable.at(node.get()))
+            {
+                continue;
+            }
+            get_op_annotations(op)->add_input_view({0, view.first, view.second});
+            placed.insert(&output.get_tensor());
+            hosts.insert(node.get());
+            NGRAPH_DEBUG << "buffer aliasing: " << node->get_name() << " input " << view.first
+                         << " is computed in its output at offset " << view.second;
+        }
+    }
+
+    for (const auto& node : function->get_ordered_ops())
+    {
+        auto op = dynamic_pointer_cast<op::Op>(node);
+        if (!op || node->get_output_size() != 1 || hosts.count(node.get()) != 0 ||
+            placed.count(&node->get_output_tensor(0)) != 0)
+        {
+            continue;
+        }
+        auto op_annotations = op->get_op_annotations();
+        if (op_annotations && (!op_annotations->get_in_place_oi_pairs().empty() ||
+                               !op_annotations->get_output_views().empty()))
+        {
+            continue;
+        }
+
+        const descriptor::Tensor& output = node->get_output_tensor(0);
+
+        // A contiguous Slice is a view of its input at an offset
+        if (auto slice = dynamic_pointer_cast<op::Slice>(node))
+        {
+            const Strides& strides = slice->get_strides();
+            size_t offset;
+            if (all_of(strides.begin(), strides.end(), [](size_t s) { return s == 1; }) &&
+                get_contiguous_offset(node->get_input_shape(0),
+                                      slice->get_lower_bounds(),
+                                      slice->get_upper_bounds(),
+                                      offset))
+            {
+                offset *= output.get_element_type().size();
+                get_op_annotations(op)->add_output_view({0, 0, offset});
+                NGRAPH_DEBUG << "buffer aliasing: " << node->get_name()
+                             << " output is a view of its input at offset " << offset;
+            }
+            continue;
+        }
+
+        // Candidate inputs and whether the output overwrites them
+        vector<size_t> inputs;
+        bool destructive = true;
+        if (auto reshape = dynamic_pointer_cast<op::Reshape>(node))
+        {
+            if (!reshape->get_is_transpose())
+            {
+                inputs.push_back(0);
+                destructive = false;
+            }
+        }
+        else if (dynamic_pointer_cast<op::ReplaceSlice>(node))
+        {
+            inputs.push_back(0);
+        }
+        else if (is_pointwise(node.get()))
+        {
+            for (size_t i = 0; i < node->get_input_size(); i++)
+            {
+                inputs.push_back(i);
+            }
+        }
+
+        for (size_t i : inputs)
+        {
+            const descriptor::Input& input = node->get_inputs().at(i);
+            const descriptor::Tensor& tensor = input.get_tensor();
+            const Node* arg = input.get_output().get_node().get();
+            if (tensor.get_element_type() != output.get_element_type() ||
+                tensor.size() != output.size())
+            {
+                continue;
+            }
+            if (destructive)
+            {
+                if (arg->is_parameter() || arg->is_constant() ||
+                    cacheable.at(arg) != cacheable.at(node.get()))
+                {
+                    continue;
+                }
+                bool only_user = true;
+                for (const descriptor::Input* user : input.get_output().get_inputs())
+                {
+                    only_user = only_user && user->get_raw_pointer_node() == node.get();
+                }
+                // Kernels that overwrite their input expect the same layout on both sides
+                auto input_layout = tensor.get_tensor_layout();
+                auto output_layout = output.get_tensor_layout();
+                if (!only_user ||
+                    (input_layout && output_layout && *input_layout != *output_layout))
+                {
+                    continue;
+                }
+            }
+
+            get_op_annotations(op)->add_in_place_oi_pair({0, i, destructive});
+            NGRAPH_DEBUG << "buffer aliasing: " << node->get_name() << " output aliases input "
+                         << i;
+            break;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,67 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "ngraph/op/util/op_annotations.hpp"
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class BufferAliasing;
+    }
+}
+
+/// \brief Marks tensors that can share the buffer of another tensor.
+///
+/// - An input of a Concat or Pad that no other op reads is computed directly into its slot
+///   of the output when that slot is contiguous.
+/// - A contiguous Slice is a view of its input at an offset, and a Reshape that does not
+///   transpose is a view of its whole input.
+/// - Pointwise ops and ReplaceSlice may overwrite an input of the same type and size that no
+///   other op reads.
+///
+/// The pairs and views are added to the op annotations, and pass::MemoryLayout places the
+/// tensors accordingly when the lifetimes allow it. Ops that already carry in-place pairs
+/// from a backend pass are left alone.
+class ngraph::pass::BufferAliasing : public FunctionPass
+{
+public:
+    BufferAliasing()
+        : FunctionPass()
+    {
+    }
+
+    BufferAliasing(std::function<std::shared_ptr<ngraph::op::util::OpAnnotations>(void)> func)
+        : FunctionPass()
+        , op_annotations_factory(func)
+    {
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+private:
+    std::function<std::shared_ptr<ngraph::op::util::OpAnnotations>(void)> op_annotations_factory =
+        []() -> std::shared_ptr<ngraph::op::util::OpAnnotations> {
+        auto op_annotations = std::make_shared<ngraph::op::util::OpAnnotations>();
+        return op_annotations;
+    };
+};
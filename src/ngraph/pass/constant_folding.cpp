@@ -14,41 +14,146 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <limits>
 #include <stdint.h>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
 
 #include "constant_folding.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/op/abs.hpp"
+#include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/and.hpp"
+#include "ngraph/op/argmax.hpp"
+#include "ngraph/op/argmin.hpp"
+#include "ngraph/op/asin.hpp"
+#include "ngraph/op/atan.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/batch_norm.hpp"
 #include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/ceiling.hpp"
+#include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/cos.hpp"
+#include "ngraph/op/cosh.hpp"
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/equal.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/experimental/generate_mask.hpp"
+#include "ngraph/op/experimental/shape_of.hpp"
+#include "ngraph/op/floor.hpp"
+#include "ngraph/op/function_call.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/greater.hpp"
+#include "ngraph/op/greater_eq.hpp"
+#include "ngraph/op/less.hpp"
+#include "ngraph/op/less_eq.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/lrn.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/maximum.hpp"
+#include "ngraph/op/min.hpp"
 #include "ngraph/op/minimum.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
+#include "ngraph/op/not.hpp"
+#include "ngraph/op/not_equal.hpp"
+#include "ngraph/op/one_hot.hpp"
+#include "ngraph/op/or.hpp"
 #include "ngraph/op/pad.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/power.hpp"
+#include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
+#include "ngraph/op/reduce.hpp"
+#include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
+#include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/reverse.hpp"
+#include "ngraph/op/reverse_sequence.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/select_and_scatter.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sign.hpp"
+#include "ngraph/op/sin.hpp"
+#include "ngraph/op/sinh.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/stop_gradient.hpp"
 #include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/tan.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/op/topk.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/runtime/reference/abs.hpp"
+#include "ngraph/runtime/reference/acos.hpp"
 #include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/and.hpp"
+#include "ngraph/runtime/reference/argmax.hpp"
+#include "ngraph/runtime/reference/argmin.hpp"
+#include "ngraph/runtime/reference/asin.hpp"
+#include "ngraph/runtime/reference/atan.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/ceiling.hpp"
+#include "ngraph/runtime/reference/concat.hpp"
+#include "ngraph/runtime/reference/convert.hpp"
+#include "ngraph/runtime/reference/cos.hpp"
+#include "ngraph/runtime/reference/cosh.hpp"
 #include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/equal.hpp"
+#include "ngraph/runtime/reference/exp.hpp"
+#include "ngraph/runtime/reference/floor.hpp"
+#include "ngraph/runtime/reference/greater.hpp"
+#include "ngraph/runtime/reference/greater_eq.hpp"
+#include "ngraph/runtime/reference/less.hpp"
+#include "ngraph/runtime/reference/less_eq.hpp"
+#include "ngraph/runtime/reference/log.hpp"
+#include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/maximum.hpp"
+#include "ngraph/runtime/reference/min.hpp"
 #include "ngraph/runtime/reference/minimum.hpp"
 #include "ngraph/runtime/reference/multiply.hpp"
 #include "ngraph/runtime/reference/negate.hpp"
+#include "ngraph/runtime/reference/not.hpp"
+#include "ngraph/runtime/reference/not_equal.hpp"
+#include "ngraph/runtime/reference/one_hot.hpp"
+#include "ngraph/runtime/reference/or.hpp"
 #include "ngraph/runtime/reference/pad.hpp"
+#include "ngraph/runtime/reference/power.hpp"
+#include "ngraph/runtime/reference/product.hpp"
 #include "ngraph/runtime/reference/quantize.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
+#include "ngraph/runtime/reference/replace_slice.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/reverse.hpp"
+#include "ngraph/runtime/reference/reverse_sequence.hpp"
+#include "ngraph/runtime/reference/select.hpp"
+#include "ngraph/runtime/reference/sigmoid.hpp"
+#include "ngraph/runtime/reference/sign.hpp"
+#include "ngraph/runtime/reference/sin.hpp"
+#include "ngraph/runtime/reference/sinh.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/runtime/reference/sqrt.hpp"
 #include "ngraph/runtime/reference/subtract.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/runtime/reference/tan.hpp"
+#include "ngraph/runtime/reference/tanh.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -618,3 +723,527 @@ void ngraph::pass::ConstantFolding::construct_constant_quantize()
     auto quantize_matcher = make_shared<pattern::Matcher>(quant, constant_quantize_callback);
     this->add_matcher(quantize_matcher);
 }
+
+namespace
+{
+// This expands the op list in op_tbl.hpp into a list of enumerations that look like this:
+// Abs,
+// Acos,
+// ...
+#define NGRAPH_OP(a, b) a,
+    enum class OP_TYPEID
+    {
+#include "ngraph/op/op_tbl.hpp"
+    };
+#undef NGRAPH_OP
+}
+
+template <class T>
+static bool
+    evaluate(OP_TYPEID type_id, const Node& node, const vector<const void*>& args, void* out)
+{
+    const T* arg0 = static_cast<const T*>(args.at(0));
+    const T* arg1 = args.size() > 1 ? static_cast<const T*>(args[1]) : nullptr;
+    T* out0 = static_cast<T*>(out);
+    size_t element_count = shape_size(node.get_output_shape(0));
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+    switch (type_id)
+    {
+    case OP_TYPEID::Abs: runtime::reference::abs<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Acos: runtime::reference::acos<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Asin: runtime::reference::asin<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Atan: runtime::reference::atan<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Ceiling: runtime::reference::ceiling<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Cos: runtime::reference::cos<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Cosh: runtime::reference::cosh<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Exp: runtime::reference::exp<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Floor: runtime::reference::floor<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Log: runtime::reference::log<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Negative: runtime::reference::negate<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Not: runtime::reference::logical_not(arg0, out0, element_count); break;
+    case OP_TYPEID::Relu: runtime::reference::relu<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Sigmoid: runtime::reference::sigmoid<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Sign: runtime::reference::sign<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Sin: runtime::reference::sin<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Sinh: runtime::reference::sinh<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Sqrt: runtime::reference::sqrt<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Tan: runtime::reference::tan<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Tanh: runtime::reference::tanh<T>(arg0, out0, element_count); break;
+    case OP_TYPEID::Add: runtime::reference::add<T>(arg0, arg1, out0, element_count); break;
+    case OP_TYPEID::And: runtime::reference::logical_and(arg0, arg1, out0, element_count); break;
+    case OP_TYPEID::Divide:
+    {
+        // Integer division by zero, and of the most negative value by -1, would trap here
+        // rather than in the run that may never take this path
+        if (is_integral<T>::value)
+        {
+            for (size_t i = 0; i < element_count; i++)
+            {
+                if (arg1[i] == T(0) || (is_signed<T>::value && arg1[i] == T(-1) &&
+                                        arg0[i] == numeric_limits<T>::lowest()))
+                {
+                    return false;
+                }
+            }
+        }
+        runtime::reference::divide<T>(arg0, arg1, out0, element_count);
+        break;
+    }
+    case OP_TYPEID::Maximum:
+        runtime::reference::maximum<T>(arg0, arg1, out0, element_count);
+        break;
+    case OP_TYPEID::Minimum:
+        runtime::reference::minimum<T>(arg0, arg1, out0, element_count);
+        break;
+    case OP_TYPEID::Multiply:
+        runtime::reference::multiply<T>(arg0, arg1, out0, element_count);
+        break;
+    case OP_TYPEID::Or: runtime::reference::logical_or(arg0, arg1, out0, element_count); break;
+    case OP_TYPEID::Power: runtime::reference::power<T>(arg0, arg1, out0, element_count); break;
+    case OP_TYPEID::Subtract:
+        runtime::reference::subtract<T>(arg0, arg1, out0, element_count);
+        break;
+    case OP_TYPEID::Equal:
+        runtime::reference::equal<T>(arg0, arg1, static_cast<char*>(out), element_count);
+        break;
+    case OP_TYPEID::Greater:
+        runtime::reference::greater<T>(arg0, arg1, static_cast<char*>(out), element_count);
+        break;
+    case OP_TYPEID::GreaterEq:
+        runtime::reference::greater_eq<T>(arg0, arg1, static_cast<char*>(out), element_count);
+        break;
+    case OP_TYPEID::Less:
+        runtime::reference::less<T>(arg0, arg1, static_cast<char*>(out), element_count);
+        break;
+    case OP_TYPEID::LessEq:
+        runtime::reference::less_eq<T>(arg0, arg1, static_cast<char*>(out), element_count);
+        break;
+    case OP_TYPEID::NotEqual:
+        runtime::reference::not_equal<T>(arg0, arg1, static_cast<char*>(out), element_count);
+        break;
+    case OP_TYPEID::Select:
+        runtime::reference::select<T>(static_cast<const char*>(args[0]),
+                                      arg1,
+                                      static_cast<const T*>(args.at(2)),
+                                      out0,
+                                      element_count);
+        break;
+    case OP_TYPEID::ArgMax:
+    {
+        const op::ArgMax& argmax = static_cast<const op::ArgMax&>(node);
+        if (node.get_output_element_type(0) == element::i64)
+        {
+            runtime::reference::argmax<T, int64_t>(arg0,
+                                                   static_cast<int64_t*>(out),
+                                                   node.get_input_shape(0),
+                                                   node.get_output_shape(0),
+                                                   argmax.get_reduction_axis());
+        }
+        else if (node.get_output_element_type(0) == element::i32)
+        {
+            runtime::reference::argmax<T, int32_t>(arg0,
+                                                   static_cast<int32_t*>(out),
+                                                   node.get_input_shape(0),
+                                                   node.get_output_shape(0),
+                                                   argmax.get_reduction_axis());
+        }
+        else
+        {
+            return false;
+        }
+        break;
+    }
+    case OP_TYPEID::ArgMin:
+    {
+        const op::ArgMin& argmin = static_cast<const op::ArgMin&>(node);
+        if (node.get_output_element_type(0) == element::i64)
+        {
+            runtime::reference::argmin<T, int64_t>(arg0,
+                                                   static_cast<int64_t*>(out),
+                                                   node.get_input_shape(0),
+                                                   node.get_output_shape(0),
+                                                   argmin.get_reduction_axis());
+        }
+        else if (node.get_output_element_type(0) == element::i32)
+        {
+            runtime::reference::argmin<T, int32_t>(arg0,
+                                                   static_cast<int32_t*>(out),
+                                                   node.get_input_shape(0),
+                                                   node.get_output_shape(0),
+                                                   argmin.get_reduction_axis());
+        }
+        else
+        {
+            return false;
+        }
+        break;
+    }
+    case OP_TYPEID::Broadcast:
+    {
+        const op::Broadcast& broadcast = static_cast<const op::Broadcast&>(node);
+        runtime::reference::broadcast<T>(arg0,
+                                         out0,
+                                         node.get_input_shape(0),
+                                         node.get_output_shape(0),
+                                         broadcast.get_broadcast_axes());
+        break;
+    }
+    case OP_TYPEID::Concat:
+    {
+        vector<const T*> in_args;
+        vector<Shape> in_shapes;
+        for (size_t i = 0; i < node.get_input_size(); i++)
+        {
+            in_args.push_back(static_cast<const T*>(args[i]));
+            in_shapes.push_back(node.get_input_shape(i));
+        }
+        const op::Concat& concat = static_cast<const op::Concat&>(node);
+        runtime::reference::concat<T>(
+            in_args, out0, in_shapes, node.get_output_shape(0), concat.get_concatenation_axis());
+        break;
+    }
+    case OP_TYPEID::Convert:
+    {
+        element::Type out_type = node.get_output_element_type(0);
+        if (out_type == element::boolean)
+        {
+            runtime::reference::convert<T>(arg0, static_cast<char*>(out), element_count);
+        }
+        else if (out_type == element::f32)
+        {
+            runtime::reference::convert<T>(arg0, static_cast<float*>(out), element_count);
+        }
+        else if (out_type == element::f64)
+        {
+            runtime::reference::convert<T>(arg0, static_cast<double*>(out), element_count);
+        }
+        else if (out_type == element::i8)
+        {
+            runtime::reference::convert<T>(arg0, static_cast<int8_t*>(out), element_count);
+        }
+        else if (out_type == element::i16)
+        {
+            runtime::reference::convert<T>(arg0, static_cast<int16_t*>(out), element_count);
+        }
+        else if (out_type == element::i32)
+        {
+            runtime::reference::convert<T>(arg0, static_cast<int32_t*>(out), element_count);
+        }
+        else if (out_type == element::i64)
+        {
+            runtime::reference::convert<T>(arg0, static_cast<int64_t*>(out), element_count);
+        }
+        else if (out_type == element::u8)
+        {
+            runtime::reference::convert<T>(arg0, static_cast<uint8_t*>(out), element_count);
+        }
+        else if (out_type == element::u16)
+        {
+            runtime::reference::convert<T>(arg0, static_cast<uint16_t*>(out), element_count);
+        }
+        else if (out_type == element::u32)
+        {
+            runtime::reference::convert<T>(arg0, static_cast<uint32_t*>(out), element_count);
+        }
+        else if (out_type == element::u64)
+        {
+            runtime::reference::convert<T>(arg0, static_cast<uint64_t*>(out), element_count);
+        }
+        else
+        {
+            return false;
+        }
+        break;
+    }
+    case OP_TYPEID::Dot:
+        runtime::reference::dot(arg0,
+                                arg1,
+                                out0,
+                                node.get_input_shape(0),
+                                node.get_input_shape(1),
+                                node.get_output_shape(0),
+                                static_cast<const op::Dot&>(node).get_reduction_axes_count());
+        break;
+    case OP_TYPEID::Max:
+        runtime::reference::max<T>(arg0,
+                                   out0,
+                                   node.get_input_shape(0),
+                                   node.get_output_shape(0),
+                                   static_cast<const op::Max&>(node).get_reduction_axes());
+        break;
+    case OP_TYPEID::Min:
+        runtime::reference::min<T>(arg0,
+                                   out0,
+                                   node.get_input_shape(0),
+                                   node.get_output_shape(0),
+                                   static_cast<const op::Min&>(node).get_reduction_axes());
+        break;
+    case OP_TYPEID::OneHot:
+        runtime::reference::one_hot<T>(arg0,
+                                       out0,
+                                       node.get_input_shape(0),
+                                       node.get_output_shape(0),
+                                       static_cast<const op::OneHot&>(node).get_one_hot_axis());
+        break;
+    case OP_TYPEID::Pad:
+    {
+        const op::Pad& pad = static_cast<const op::Pad&>(node);
+        runtime::reference::pad(arg0,
+                                arg1,
+                                out0,
+                                node.get_input_shape(0),
+                                node.get_output_shape(0),
+                                pad.get_padding_below(),
+                                pad.get_padding_above(),
+                                pad.get_padding_interior());
+        break;
+    }
+    case OP_TYPEID::Product:
+        runtime::reference::product<T>(arg0,
+                                       out0,
+                                       node.get_input_shape(0),
+                                       node.get_output_shape(0),
+                                       static_cast<const op::Product&>(node).get_reduction_axes());
+        break;
+    case OP_TYPEID::ReplaceSlice:
+    {
+        const op::ReplaceSlice& slice = static_cast<const op::ReplaceSlice&>(node);
+        runtime::reference::replace_slice<T>(arg0,
+                                             arg1,
+                                             out0,
+                                             node.get_input_shape(1),
+                                             slice.get_lower_bounds(),
+                                             slice.get_upper_bounds(),
+                                             slice.get_strides(),
+                                             node.get_output_shape(0));
+        break;
+    }
+    case OP_TYPEID::Reshape:
+        runtime::reference::reshape(arg0,
+                                    out0,
+                                    node.get_input_shape(0),
+                                    static_cast<const op::Reshape&>(node).get_input_order(),
+                                    node.get_output_shape(0));
+        break;
+    case OP_TYPEID::Reverse:
+        runtime::reference::reverse(arg0,
+                                    out0,
+                                    node.get_input_shape(0),
+                                    node.get_output_shape(0),
+                                    static_cast<const op::Reverse&>(node).get_reversed_axes());
+        break;
+    case OP_TYPEID::ReverseSequence:
+    {
+        if (node.get_input_element_type(1) != element::i32)
+        {
+            return false;
+        }
+        const op::ReverseSequence& reverse = static_cast<const op::ReverseSequence&>(node);
+        runtime::reference::reverse_sequence<T, int32_t>(arg0,
+                                                         out0,
+                                                         node.get_input_shape(0),
+                                                         reverse.get_batch_axis(),
+                                                         reverse.get_sequence_axis(),
+                                                         static_cast<const int32_t*>(args[1]));
+        break;
+    }
+    case OP_TYPEID::Slice:
+    {
+        const op::Slice& slice = static_cast<const op::Slice&>(node);
+        runtime::reference::slice<T>(arg0,
+                                     out0,
+                                     node.get_input_shape(0),
+                                     slice.get_lower_bounds(),
+                                     slice.get_upper_bounds(),
+                                     slice.get_strides(),
+                                     node.get_output_shape(0));
+        break;
+    }
+    case OP_TYPEID::Softmax:
+        runtime::reference::softmax<T>(arg0,
+                                       out0,
+                                       node.get_output_shape(0),
+                                       static_cast<const op::Softmax&>(node).get_axes());
+        break;
+    case OP_TYPEID::Sum:
+        runtime::reference::sum<T>(arg0,
+                                   out0,
+                                   node.get_input_shape(0),
+                                   node.get_output_shape(0),
+                                   static_cast<const op::Sum&>(node).get_reduction_axes());
+        break;
+    // Ops that call functions, draw random numbers, have several outputs or are handled by
+    // the matchers above are not evaluated here
+    default: return false;
+    }
+#pragma GCC diagnostic pop
+    return true;
+}
+
+static bool evaluate(OP_TYPEID type_id,
+                     const Node& node,
+                     const element::Type& type,
+                     const vector<const void*>& args,
+                     void* out)
+{
+    if (type == element::boolean)
+    {
+        return evaluate<char>(type_id, node, args, out);
+    }
+    else if (type == element::f32)
+    {
+        return evaluate<float>(type_id, node, args, out);
+    }
+    else if (type == element::f64)
+    {
+        return evaluate<double>(type_id, node, args, out);
+    }
+    else if (type == element::i8)
+    {
+        return evaluate<int8_t>(type_id, node, args, out);
+    }
+    else if (type == element::i16)
+    {
+        return evaluate<int16_t>(type_id, node, args, out);
+    }
+    else if (type == element::i32)
+    {
+        return evaluate<int32_t>(type_id, node, args, out);
+    }
+    else if (type == element::i64)
+    {
+        return evaluate<int64_t>(type_id, node, args, out);
+    }
+    else if (type == element::u8)
+    {
+        return evaluate<uint8_t>(type_id, node, args, out);
+    }
+    else if (type == element::u16)
+    {
+        return evaluate<uint16_t>(type_id, node, args, out);
+    }
+    else if (type == element::u32)
+    {
+        return evaluate<uint32_t>(type_id, node, args, out);
+    }
+    else if (type == element::u64)
+    {
+        return evaluate<uint64_t>(type_id, node, args, out);
+    }
+    return false;
+}
+
+static bool get_op_typeid(const Node& node, OP_TYPEID& type_id)
+{
+// This expands the op list in op_tbl.hpp into a list of entries that look like this:
+// {TI(ngraph::op::Abs), OP_TYPEID::Abs},
+// {TI(ngraph::op::Acos), OP_TYPEID::Acos},
+// ...
+// Keying on the class rather than description() keeps backend ops that share a name with a
+// core op from being evaluated as the core op.
+#define NGRAPH_OP(a, b) {type_index(typeid(b::a)), OP_TYPEID::a},
+    static const unordered_map<type_index, OP_TYPEID> typeid_map{
+#include "ngraph/op/op_tbl.hpp"
+    };
+#undef NGRAPH_OP
+
+    auto it = typeid_map.find(type_index(typeid(node)));
+    if (it == typeid_map.end())
+    {
+        return false;
+    }
+    type_id = it->second;
+    return true;
+}
+
+void ngraph::pass::ConstantFolding::construct_constant_evaluate()
+{
+    auto all_constant_args = [](shared_ptr<Node> n) {
+        if (n->get_input_size() == 0 || n->get_output_size() != 1)
+        {
+            return false;
+        }
+        for (auto& input : n->get_inputs())
+        {
+            // Constants that are still waiting for their type, like ScalarConstantLike,
+            // have no data to fold yet
+            const Node& arg = *input.get_output().get_node();
+            if (typeid(arg) != typeid(op::Constant))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto root = make_shared<pattern::op::Label>(element::f32, Shape{}, all_constant_args);
+
+    size_t max_folded_bytes = m_max_folded_bytes;
+    auto constant_evaluate_callback = [max_folded_bytes](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for constant_evaluate_callback against node = "
+                     << m.get_match_root()->get_name();
+
+        auto node = m.get_match_root();
+        OP_TYPEID type_id;
+        if (!get_op_typeid(*node, type_id))
+        {
+            return false;
+        }
+
+        const element::Type& out_type = node->get_output_element_type(0);
+        const Shape& out_shape = node->get_output_shape(0);
+        if (shape_size(out_shape) * out_type.size() > max_folded_bytes)
+        {
+            return false;
+        }
+
+        vector<const void*> args;
+        for (auto arg : node->get_arguments())
+        {
+            args.push_back(static_pointer_cast<op::Constant>(arg)->get_data_ptr());
+        }
+
+        // The kernel runs on the type the op computes in, which for conversions and
+        // comparisons is not the type it produces, like the INTERPRETER's dispatch
+        element::Type type = out_type;
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+        switch (type_id)
+        {
+        case OP_TYPEID::ArgMax:
+        case OP_TYPEID::ArgMin:
+        case OP_TYPEID::Convert: type = node->get_input_element_type(0); break;
+        case OP_TYPEID::Equal:
+        case OP_TYPEID::Greater:
+        case OP_TYPEID::GreaterEq:
+        case OP_TYPEID::Less:
+        case OP_TYPEID::LessEq:
+        case OP_TYPEID::NotEqual: type = node->get_input_element_type(1); break;
+        default: break;
+        }
+#pragma GCC diagnostic pop
+
+        vector<char> data(shape_size(out_shape) * out_type.size());
+        try
+        {
+            if (!evaluate(type_id, *node, type, args, data.data()))
+            {
+                return false;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            // e.g. an out-of-range OneHot index or a failed allocation in a kernel; the op
+            // reports it when it runs
+            NGRAPH_DEBUG << "Not folding " << node->get_name() << ": " << e.what();
+            return false;
+        }
+
+        replace_node(node, make_shared<op::Constant>(out_type, out_shape, data.data()));
+        return true;
+    };
+
+    auto evaluate_matcher = make_shared<pattern::Matcher>(root, constant_evaluate_callback);
+    this->add_matcher(evaluate_matcher);
+}
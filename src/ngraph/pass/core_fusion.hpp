@@ -30,7 +30,7 @@ class ngraph::pass::CoreFusion : public ngraph::pass::GraphRewrite
 {
 public:
     CoreFusion()
-        : GraphRewrite()
+        : GraphRewrite(true)
     {
         construct_relu();
         construct_folded_batch_norm();
@@ -15,163 +15,20 @@
 //*****************************************************************************
 
 #include <memory>
-#include <set>
 #include <typeinfo>
 #include <unordered_map>
 
 #include "cse.hpp"
-#include "ngraph/axis_vector.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
-#include "ngraph/op/abs.hpp"
-#include "ngraph/op/abs.hpp"
-#include "ngraph/op/acos.hpp"
-#include "ngraph/op/add.hpp"
-#include "ngraph/op/asin.hpp"
-#include "ngraph/op/atan.hpp"
-#include "ngraph/op/broadcast.hpp"
-#include "ngraph/op/ceiling.hpp"
-#include "ngraph/op/constant.hpp"
-#include "ngraph/op/cos.hpp"
-#include "ngraph/op/cosh.hpp"
-#include "ngraph/op/divide.hpp"
-#include "ngraph/op/exp.hpp"
-#include "ngraph/op/floor.hpp"
-#include "ngraph/op/log.hpp"
-#include "ngraph/op/maximum.hpp"
-#include "ngraph/op/minimum.hpp"
-#include "ngraph/op/multiply.hpp"
-#include "ngraph/op/multiply.hpp"
-#include "ngraph/op/negative.hpp"
-#include "ngraph/op/power.hpp"
-#include "ngraph/op/product.hpp"
-#include "ngraph/op/relu.hpp"
-#include "ngraph/op/reshape.hpp"
-#include "ngraph/op/sigmoid.hpp"
-#include "ngraph/op/sign.hpp"
-#include "ngraph/op/sin.hpp"
-#include "ngraph/op/sinh.hpp"
-#include "ngraph/op/softmax.hpp"
-#include "ngraph/op/sqrt.hpp"
-#include "ngraph/op/subtract.hpp"
-#include "ngraph/op/sum.hpp"
-#include "ngraph/op/tan.hpp"
-#include "ngraph/op/tanh.hpp"
-#include "ngraph/pattern/matcher.hpp"
 
 using namespace ngraph;
 
 #define TI(x) std::type_index(typeid(x))
 
-static bool cse_constant(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
-{
-    NGRAPH_DEBUG << "In cse_constant for " << a->get_name() << " and " << b->get_name();
-
-    if (a->get_shape() != b->get_shape() || a->get_element_type() != b->get_element_type())
-    {
-        return false;
-    }
-
-    auto ca = std::static_pointer_cast<op::Constant>(a);
-    auto cb = std::static_pointer_cast<op::Constant>(b);
-
-    size_t size = shape_size(a->get_shape()) * a->get_element_type().size();
-
-    return !memcmp(ca->get_data_ptr(), cb->get_data_ptr(), size);
-}
-
-static bool cse_reshape(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
-{
-    NGRAPH_DEBUG << "In cse_reshape for " << a->get_name() << " and " << b->get_name();
-
-    auto reshape_a = std::static_pointer_cast<ngraph::op::Reshape>(a);
-    auto reshape_b = std::static_pointer_cast<ngraph::op::Reshape>(b);
-
-    return (a->get_argument(0) == b->get_argument(0)) &&
-           (reshape_a->get_input_order() == reshape_b->get_input_order()) &&
-           (reshape_a->get_output_shape() == reshape_b->get_output_shape());
-}
-static bool cse_broadcast(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
-{
-    NGRAPH_DEBUG << "In cse_broadcast for " << a->get_name() << " and " << b->get_name();
-
-    auto broadcast_a = std::static_pointer_cast<ngraph::op::Broadcast>(a);
-    auto broadcast_b = std::static_pointer_cast<ngraph::op::Broadcast>(b);
-
-    return (a->get_argument(0) == b->get_argument(0)) &&
-           (broadcast_a->get_broadcast_axes() == broadcast_b->get_broadcast_axes()) &&
-           (broadcast_a->get_broadcast_shape() == broadcast_b->get_broadcast_shape());
-}
-static bool cse_unarywise(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
-{
-    NGRAPH_DEBUG << "In cse_unarywise for " << a->get_name() << " and " << b->get_name();
-
-    return a->get_argument(0) == b->get_argument(0);
-}
-
-static bool cse_binarywise(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
-{
-    NGRAPH_DEBUG << "In cse_binary for " << a->get_name() << " and " << b->get_name();
-
-    return (a->get_argument(0) == b->get_argument(0) && a->get_argument(1) == b->get_argument(1)) ||
-           (a->get_argument(1) == b->get_argument(0) && a->get_argument(0) == b->get_argument(1));
-}
-
-static bool cse_reduction(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
-{
-    NGRAPH_DEBUG << "In cse_reduction for " << a->get_name() << " and " << b->get_name();
-
-    auto ar_a = std::static_pointer_cast<op::util::ArithmeticReduction>(a);
-    auto ar_b = std::static_pointer_cast<op::util::ArithmeticReduction>(b);
-
-    return ar_a->get_argument(0) == ar_b->get_argument(0) &&
-           ar_a->get_reduction_axes() == ar_b->get_reduction_axes();
-}
-
-static std::unordered_map<std::type_index,
-                          std::function<bool(std::shared_ptr<Node>, std::shared_ptr<Node>)>>
-    initialize_ops_to_cse_handlers()
-{
-    return std::unordered_map<std::type_index,
-                              std::function<bool(std::shared_ptr<Node>, std::shared_ptr<Node>)>>(
-        {{TI(op::Abs), cse_unarywise},
-         {TI(op::Acos), cse_unarywise},
-         {TI(op::Asin), cse_unarywise},
-         {TI(op::Atan), cse_unarywise},
-         {TI(op::Ceiling), cse_unarywise},
-         {TI(op::Constant), cse_constant},
-         {TI(op::Cos), cse_unarywise},
-         {TI(op::Cosh), cse_unarywise},
-         {TI(op::Exp), cse_unarywise},
-         {TI(op::Floor), cse_unarywise},
-         {TI(op::Log), cse_unarywise},
-         {TI(op::Negative), cse_unarywise},
-         {TI(op::Relu), cse_unarywise},
-         {TI(op::Sigmoid), cse_unarywise},
-         {TI(op::Sign), cse_unarywise},
-         {TI(op::Sin), cse_unarywise},
-         {TI(op::Sinh), cse_unarywise},
-         //{TI(op::Softmax), cse_unarywise},
-         {TI(op::Sqrt), cse_unarywise},
-         {TI(op::Tan), cse_unarywise},
-         {TI(op::Tanh), cse_unarywise},
-         {TI(op::Add), cse_binarywise},
-         {TI(op::Divide), cse_binarywise},
-         {TI(op::Maximum), cse_binarywise},
-         {TI(op::Minimum), cse_binarywise},
-         {TI(op::Multiply), cse_binarywise},
-         {TI(op::Power), cse_binarywise},
-         {TI(op::Subtract), cse_binarywise},
-         {TI(op::Sum), cse_reduction},
-         {TI(op::Product), cse_reduction},
-         {TI(op::Reshape), cse_reshape},
-         {TI(op::Broadcast), cse_broadcast}});
-}
-
-static std::unordered_map<std::type_index,
-                          std::function<bool(std::shared_ptr<Node>, std::shared_ptr<Node>)>>
-    ops_to_cse_handlers = initialize_ops_to_cse_handlers();
-
+// Two nodes are the same expression when they are structurally equal: same op type, same
+// attributes and the same producer outputs (in any order for commutative ops). Backend ops
+// that do not describe their attributes can still be matched through a backend handler.
 class NodeKey
 {
 public:
@@ -195,23 +52,13 @@ public:
             return false;
         }
 
+        auto eh = m_backend_handlers.find(TI(p_this));
+        if (eh != m_backend_handlers.end())
         {
-            auto eh = ops_to_cse_handlers.find(TI(p_this));
-            if (eh != ops_to_cse_handlers.end())
-            {
-                return eh->second(m_node, other.get_node());
-            }
-        }
-
-        {
-            auto eh = m_backend_handlers.find(TI(p_this));
-            if (eh != m_backend_handlers.end())
-            {
-                return eh->second(m_node, other.get_node());
-            }
+            return eh->second(m_node, other.get_node());
         }
 
-        return false;
+        return p_this.is_structurally_equal(p_other);
     }
 
 private:
@@ -228,32 +75,7 @@ namespace std
     {
         std::size_t operator()(const NodeKey& k) const
         {
-            Node& p_this = *k.get_node().get();
-            auto ti = TI(p_this);
-
-            std::hash<std::type_index> type_hash_compute{};
-            auto type_hash = type_hash_compute(ti);
-
-            std::vector<size_t> arg_ids;
-
-            arg_ids.push_back(type_hash);
-
-            auto cargs = k.get_node()->get_arguments();
-
-            // TODO: Do we need another map, so we could
-            // specify how to compute hash for each op?
-            if (p_this.is_commutative())
-            {
-                std::sort(begin(cargs), end(cargs));
-            }
-
-            for (auto arg : cargs)
-            {
-                arg_ids.push_back(arg->get_instance_id());
-            }
-
-            auto hashc = ngraph::hash_combine(arg_ids);
-            return hashc;
+            return k.get_node()->get_structural_hash();
         }
     };
 }
@@ -272,9 +94,12 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(
         }
 
         NodeKey n_key(n, m_backend_cse_handlers);
-        if (expressions.count(n_key))
+        auto it = expressions.find(n_key);
+        if (it != expressions.end())
         {
-            ngraph::replace_node(n, expressions.at(n_key));
+            NGRAPH_DEBUG << "CSE replacing " << n->get_name() << " with "
+                         << it->second->get_name();
+            ngraph::replace_node(n, it->second);
             replaced = true;
         }
         else
@@ -48,4 +48,5 @@ public:
         m_backend_cse_handlers;
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
+    bool is_function_parallel() const override { return true; }
 };
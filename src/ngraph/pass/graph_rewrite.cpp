@@ -15,12 +15,18 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <deque>
 #include <iostream>
+#include <typeindex>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "graph_rewrite.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
 
 // GraphRewrite algorithm:
 // GraphRewrite processes an input graph in an topological order(i.e. args before users)
@@ -41,6 +47,10 @@
 // This gives Matchers a nice cascading property. For example, if m1 folds `Abs2(Constant1)`
 // and `m2` folds `Neg3(Constant1)` when `m3` is called on `Add4` it will discover that
 // both `Abs2` and `Neg3` were already replaced by constants, so `Add4` will also be folded into one.
+// Matchers are only tried on ops of the type their pattern is rooted at, unless it is rooted
+// at a Label, Skip or Any. If the pass is constructed with cascade set, the ops a matcher
+// creates are matched right away, before the rest of the graph, so a fusion can be fused again
+// in the same pass. Otherwise only the ops of the original graph are visited.
 // If any Matcher succeeds the rest of the matchers will **not** be called.
 // E.g. if `m1` succeeds and replaces `Abs2` with a new constant, nor `m2` or `m3` will be called
 // However, sometimes, you will need more than one fusion occur on the same node.
@@ -65,19 +75,88 @@ bool ngraph::pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Functio
         rewritten = false;
         std::vector<std::shared_ptr<pattern::Matcher>> matchers{m_matchers};
         m_matchers.clear();
+
+        // A pattern rooted at an op only matches ops of the same type; one rooted at a Label,
+        // Skip or Any can match any op
+        std::unordered_map<std::type_index, std::vector<size_t>> typed_matchers;
+        std::vector<size_t> untyped_matchers;
+        for (size_t i = 0; i < matchers.size(); i++)
+        {
+            auto pattern = matchers[i]->get_pattern();
+            if (std::dynamic_pointer_cast<pattern::op::Pattern>(pattern))
+            {
+                untyped_matchers.push_back(i);
+            }
+            else
+            {
+                typed_matchers[std::type_index(typeid(*pattern))].push_back(i);
+            }
+        }
+
+        // Ops are visited in topological order. When cascading, the ops a rewrite creates are
+        // visited next, before the users of the op they replace, so that rewrites of rewritten
+        // ops happen without another sweep. The cascade is cut off after NUM_TRIES generations.
+        std::deque<std::pair<std::shared_ptr<Node>, size_t>> worklist;
+        std::unordered_set<std::shared_ptr<Node>> known_nodes;
         for (auto node : f->get_ordered_ops())
         {
-            for (auto matcher : matchers)
+            worklist.push_back({node, 0});
+            known_nodes.insert(node);
+        }
+        std::vector<size_t> candidates;
+        while (!worklist.empty())
+        {
+            auto node = worklist.front().first;
+            size_t generation = worklist.front().second;
+            worklist.pop_front();
+
+            // Candidate matchers in the order they were added
+            candidates = untyped_matchers;
+            auto typed = typed_matchers.find(std::type_index(typeid(*node)));
+            if (typed != typed_matchers.end())
+            {
+                candidates.insert(candidates.end(), typed->second.begin(), typed->second.end());
+                std::inplace_merge(candidates.begin(),
+                                   candidates.begin() + untyped_matchers.size(),
+                                   candidates.end());
+            }
+
+            for (size_t i : candidates)
             {
+                auto matcher = matchers[i];
                 NGRAPH_DEBUG << "Running matcher " << matcher->get_name() << "("
                              << matcher->get_pattern()->get_name() << ") on " << node->get_name();
                 if (matcher->match(node))
                 {
                     NGRAPH_DEBUG << "Matcher " << matcher << matcher->get_name() << " matched "
                                  << node->get_name();
+                    auto users = node->get_users();
                     if (matcher->process_match())
                     {
                         rewritten = true;
+                        if (m_cascade && generation < NUM_TRIES)
+                        {
+                            NodeVector new_nodes;
+                            std::deque<std::shared_ptr<Node>> stack(users.begin(), users.end());
+                            while (!stack.empty())
+                            {
+                                auto user = stack.front();
+                                stack.pop_front();
+                                for (auto arg : user->get_arguments())
+                                {
+                                    if (known_nodes.insert(arg).second)
+                                    {
+                                        new_nodes.push_back(arg);
+                                        stack.push_back(arg);
+                                    }
+                                }
+                            }
+                            auto sorted = subgraph_topological_sort(new_nodes);
+                            for (auto it = sorted.rbegin(); it != sorted.rend(); ++it)
+                            {
+                                worklist.push_front({*it, generation + 1});
+                            }
+                        }
                         break;
                     }
                 }
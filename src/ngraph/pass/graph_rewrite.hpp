@@ -43,12 +43,14 @@ namespace ngraph
 /// the existing ops by providing a callback to \p Matcher object
 /// Patterns can be added by using \sa add_matcher
 /// Callbacks should use \sa replace_node to transform matched sub graphs
+/// If \p cascade is set, the ops a rewrite creates are matched again in the same pass
 
 class ngraph::pass::GraphRewrite : public FunctionPass
 {
 public:
-    GraphRewrite()
+    GraphRewrite(bool cascade = false)
         : FunctionPass()
+        , m_cascade(cascade)
     {
     }
 
@@ -56,6 +58,7 @@ public:
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
 private:
+    bool m_cascade;
     // enable cascading rewrites
     std::vector<std::shared_ptr<pattern::Matcher>> m_matchers;
 };
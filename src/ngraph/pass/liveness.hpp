@@ -31,4 +31,5 @@ class ngraph::pass::Liveness : public FunctionPass
 {
 public:
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+    bool is_function_parallel() const override { return true; }
 };
@@ -15,6 +15,8 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #ifdef WIN32
 #else
 #include <cxxabi.h>
@@ -22,6 +24,9 @@
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -37,6 +42,99 @@
 using namespace std;
 using namespace ngraph;
 
+// Threads that each run a job handed to the pool, then wait for the next one
+class ngraph::pass::Manager::ThreadPool
+{
+public:
+    ThreadPool(size_t thread_count)
+    {
+        for (size_t i = 0; i < thread_count; i++)
+        {
+            m_threads.emplace_back([this]() { work(); });
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_job_ready.notify_all();
+        for (thread& t : m_threads)
+        {
+            t.join();
+        }
+    }
+
+    size_t size() const { return m_threads.size(); }
+    /// \brief Runs job on every pool thread and on the calling thread, and returns once all of
+    ///     them are done. job must not throw.
+    void run(const function<void()>& job)
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_job = &job;
+        m_pending = m_threads.size();
+        m_job_id++;
+        m_job_ready.notify_all();
+        lock.unlock();
+        job();
+        lock.lock();
+        m_job_done.wait(lock, [this]() { return m_pending == 0; });
+        m_job = nullptr;
+    }
+
+private:
+    void work()
+    {
+        size_t job_id = 0;
+        unique_lock<mutex> lock(m_mutex);
+        while (true)
+        {
+            m_job_ready.wait(lock, [&]() { return m_stop || m_job_id != job_id; });
+            if (m_stop)
+            {
+                return;
+            }
+            job_id = m_job_id;
+            const function<void()>* job = m_job;
+            lock.unlock();
+            (*job)();
+            lock.lock();
+            if (--m_pending == 0)
+            {
+                m_job_done.notify_one();
+            }
+        }
+    }
+
+    vector<thread> m_threads;
+    mutex m_mutex;
+    condition_variable m_job_ready;
+    condition_variable m_job_done;
+    const function<void()>* m_job = nullptr;
+    size_t m_job_id = 0;
+    size_t m_pending = 0;
+    bool m_stop = false;
+};
+
+// A pass rewriting a node reachable from two functions would race with itself
+static bool functions_share_nodes(const vector<shared_ptr<Function>>& fs)
+{
+    unordered_set<Node*> nodes;
+    for (shared_ptr<Function> f : fs)
+    {
+        for (shared_ptr<Node> node : f->get_ops())
+        {
+            if (!nodes.insert(node.get()).second)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 ngraph::pass::Manager::Manager()
 {
     static const auto nevt = std::getenv("NGRAPH_ENABLE_VISUALIZE_TRACING");
@@ -49,6 +147,15 @@ ngraph::pass::Manager::Manager()
     {
         m_serialize = true;
     }
+    static const auto npt = std::getenv("NGRAPH_PASS_THREADS");
+    if (npt)
+    {
+        m_function_pass_threads = std::max(std::atoi(npt), 1);
+    }
+    else
+    {
+        m_function_pass_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
 }
 
 ngraph::pass::Manager::~Manager()
@@ -60,6 +167,11 @@ void ngraph::pass::Manager::initialize_default_passes()
 }
 
 void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
+{
+    run_passes(vector<shared_ptr<Function>>{func}, transitive);
+}
+
+void ngraph::pass::Manager::run_passes(const vector<shared_ptr<Function>>& funcs, bool transitive)
 {
     bool profile_enabled = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
 
@@ -67,11 +179,20 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
     if (transitive)
     {
         // find all functions
-        traverse_functions(func, [&](shared_ptr<Function> f) { fs.push_back(f); });
+        set<shared_ptr<Function>> found;
+        for (auto func : funcs)
+        {
+            traverse_functions(func, [&](shared_ptr<Function> f) {
+                if (found.insert(f).second)
+                {
+                    fs.push_back(f);
+                }
+            });
+        }
     }
     else
     {
-        fs = {func};
+        fs = funcs;
     }
     set<shared_ptr<Function>> tfs(begin(fs), end(fs));
     get_state().set_functions(tfs);
@@ -83,6 +204,7 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
         pass_timer.start();
+        size_t graph_version = Node::get_graph_version();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
         auto function_pass = dynamic_pointer_cast<FunctionPass>(pass);
@@ -98,10 +220,7 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
         }
         else if (function_pass)
         {
-            for (shared_ptr<Function> f : fs)
-            {
-                function_pass->run_on_function(f);
-            }
+            run_function_pass(function_pass, fs);
         }
         else if (node_pass)
         {
@@ -121,10 +240,14 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
             }
         }
 
-        // Better to do this in node replacement but this will do for now
-        for (auto f : fs)
+        // Only the nodes whose inputs the pass replaced, and those downstream of them, can
+        // have changed types
+        if (Node::get_graph_version() != graph_version)
         {
-            f->validate_nodes_and_infer_types();
+            for (auto f : fs)
+            {
+                f->validate_nodes_and_infer_types(graph_version);
+            }
         }
 
         if (m_visualize || m_serialize)
@@ -169,6 +292,53 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
     }
 }
 
+void ngraph::pass::Manager::run_function_pass(shared_ptr<FunctionPass> function_pass,
+                                              const vector<shared_ptr<Function>>& fs)
+{
+    size_t thread_count = min(m_function_pass_threads, fs.size());
+    if (thread_count <= 1 || !function_pass->is_function_parallel() ||
+        functions_share_nodes(fs))
+    {
+        for (shared_ptr<Function> f : fs)
+        {
+            function_pass->run_on_function(f);
+        }
+        return;
+    }
+
+    // Each function is an independent graph, so workers just claim the next one in line
+    atomic<size_t> next(0);
+    exception_ptr error;
+    mutex error_mutex;
+    auto worker = [&]() {
+        for (size_t i = next++; i < fs.size(); i = next++)
+        {
+            try
+            {
+                function_pass->run_on_function(fs[i]);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> lock(error_mutex);
+                if (!error)
+                {
+                    error = current_exception();
+                }
+                next = fs.size();
+            }
+        }
+    };
+    if (!m_thread_pool || m_thread_pool->size() != m_function_pass_threads - 1)
+    {
+        m_thread_pool.reset(new ThreadPool(m_function_pass_threads - 1));
+    }
+    m_thread_pool->run(worker);
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+}
+
 ngraph::pass::ManagerState& ngraph::pass::Manager::get_state()
 {
     return m_state;
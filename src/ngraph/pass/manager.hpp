@@ -55,14 +55,29 @@ public:
     }
 
     void run_passes(std::shared_ptr<Function>, bool transitive = true);
+    /// \brief Runs the passes over several independent functions, such as the models of a
+    ///     deployment, so that parallel function passes can spread them across threads
+    void run_passes(const std::vector<std::shared_ptr<Function>>& funcs, bool transitive = true);
 
     ManagerState& get_state();
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
+    /// \brief Sets how many threads run a FunctionPass that is_function_parallel() over the
+    ///     functions being compiled; 1 runs every pass serially. Functions that share nodes
+    ///     are always run serially.
+    void set_function_pass_threads(size_t threads) { m_function_pass_threads = threads; }
 private:
+    class ThreadPool;
+
+    void run_function_pass(std::shared_ptr<FunctionPass> function_pass,
+                           const std::vector<std::shared_ptr<Function>>& fs);
+
     std::vector<std::string> m_pass_names;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     ManagerState m_state;
     bool m_visualize = false;
     bool m_serialize = false;
+    size_t m_function_pass_threads = 1;
+    // Started by the first parallel pass and kept for the passes and runs that follow
+    std::unique_ptr<ThreadPool> m_thread_pool;
 };
@@ -21,6 +21,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/pass/manager_state.hpp"
+#include "ngraph/runtime/cost_model.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -29,3 +30,12 @@ const vector<shared_ptr<Function>>& ngraph::pass::ManagerState::get_functions()
 {
     return m_function_list;
 }
+
+shared_ptr<runtime::CostModel> ngraph::pass::ManagerState::get_cost_model()
+{
+    if (!m_cost_model)
+    {
+        m_cost_model = make_shared<runtime::CostModel>();
+    }
+    return m_cost_model;
+}
@@ -36,6 +36,10 @@ namespace ngraph
     {
         class ManagerState;
     }
+    namespace runtime
+    {
+        class CostModel;
+    }
 }
 
 class ngraph::pass::ManagerState
@@ -60,7 +64,19 @@ public:
         return m_visualize_tree_ops_map;
     }
 
+    /// \brief Sets the cost model passes and backends consult to compare alternatives,
+    ///     normally runtime::CostModel::get_default for the backend being compiled for
+    void set_cost_model(const std::shared_ptr<runtime::CostModel>& cost_model)
+    {
+        m_cost_model = cost_model;
+    }
+
+    /// \returns The cost model set by the backend, or one with default coefficients if the
+    ///     backend set none
+    std::shared_ptr<runtime::CostModel> get_cost_model();
+
 private:
     std::vector<std::shared_ptr<Function>> m_function_list;
     visualize_tree_ops_map_t m_visualize_tree_ops_map;
+    std::shared_ptr<runtime::CostModel> m_cost_model;
 };
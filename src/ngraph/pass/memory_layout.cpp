@@ -14,10 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
+#include <map>
 #include <sstream>
+#include <unordered_map>
 
-#include "ngraph/log.hpp"
+#include "ngraph/function.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/slice.hpp"
@@ -29,43 +32,128 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 bool offline_packing,
+                                 bool nest_function_pools)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_offline_packing(offline_packing && !disable_memory_sharing)
+    , m_nest_function_pools(nest_function_pools)
+    , m_lower_bound(0)
+    , m_in_place_bytes(0)
+    , m_view_bytes(0)
 {
 }
 
 bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
 {
     MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    // Lifetimes of all buffers; tensors computed in place share their input's buffer
+    MemoryPacker packer(m_alignment);
+    m_in_place_bytes = 0;
+    m_view_bytes = 0;
+    // The buffer of each tensor and the tensor's offset in it
+    unordered_map<descriptor::Tensor*, pair<size_t, size_t>> tensor_buffers;
+    // Offsets of the buffers placed first fit
+    unordered_map<size_t, size_t> buffer_offsets;
+    unordered_map<Node*, size_t> nested_buffers;
+
+    // Inputs computed directly into a consumer's output, which is allocated as soon as the
+    // first of them is
+    unordered_map<descriptor::Tensor*, pair<descriptor::Tensor*, size_t>> input_views;
+    if (!m_disable_memory_sharing)
+    {
+        for (shared_ptr<Node> node : function->get_ordered_ops())
+        {
+            auto op = std::dynamic_pointer_cast<op::Op>(node);
+            auto op_annotations = op ? op->get_op_annotations() : nullptr;
+            if (!op_annotations)
+            {
+                continue;
+            }
+            for (auto view : op_annotations->get_input_views())
+            {
+                auto output = &node->get_outputs().at(view.output).get_tensor();
+                auto input = &node->get_inputs().at(view.input).get_tensor();
+                if (node->liveness_free_list.count(input) != 0 &&
+                    node->liveness_new_list.count(output) != 0)
+                {
+                    input_views.insert({input, {output, view.offset}});
+                }
+            }
+        }
+    }
+
+    size_t step = 0;
+    auto add_buffer = [&](descriptor::Tensor* tensor, size_t size) {
+        size_t buffer = packer.add_buffer(size, step);
+        tensor_buffers[tensor] = {buffer, 0};
+        if (!m_offline_packing)
+        {
+            buffer_offsets[buffer] = mm.allocate(size);
+            tensor->set_pool_offset(buffer_offsets[buffer]);
+        }
+    };
+    auto share_buffer = [&](descriptor::Tensor* tensor, descriptor::Tensor* host, size_t offset) {
+        const pair<size_t, size_t>& host_buffer = tensor_buffers.at(host);
+        tensor_buffers[tensor] = {host_buffer.first, host_buffer.second + offset};
+        packer.extend_buffer(host_buffer.first, step);
+        tensor->set_pool_offset(host->get_pool_offset() + offset);
+    };
+
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
-        std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
+        // Outputs placed in the buffer of an input, at an offset
+        std::map<descriptor::Tensor*, pair<descriptor::Tensor*, size_t>> in_place_outputs;
         std::set<const descriptor::Tensor*> reused_inputs;
 
         if (auto op = std::dynamic_pointer_cast<op::Op>(node))
         {
-            // concat and slice in_place_oi should be treated differently
-            if (!std::dynamic_pointer_cast<op::Concat>(node) &&
-                !std::dynamic_pointer_cast<op::Slice>(node))
+            if (auto op_annotations = op->get_op_annotations())
             {
-                if (auto op_annotations = op->get_op_annotations())
+                // concat and slice in_place_oi should be treated differently
+                if (!std::dynamic_pointer_cast<op::Concat>(node) &&
+                    !std::dynamic_pointer_cast<op::Slice>(node))
                 {
                     for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
                     {
                         auto output = &node->get_outputs().at(oi_pair.output).get_tensor();
                         auto input = &node->get_inputs().at(oi_pair.input).get_tensor();
-                        auto input_node =
-                            node->get_inputs().at(oi_pair.input).get_output().get_node();
 
                         // For destructive kernel, this should be the last use
                         // Non-destructive kernels can pass through if memory sharing is disabled
                         if ((node->liveness_free_list.count(input) != 0 ||
                              (m_disable_memory_sharing && !oi_pair.destructive)) &&
-                            node->liveness_new_list.count(output) != 0)
+                            node->liveness_new_list.count(output) != 0 &&
+                            input_views.count(input) == 0)
+                        {
+                            in_place_outputs.insert({output, {input, 0}});
+                            reused_inputs.insert(input);
+                            if (oi_pair.destructive)
+                            {
+                                m_in_place_bytes += output->size();
+                            }
+                            else
+                            {
+                                m_view_bytes += output->size();
+                            }
+                        }
+                    }
+                }
+                if (!m_disable_memory_sharing)
+                {
+                    for (auto view : op_annotations->get_output_views())
+                    {
+                        auto output = &node->get_outputs().at(view.output).get_tensor();
+                        auto input = &node->get_inputs().at(view.input).get_tensor();
+                        if (node->liveness_free_list.count(input) != 0 &&
+                            node->liveness_new_list.count(output) != 0 &&
+                            input_views.count(input) == 0 && in_place_outputs.count(output) == 0)
                         {
-                            in_place_outputs.insert({output, input});
+                            in_place_outputs.insert({output, {input, view.offset}});
                             reused_inputs.insert(input);
+                            m_view_bytes += output->size();
                         }
                     }
                 }
@@ -74,24 +162,110 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
 
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
-            size_t offset = in_place_outputs.count(tensor)
-                                ? in_place_outputs.at(tensor)->get_pool_offset()
-                                : mm.allocate(tensor->size());
-            tensor->set_pool_offset(offset);
+            if (in_place_outputs.count(tensor))
+            {
+                descriptor::Tensor* input = in_place_outputs.at(tensor).first;
+                if (tensor_buffers.count(input) != 0)
+                {
+                    share_buffer(tensor, input, in_place_outputs.at(tensor).second);
+                }
+                else
+                {
+                    // Passed through from a persistent tensor
+                    tensor_buffers[tensor] = {packer.add_buffer(tensor->size(), step), 0};
+                    tensor->set_pool_offset(input->get_pool_offset());
+                }
+            }
+            else if (input_views.count(tensor))
+            {
+                descriptor::Tensor* host = input_views.at(tensor).first;
+                if (tensor_buffers.count(host) == 0)
+                {
+                    add_buffer(host, host->size());
+                }
+                share_buffer(tensor, host, input_views.at(tensor).second);
+                m_view_bytes += tensor->size();
+            }
+            else if (tensor_buffers.count(tensor) != 0)
+            {
+                // Allocated when the first of its inputs computed in it was
+                packer.extend_buffer(tensor_buffers.at(tensor).first, step);
+            }
+            else
+            {
+                add_buffer(tensor, tensor->size());
+            }
         }
 
-        if (!m_disable_memory_sharing)
+        // Called functions run while the op's inputs and outputs are live, and their pools are
+        // free again when it returns
+        size_t nested_pool_size = 0;
+        if (m_nest_function_pools)
+        {
+            for (const shared_ptr<Function>& nested_function : node->get_functions())
+            {
+                Liveness().run_on_function(nested_function);
+                size_t lower_bound = m_lower_bound;
+                size_t in_place_bytes = m_in_place_bytes;
+                size_t view_bytes = m_view_bytes;
+                run_on_function(nested_function);
+                m_lower_bound = lower_bound;
+                m_in_place_bytes = in_place_bytes;
+                m_view_bytes = view_bytes;
+                nested_pool_size =
+                    max(nested_pool_size, nested_function->get_temporary_pool_size());
+            }
+        }
+        if (nested_pool_size > 0)
         {
-            for (const descriptor::Tensor* tensor : node->liveness_free_list)
+            nested_buffers[node.get()] = packer.add_buffer(nested_pool_size, step);
+            if (!m_offline_packing)
             {
-                if (reused_inputs.count(tensor) == 0)
+                node->set_nested_pool_offset(mm.allocate(nested_pool_size));
+                if (!m_disable_memory_sharing)
                 {
-                    mm.free(tensor->get_pool_offset());
+                    mm.free(node->get_nested_pool_offset());
                 }
             }
         }
+
+        for (descriptor::Tensor* tensor : node->liveness_free_list)
+        {
+            size_t buffer = tensor_buffers.at(tensor).first;
+            packer.extend_buffer(buffer, step);
+            // Inputs computed in a consumer's output live on in it
+            if (!m_disable_memory_sharing && !m_offline_packing &&
+                reused_inputs.count(tensor) == 0 && input_views.count(tensor) == 0)
+            {
+                mm.free(buffer_offsets.at(buffer));
+            }
+        }
+        step++;
+    }
+
+    m_lower_bound = packer.get_lower_bound();
+    if (m_offline_packing)
+    {
+        packer.pack();
+        for (const auto& tensor_buffer : tensor_buffers)
+        {
+            tensor_buffer.first->set_pool_offset(packer.get_offset(tensor_buffer.second.first) +
+                                                 tensor_buffer.second.second);
+        }
+        for (const auto& nested_buffer : nested_buffers)
+        {
+            nested_buffer.first->set_nested_pool_offset(packer.get_offset(nested_buffer.second));
+        }
+        function->set_temporary_pool_size(packer.max_allocated());
     }
-    function->set_temporary_pool_size(mm.max_allocated());
+    else
+    {
+        function->set_temporary_pool_size(mm.max_allocated());
+    }
+    NGRAPH_DEBUG << "Temporary pool size of " << function->get_name() << " is "
+                 << function->get_temporary_pool_size() << " bytes, lower bound "
+                 << m_lower_bound << ", " << m_in_place_bytes << " bytes computed in place, "
+                 << m_view_bytes << " bytes placed as views";
 
     return false;
 }
@@ -277,3 +451,93 @@ size_t pass::MemoryManager::align(size_t size, size_t alignment)
     }
     return size;
 }
+
+pass::MemoryPacker::MemoryPacker(size_t alignment)
+    : m_alignment{alignment}
+    , m_max_allocated{0}
+{
+    if (m_alignment == 0)
+    {
+        throw invalid_argument("Memory alignment must be > 0");
+    }
+}
+
+size_t pass::MemoryPacker::add_buffer(size_t size, size_t step)
+{
+    m_buffers.push_back(buffer{MemoryManager::align(size, m_alignment), step, step, 0});
+    return m_buffers.size() - 1;
+}
+
+void pass::MemoryPacker::extend_buffer(size_t id, size_t step)
+{
+    buffer& b = m_buffers.at(id);
+    b.m_begin = min(b.m_begin, step);
+    b.m_end = max(b.m_end, step);
+}
+
+void pass::MemoryPacker::pack()
+{
+    vector<size_t> order(m_buffers.size());
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        order[i] = i;
+    }
+    stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return m_buffers[a].m_size > m_buffers[b].m_size;
+    });
+
+    m_max_allocated = 0;
+    vector<const buffer*> placed;
+    vector<const buffer*> overlapping;
+    for (size_t id : order)
+    {
+        buffer& b = m_buffers[id];
+        overlapping.clear();
+        for (const buffer* other : placed)
+        {
+            if (other->m_begin <= b.m_end && b.m_begin <= other->m_end)
+            {
+                overlapping.push_back(other);
+            }
+        }
+        sort(overlapping.begin(), overlapping.end(), [](const buffer* x, const buffer* y) {
+            return x->m_offset < y->m_offset;
+        });
+
+        // Smallest gap between overlapping buffers that fits, else above all of them
+        size_t gap_begin = 0;
+        size_t best_gap = numeric_limits<size_t>::max();
+        size_t best_offset = numeric_limits<size_t>::max();
+        for (const buffer* other : overlapping)
+        {
+            if (other->m_offset >= gap_begin + b.m_size && other->m_offset - gap_begin < best_gap)
+            {
+                best_gap = other->m_offset - gap_begin;
+                best_offset = gap_begin;
+            }
+            gap_begin = max(gap_begin, other->m_offset + other->m_size);
+        }
+        b.m_offset = best_offset == numeric_limits<size_t>::max() ? gap_begin : best_offset;
+        m_max_allocated = max(m_max_allocated, b.m_offset + b.m_size);
+        placed.push_back(&b);
+    }
+}
+
+size_t pass::MemoryPacker::get_lower_bound() const
+{
+    // Bytes allocated and freed at each step
+    map<size_t, int64_t> deltas;
+    for (const buffer& b : m_buffers)
+    {
+        deltas[b.m_begin] += b.m_size;
+        deltas[b.m_end + 1] -= b.m_size;
+    }
+    int64_t live = 0;
+    int64_t max_live = 0;
+    for (const auto& delta : deltas)
+    {
+        live += delta.second;
+        max_live = max(max_live, live);
+    }
+    return max_live;
+}
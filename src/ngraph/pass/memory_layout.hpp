@@ -19,6 +19,7 @@
 #include <limits>
 #include <list>
 #include <sstream>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -29,18 +30,40 @@ namespace ngraph
         class MemoryLayout;
         class MemoryNode;
         class MemoryManager;
+        class MemoryPacker;
     }
 }
 
 class ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
+    /// \param offline_packing Place all tensors at once with MemoryPacker after their
+    ///     lifetimes are known, instead of first fit in op order. Ignored if memory sharing
+    ///     is disabled.
+    /// \param nest_function_pools Lay out the functions called by ops such as FunctionCall
+    ///     and Reduce first, and reserve the largest of their pools in this function's pool
+    ///     while the op runs. The op's nested pool offset is set to the reserved memory.
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 bool offline_packing = false,
+                 bool nest_function_pools = false);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
+    /// Most temporary bytes live at once in the last function, a lower bound on its pool size
+    size_t get_lower_bound() const { return m_lower_bound; }
+    /// Bytes of the outputs of the last function that overwrite the buffer of an input
+    size_t get_in_place_bytes() const { return m_in_place_bytes; }
+    /// Bytes of the tensors of the last function placed as views of another tensor's buffer,
+    /// the copies a backend can skip
+    size_t get_view_bytes() const { return m_view_bytes; }
 private:
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    bool m_offline_packing;
+    bool m_nest_function_pools;
+    size_t m_lower_bound;
+    size_t m_in_place_bytes;
+    size_t m_view_bytes;
 };
 
 class ngraph::pass::MemoryManager
@@ -95,3 +118,40 @@ private:
     allocation_scheme m_scheme;
     size_t m_max_allocated;
 };
+
+/// \brief Offline allocator for buffers whose lifetimes are all known up front.
+///
+/// Placement is treated as packing rectangles of lifetime by size: buffers are placed largest
+/// first, each at the smallest gap left by the already placed buffers whose lifetimes overlap
+/// it, or above all of them if no gap fits.
+class ngraph::pass::MemoryPacker
+{
+public:
+    MemoryPacker(size_t alignment = 1);
+
+    /// \brief Adds a buffer that is live from step onwards
+    /// \returns The id of the buffer
+    size_t add_buffer(size_t size, size_t step);
+    /// \brief Extends the lifetime of a buffer through step
+    void extend_buffer(size_t id, size_t step);
+
+    /// \brief Assigns offsets to all buffers
+    void pack();
+    size_t get_offset(size_t id) const { return m_buffers.at(id).m_offset; }
+    size_t max_allocated() const { return m_max_allocated; }
+    /// Most bytes live at any step, the smallest pool size any placement can reach
+    size_t get_lower_bound() const;
+
+private:
+    struct buffer
+    {
+        size_t m_size;
+        size_t m_begin;
+        size_t m_end;
+        size_t m_offset;
+    };
+
+    std::vector<buffer> m_buffers;
+    size_t m_alignment;
+    size_t m_max_allocated;
+};
@@ -0,0 +1,306 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/descriptor/input.hpp"
+#include "ngraph/descriptor/output.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+/// \brief How often each op reads each temporary tensor, which is all the scheduler and the
+///     peak of any order need to know
+class pass::MemorySchedule::UseCounts
+{
+public:
+    UseCounts(const list<shared_ptr<Node>>& ops, size_t alignment)
+        : m_nodes(ops.begin(), ops.end())
+        , m_inputs(m_nodes.size())
+        , m_users(m_nodes.size())
+        , m_pending_arguments(m_nodes.size())
+    {
+        for (size_t i = 0; i < m_nodes.size(); i++)
+        {
+            m_index[m_nodes[i].get()] = i;
+        }
+        for (size_t i = 0; i < m_nodes.size(); i++)
+        {
+            Node* node = m_nodes[i].get();
+            // Parameters, results and constants are not allocated from the pool
+            bool persistent = node->is_parameter() || node->is_output() || node->is_constant();
+            for (size_t j = 0; j < node->get_output_size(); ++j)
+            {
+                descriptor::Tensor* tensor = &node->get_output_tensor(j);
+                m_tensors[tensor].size =
+                    persistent ? 0 : MemoryManager::align(tensor->size(), alignment);
+            }
+
+            unordered_map<descriptor::Tensor*, size_t> uses;
+            unordered_set<Node*> arguments;
+            for (descriptor::Input& input : node->get_inputs())
+            {
+                uses[&input.get_tensor()]++;
+                arguments.insert(input.get_output().get_node().get());
+            }
+            for (const auto& control_dep : node->get_control_dependencies())
+            {
+                arguments.insert(control_dep.get());
+            }
+            for (const auto& use : uses)
+            {
+                TensorUses& tensor = m_tensors[use.first];
+                tensor.uses += use.second;
+                tensor.max_uses_by_one_user = max(tensor.max_uses_by_one_user, use.second);
+                tensor.users.emplace_back(i, use.second);
+                m_inputs[i].emplace_back(use.first, use.second);
+            }
+            for (Node* argument : arguments)
+            {
+                m_users[m_index.at(argument)].push_back(i);
+            }
+            m_pending_arguments[i] = arguments.size();
+        }
+    }
+
+    /// \returns The most temporary bytes live at once when ops run in this order
+    size_t get_peak_bytes(const list<shared_ptr<Node>>& order) const
+    {
+        unordered_map<descriptor::Tensor*, size_t> remaining_uses;
+        for (const auto& tensor : m_tensors)
+        {
+            remaining_uses[tensor.first] = tensor.second.uses;
+        }
+        int64_t live = 0;
+        int64_t peak = 0;
+        for (const auto& node : order)
+        {
+            size_t i = m_index.at(node.get());
+            for (size_t j = 0; j < node->get_output_size(); ++j)
+            {
+                live += m_tensors.at(&node->get_output_tensor(j)).size;
+            }
+            peak = max(peak, live);
+            for (const auto& input : m_inputs[i])
+            {
+                if ((remaining_uses.at(input.first) -= input.second) == 0)
+                {
+                    live -= m_tensors.at(input.first).size;
+                }
+            }
+            for (size_t j = 0; j < node->get_output_size(); ++j)
+            {
+                const TensorUses& output = m_tensors.at(&node->get_output_tensor(j));
+                if (output.uses == 0)
+                {
+                    live -= output.size;
+                }
+            }
+        }
+        return static_cast<size_t>(peak);
+    }
+
+    struct TensorUses
+    {
+        int64_t size = 0;
+        size_t uses = 0;
+        size_t max_uses_by_one_user = 0;
+        // Ops reading the tensor and how often each one does
+        vector<pair<size_t, size_t>> users;
+    };
+
+    vector<shared_ptr<Node>> m_nodes;
+    unordered_map<Node*, size_t> m_index;
+    unordered_map<descriptor::Tensor*, TensorUses> m_tensors;
+    // Tensors each op reads and how often
+    vector<vector<pair<descriptor::Tensor*, size_t>>> m_inputs;
+    // Ops that wait for each op, through an input or a control dependency
+    vector<vector<size_t>> m_users;
+    vector<size_t> m_pending_arguments;
+};
+
+pass::MemorySchedule::MemorySchedule(size_t alignment, size_t memory_budget)
+    : m_alignment(alignment)
+    , m_memory_budget(memory_budget)
+    , m_original_peak_bytes(0)
+    , m_scheduled_peak_bytes(0)
+    , m_original_pool_size(0)
+    , m_pool_size(0)
+{
+}
+
+size_t pass::MemorySchedule::lay_out(const shared_ptr<Function>& function) const
+{
+    Liveness().run_on_function(function);
+    MemoryLayout(m_alignment).run_on_function(function);
+    return function->get_temporary_pool_size();
+}
+
+bool pass::MemorySchedule::run_on_function(shared_ptr<ngraph::Function> function)
+{
+    auto original_ops = function->get_ordered_ops();
+    UseCounts use_counts(original_ops, m_alignment);
+    m_original_peak_bytes = use_counts.get_peak_bytes(original_ops);
+    m_scheduled_peak_bytes = m_original_peak_bytes;
+    m_original_pool_size = lay_out(function);
+    m_pool_size = m_original_pool_size;
+
+    if (m_memory_budget == 0 || m_original_pool_size > m_memory_budget)
+    {
+        // The peak is a lower bound on the pool, but first fit can fragment the pool of an
+        // order with a lower peak, so the orders are compared by their laid out pools
+        auto scheduled_ops = schedule(use_counts);
+        size_t scheduled_peak_bytes = use_counts.get_peak_bytes(scheduled_ops);
+        if (scheduled_peak_bytes < m_original_peak_bytes)
+        {
+            function->set_ordered_ops(scheduled_ops);
+            size_t scheduled_pool_size = lay_out(function);
+            if (scheduled_pool_size < m_original_pool_size)
+            {
+                m_scheduled_peak_bytes = scheduled_peak_bytes;
+                m_pool_size = scheduled_pool_size;
+            }
+            else
+            {
+                function->set_ordered_ops(original_ops);
+                lay_out(function);
+            }
+        }
+    }
+    NGRAPH_DEBUG << "Temporary pool size of " << function->get_name() << ": "
+                 << m_original_pool_size << " in the original order, " << m_pool_size
+                 << " scheduled";
+    if (m_memory_budget != 0 && m_pool_size > m_memory_budget)
+    {
+        NGRAPH_WARN << "Temporary pool size of " << function->get_name() << " is " << m_pool_size
+                    << ", over the budget of " << m_memory_budget;
+    }
+
+    return false;
+}
+
+list<shared_ptr<Node>> pass::MemorySchedule::schedule(const UseCounts& use_counts) const
+{
+    const auto& nodes = use_counts.m_nodes;
+    const auto& inputs = use_counts.m_inputs;
+    const auto& tensors = use_counts.m_tensors;
+    auto pending_arguments = use_counts.m_pending_arguments;
+    unordered_map<descriptor::Tensor*, size_t> remaining_uses;
+    for (const auto& tensor : tensors)
+    {
+        remaining_uses[tensor.first] = tensor.second.uses;
+    }
+
+    // Live bytes added by running an op: its outputs minus the tensors it frees
+    auto get_growth = [&](size_t i) {
+        int64_t growth = 0;
+        Node* node = nodes[i].get();
+        for (size_t j = 0; j < node->get_output_size(); ++j)
+        {
+            const auto& output = tensors.at(&node->get_output_tensor(j));
+            if (output.uses != 0)
+            {
+                growth += output.size;
+            }
+        }
+        for (const auto& input : inputs[i])
+        {
+            if (remaining_uses.at(input.first) == input.second)
+            {
+                growth -= tensors.at(input.first).size;
+            }
+        }
+        return growth;
+    };
+
+    // Ready ops by growth. Ties go to the op whose last argument ran most recently, which
+    // finishes the chain of ops that was started last before starting another, and then to
+    // the op created first. Neither depends on the original order, which is a topological
+    // sort that can differ between runs. An op's growth only changes when a tensor it reads
+    // gets down to its own uses; the op is then queued again and its older entry, with an
+    // older version, is skipped.
+    using Entry = tuple<int64_t, int64_t, size_t, size_t, size_t>;
+    priority_queue<Entry, vector<Entry>, greater<Entry>> ready;
+    vector<size_t> versions(nodes.size(), 0);
+    vector<bool> is_ready(nodes.size(), false);
+    // Position in the schedule of the last argument of each op that has run
+    vector<int64_t> last_argument(nodes.size(), -1);
+    auto push = [&](size_t i) {
+        is_ready[i] = true;
+        ready.emplace(
+            get_growth(i), -last_argument[i], nodes[i]->get_instance_id(), i, ++versions[i]);
+    };
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        if (pending_arguments[i] == 0)
+        {
+            push(i);
+        }
+    }
+
+    list<shared_ptr<Node>> result;
+    while (!ready.empty())
+    {
+        size_t i = get<3>(ready.top());
+        size_t version = get<4>(ready.top());
+        ready.pop();
+        if (version != versions[i])
+        {
+            continue;
+        }
+        // Scheduled ops are never queued again
+        versions[i] = 0;
+        result.push_back(nodes[i]);
+
+        for (const auto& input : inputs[i])
+        {
+            size_t remaining = (remaining_uses.at(input.first) -= input.second);
+            const auto& tensor = tensors.at(input.first);
+            if (remaining != 0 && remaining <= tensor.max_uses_by_one_user)
+            {
+                for (const auto& user : tensor.users)
+                {
+                    if (user.second == remaining && is_ready[user.first] &&
+                        versions[user.first] != 0)
+                    {
+                        push(user.first);
+                    }
+                }
+            }
+        }
+        for (size_t user : use_counts.m_users[i])
+        {
+            last_argument[user] = static_cast<int64_t>(result.size() - 1);
+            if (--pending_arguments[user] == 0)
+            {
+                push(user);
+            }
+        }
+    }
+    return result;
+}
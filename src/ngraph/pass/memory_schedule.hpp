@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <list>
+#include <memory>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MemorySchedule;
+    }
+}
+
+/// \brief Reorders the ops of a function to reduce the size of its temporary memory pool.
+///
+/// Ops are scheduled greedily: among the ops whose arguments are available, the one that adds
+/// the fewest live bytes (its outputs minus the inputs it is the last user of) runs next, with
+/// ties going to the op that continues the most recently started chain of ops, then to the
+/// op created first. Both orders are laid out with pass::Liveness and pass::MemoryLayout, and
+/// the schedule is installed with Function::set_ordered_ops if its pool is smaller. This pass
+/// should run right before Liveness and MemoryLayout, which lay out the pool for good.
+class ngraph::pass::MemorySchedule : public FunctionPass
+{
+public:
+    /// \param alignment The alignment of the MemoryLayout pass that follows
+    /// \param memory_budget Pool size in bytes that is small enough. The original order is kept
+    ///     if its pool fits in the budget; 0 always schedules for the smallest pool.
+    MemorySchedule(size_t alignment = 1, size_t memory_budget = 0);
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+    /// Most temporary bytes live at once in the last function in its original order
+    size_t get_original_peak_bytes() const { return m_original_peak_bytes; }
+    /// Most temporary bytes live at once in the last function in the order this pass left
+    size_t get_scheduled_peak_bytes() const { return m_scheduled_peak_bytes; }
+    /// Temporary pool size of the last function in its original order
+    size_t get_original_pool_size() const { return m_original_pool_size; }
+    /// Temporary pool size of the last function in the order this pass left
+    size_t get_pool_size() const { return m_pool_size; }
+
+private:
+    class UseCounts;
+
+    std::list<std::shared_ptr<Node>> schedule(const UseCounts& use_counts) const;
+    // Runs Liveness and MemoryLayout on the function and returns its pool size
+    size_t lay_out(const std::shared_ptr<Function>& function) const;
+
+    size_t m_alignment;
+    size_t m_memory_budget;
+    size_t m_original_peak_bytes;
+    size_t m_scheduled_peak_bytes;
+    size_t m_original_pool_size;
+    size_t m_pool_size;
+};
@@ -63,6 +63,9 @@ class ngraph::pass::FunctionPass : public PassBase
 public:
     virtual ~FunctionPass() {}
     virtual bool run_on_function(std::shared_ptr<ngraph::Function>) = 0;
+    /// \brief Passes that keep no state between calls and only touch the function they are
+    ///     given return true, letting the Manager run them on several functions at once
+    virtual bool is_function_parallel() const { return false; }
 };
 
 class ngraph::pass::NodePass : public PassBase
@@ -0,0 +1,205 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/descriptor/input.hpp"
+#include "ngraph/descriptor/output.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/op/batch_norm.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/rematerialization.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static size_t measure_pool_size(const shared_ptr<Function>& function, size_t alignment)
+{
+    pass::Liveness().run_on_function(function);
+    pass::MemoryLayout(alignment).run_on_function(function);
+    return function->get_temporary_pool_size();
+}
+
+static bool is_recomputable(const Node* node)
+{
+    return node->get_output_size() == 1 && node->get_control_dependencies().empty() &&
+           (dynamic_cast<const op::util::UnaryElementwiseArithmetic*>(node) ||
+            dynamic_cast<const op::util::BinaryElementwiseArithmetic*>(node) ||
+            dynamic_cast<const op::BatchNormInference*>(node));
+}
+
+pass::Rematerialization::Rematerialization(size_t memory_budget, size_t alignment)
+    : m_memory_budget(memory_budget)
+    , m_alignment(alignment)
+    , m_original_pool_size(0)
+    , m_pool_size(0)
+    , m_recomputed_count(0)
+{
+}
+
+bool pass::Rematerialization::run_on_function(shared_ptr<ngraph::Function> function)
+{
+    m_original_pool_size = measure_pool_size(function, m_alignment);
+    m_pool_size = m_original_pool_size;
+    m_recomputed_count = 0;
+
+    // Every op is copied at most about once
+    size_t max_recomputed_count = function->get_ordered_ops().size();
+    size_t peak = numeric_limits<size_t>::max();
+    while (peak > m_memory_budget && m_recomputed_count < max_recomputed_count)
+    {
+        auto ordered_ops = function->get_ordered_ops();
+        vector<shared_ptr<Node>> ops(ordered_ops.begin(), ordered_ops.end());
+        unordered_map<const Node*, size_t> steps;
+        for (size_t i = 0; i < ops.size(); i++)
+        {
+            steps[ops[i].get()] = i;
+        }
+
+        // Steps at which each temporary is first and last live; parameters, results and
+        // constants are not allocated from the pool
+        unordered_map<const descriptor::Tensor*, pair<size_t, size_t>> lifetimes;
+        for (size_t i = 0; i < ops.size(); i++)
+        {
+            const auto& node = ops[i];
+            if (node->is_parameter() || node->is_output() || node->is_constant())
+            {
+                continue;
+            }
+            for (const descriptor::Output& output : node->get_outputs())
+            {
+                size_t last = i;
+                for (const descriptor::Input* input : output.get_inputs())
+                {
+                    last = max(last, steps.at(input->get_raw_pointer_node()));
+                }
+                lifetimes[&output.get_tensor()] = {i, last};
+            }
+        }
+
+        vector<int64_t> live(ops.size() + 1);
+        for (const auto& lifetime : lifetimes)
+        {
+            int64_t size = MemoryManager::align(lifetime.first->size(), m_alignment);
+            live[lifetime.second.first] += size;
+            live[lifetime.second.second + 1] -= size;
+        }
+        size_t peak_step = 0;
+        int64_t live_bytes = 0;
+        peak = 0;
+        for (size_t i = 0; i < ops.size(); i++)
+        {
+            live_bytes += live[i];
+            if (static_cast<size_t>(live_bytes) > peak)
+            {
+                peak = live_bytes;
+                peak_step = i;
+            }
+        }
+        if (peak <= m_memory_budget)
+        {
+            break;
+        }
+
+        // The largest tensor live but unused at the peak whose producer can run again right
+        // before its next use without keeping any input live longer
+        auto inputs_stay_live = [&](const Node* node, size_t step) {
+            for (const descriptor::Input& input : node->get_inputs())
+            {
+                auto it = lifetimes.find(&input.get_tensor());
+                if (it != lifetimes.end() && it->second.second < step)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+        const Node* best = nullptr;
+        size_t best_size = 0;
+        size_t best_next_use = 0;
+        for (size_t i = 0; i < peak_step; i++)
+        {
+            const Node* node = ops[i].get();
+            auto it = node->get_output_size() == 1 ? lifetimes.find(&node->get_output_tensor(0))
+                                                   : lifetimes.end();
+            if (it == lifetimes.end() || it->second.second <= peak_step || !is_recomputable(node))
+            {
+                continue;
+            }
+            size_t next_use = ops.size();
+            for (const descriptor::Input* input : node->get_outputs().at(0).get_inputs())
+            {
+                size_t step = steps.at(input->get_raw_pointer_node());
+                if (step >= peak_step)
+                {
+                    next_use = min(next_use, step);
+                }
+            }
+            size_t size = it->first->size();
+            if (next_use == peak_step || size <= best_size || !inputs_stay_live(node, next_use))
+            {
+                continue;
+            }
+            best = node;
+            best_size = size;
+            best_next_use = next_use;
+        }
+        if (best == nullptr)
+        {
+            break;
+        }
+
+        auto node = ops[steps.at(best)];
+        auto copy = node->copy_with_new_args(node->get_arguments());
+        vector<descriptor::Input*> late_inputs;
+        for (descriptor::Input* input : node->get_outputs().at(0).get_inputs())
+        {
+            if (steps.at(input->get_raw_pointer_node()) > peak_step)
+            {
+                late_inputs.push_back(input);
+            }
+        }
+        for (descriptor::Input* input : late_inputs)
+        {
+            input->replace_output(copy, 0);
+        }
+        ordered_ops.insert(next(ordered_ops.begin(), best_next_use), copy);
+        function->set_ordered_ops(ordered_ops);
+        m_recomputed_count++;
+    }
+
+    if (m_recomputed_count > 0)
+    {
+        m_pool_size = measure_pool_size(function, m_alignment);
+    }
+    NGRAPH_DEBUG << "Recomputed " << m_recomputed_count << " ops in " << function->get_name()
+                 << ", temporary pool size " << m_original_pool_size << " to " << m_pool_size
+                 << " bytes";
+    if (peak > m_memory_budget)
+    {
+        NGRAPH_WARN << "Temporaries of " << function->get_name() << " need " << peak
+                    << " bytes, over the budget of " << m_memory_budget;
+    }
+    return m_recomputed_count > 0;
+}
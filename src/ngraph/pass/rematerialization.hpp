@@ -0,0 +1,61 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class Rematerialization;
+    }
+}
+
+/// \brief Recomputes cheap ops next to their late users instead of keeping their outputs live,
+///     until the temporaries live at once fit in a byte budget.
+///
+/// Meant for training graphs, where forward activations otherwise stay live until their use in
+/// backprop. While the most bytes live at one step exceed the budget, the largest tensor that is
+/// live but unused at that step is split: its users after the step read a copy of the producing
+/// op that runs right before the first of them. Only elementwise ops and BatchNormInference are
+/// copied, and only if their inputs stay live until the copy runs anyway. The new order is
+/// installed with Function::set_ordered_ops, so this pass should run right before
+/// pass::Liveness and pass::MemoryLayout.
+class ngraph::pass::Rematerialization : public FunctionPass
+{
+public:
+    /// \param memory_budget Bytes of temporaries that may be live at once
+    /// \param alignment The alignment of the MemoryLayout pass that follows
+    Rematerialization(size_t memory_budget, size_t alignment = 1);
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+    /// Temporary pool size of the last function before ops were recomputed
+    size_t get_original_pool_size() const { return m_original_pool_size; }
+    /// Temporary pool size of the last function after ops were recomputed
+    size_t get_pool_size() const { return m_pool_size; }
+    /// Number of ops copied in the last function
+    size_t get_recomputed_count() const { return m_recomputed_count; }
+private:
+    size_t m_memory_budget;
+    size_t m_alignment;
+    size_t m_original_pool_size;
+    size_t m_pool_size;
+    size_t m_recomputed_count;
+};
@@ -30,7 +30,7 @@ class ngraph::pass::ReshapeElimination : public ngraph::pass::GraphRewrite
 {
 public:
     ReshapeElimination()
-        : GraphRewrite()
+        : GraphRewrite(true)
     {
         construct_dot_transpose_pattern();
         construct_identity_reshape_pattern();
@@ -14,46 +14,36 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cstdlib> // llvm 8.1 gets confused about `malloc` otherwise
-#include <memory>
-
 #include "ngraph/runtime/aligned_buffer.hpp"
 
+using namespace std;
 using namespace ngraph;
 
 runtime::AlignedBuffer::AlignedBuffer()
-    : m_allocated_buffer(nullptr)
-    , m_aligned_buffer(nullptr)
+    : m_aligned_buffer(nullptr)
     , m_byte_size(0)
+    , m_alignment(0)
 {
 }
 
-runtime::AlignedBuffer::AlignedBuffer(size_t byte_size, size_t alignment)
+runtime::AlignedBuffer::AlignedBuffer(size_t byte_size,
+                                      size_t alignment,
+                                      shared_ptr<Allocator> allocator)
+    : m_allocator(allocator)
+    , m_aligned_buffer(nullptr)
+    , m_byte_size(byte_size)
+    , m_alignment(alignment)
 {
-    m_byte_size = byte_size;
     if (m_byte_size > 0)
     {
-        size_t allocation_size = m_byte_size + alignment;
-        m_allocated_buffer = static_cast<char*>(malloc(allocation_size));
-        m_aligned_buffer = m_allocated_buffer;
-        size_t mod = size_t(m_aligned_buffer) % alignment;
-
-        if (mod != 0)
-        {
-            m_aligned_buffer += (alignment - mod);
-        }
-    }
-    else
-    {
-        m_allocated_buffer = nullptr;
-        m_aligned_buffer = nullptr;
+        m_aligned_buffer = static_cast<char*>(m_allocator->allocate(m_byte_size, m_alignment));
     }
 }
 
 runtime::AlignedBuffer::~AlignedBuffer()
 {
-    if (m_allocated_buffer != nullptr)
+    if (m_aligned_buffer != nullptr)
     {
-        free(m_allocated_buffer);
+        m_allocator->deallocate(m_aligned_buffer, m_byte_size, m_alignment);
     }
 }
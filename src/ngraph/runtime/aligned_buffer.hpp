@@ -17,6 +17,9 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
+
+#include "ngraph/runtime/allocator.hpp"
 
 namespace ngraph
 {
@@ -26,13 +29,14 @@ namespace ngraph
     }
 }
 
-/// \brief Allocates a block of memory on the specified alignment. The actual size of the
-/// allocated memory is larger than the requested size by the alignment, so allocating 1 byte
-/// on 64 byte alignment will allocate 65 bytes.
+/// \brief Allocates a block of memory on the specified alignment from an Allocator, by default
+/// the process default allocator.
 class ngraph::runtime::AlignedBuffer
 {
 public:
-    AlignedBuffer(size_t byte_size, size_t alignment);
+    AlignedBuffer(size_t byte_size,
+                  size_t alignment,
+                  std::shared_ptr<Allocator> allocator = Allocator::get_default());
     AlignedBuffer();
     ~AlignedBuffer();
 
@@ -44,7 +48,8 @@ private:
     AlignedBuffer(AlignedBuffer&&) = delete;
     AlignedBuffer& operator=(const AlignedBuffer&) = delete;
 
-    char* m_allocated_buffer;
+    std::shared_ptr<Allocator> m_allocator;
     char* m_aligned_buffer;
     size_t m_byte_size;
+    size_t m_alignment;
 };
@@ -0,0 +1,187 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <sys/mman.h>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/allocator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const size_t s_huge_page_size = 2 * 1024 * 1024;
+
+static mutex s_default_mutex;
+
+static shared_ptr<runtime::Allocator>& default_allocator()
+{
+    static shared_ptr<runtime::Allocator> allocator = make_shared<runtime::Allocator>(
+        getenv("NGRAPH_HUGE_PAGES") != nullptr,
+        getenv("NGRAPH_ALLOCATOR_POOL_LIMIT") == nullptr
+            ? 0
+            : strtoull(getenv("NGRAPH_ALLOCATOR_POOL_LIMIT"), nullptr, 10));
+    return allocator;
+}
+
+runtime::Allocator::Allocator(bool use_huge_pages, size_t pool_limit)
+    : m_use_huge_pages(use_huge_pages)
+    , m_pool_limit(pool_limit)
+{
+}
+
+runtime::Allocator::~Allocator()
+{
+    release_pool();
+}
+
+size_t runtime::Allocator::get_block_size(size_t size) const
+{
+    if (is_huge(size))
+    {
+        return (size + s_huge_page_size - 1) / s_huge_page_size * s_huge_page_size;
+    }
+    if (m_pool_limit == 0 || size <= 64)
+    {
+        return size;
+    }
+    // Four size classes per power of two
+    size_t power = 64;
+    while (power < size)
+    {
+        power *= 2;
+    }
+    size_t step = power / 4;
+    return (size + step - 1) / step * step;
+}
+
+bool runtime::Allocator::is_huge(size_t size) const
+{
+    // Rounding up to whole huge pages must waste less than 1/8 of the buffer
+    size_t rounded = (size + s_huge_page_size - 1) / s_huge_page_size * s_huge_page_size;
+    return m_use_huge_pages && size >= s_huge_page_size && (rounded - size) * 8 < size;
+}
+
+void* runtime::Allocator::allocate(size_t size, size_t alignment)
+{
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    {
+        throw ngraph_error("Allocation alignment must be a power of two");
+    }
+    size_t block_size = get_block_size(size);
+    bool huge = is_huge(block_size);
+    alignment = max(huge ? s_huge_page_size : alignment, sizeof(void*));
+
+    void* ptr = nullptr;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_statistics.allocations++;
+        m_statistics.bytes_in_use += block_size;
+        m_statistics.peak_bytes_in_use =
+            max(m_statistics.peak_bytes_in_use, m_statistics.bytes_in_use);
+        if (huge)
+        {
+            m_statistics.huge_page_bytes += block_size;
+        }
+        auto it = m_pool.find({block_size, alignment});
+        if (it != m_pool.end() && !it->second.empty())
+        {
+            ptr = it->second.back();
+            it->second.pop_back();
+            m_statistics.pool_hits++;
+            m_statistics.bytes_pooled -= block_size;
+            return ptr;
+        }
+    }
+
+    if (posix_memalign(&ptr, alignment, max(block_size, size_t(1))) != 0)
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_statistics.allocations--;
+        m_statistics.bytes_in_use -= block_size;
+        if (huge)
+        {
+            m_statistics.huge_page_bytes -= block_size;
+        }
+        throw ngraph_error("Error allocating " + to_string(size) + " bytes");
+    }
+#if defined(MADV_HUGEPAGE)
+    if (huge)
+    {
+        madvise(ptr, block_size, MADV_HUGEPAGE);
+    }
+#endif
+    return ptr;
+}
+
+void runtime::Allocator::deallocate(void* ptr, size_t size, size_t alignment)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    size_t block_size = get_block_size(size);
+    bool huge = is_huge(block_size);
+    alignment = max(huge ? s_huge_page_size : alignment, sizeof(void*));
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_statistics.deallocations++;
+        m_statistics.bytes_in_use -= block_size;
+        if (huge)
+        {
+            m_statistics.huge_page_bytes -= block_size;
+        }
+        if (m_statistics.bytes_pooled + block_size <= m_pool_limit)
+        {
+            m_pool[{block_size, alignment}].push_back(ptr);
+            m_statistics.bytes_pooled += block_size;
+            return;
+        }
+    }
+    free(ptr);
+}
+
+void runtime::Allocator::release_pool()
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (auto& blocks : m_pool)
+    {
+        for (void* ptr : blocks.second)
+        {
+            free(ptr);
+        }
+    }
+    m_pool.clear();
+    m_statistics.bytes_pooled = 0;
+}
+
+runtime::Allocator::Statistics runtime::Allocator::get_statistics() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_statistics;
+}
+
+shared_ptr<runtime::Allocator> runtime::Allocator::get_default()
+{
+    lock_guard<mutex> lock(s_default_mutex);
+    return default_allocator();
+}
+
+void runtime::Allocator::set_default(shared_ptr<Allocator> allocator)
+{
+    lock_guard<mutex> lock(s_default_mutex);
+    default_allocator() = allocator;
+}
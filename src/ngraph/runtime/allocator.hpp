@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Allocator;
+    }
+}
+
+/// \brief Source of aligned host memory for AlignedBuffer, HostTensor and CPUTensorView.
+///
+/// Buffers of at least 2MB can be advised to use transparent huge pages, which cuts TLB misses
+/// on large weights and memory pools, as long as rounding them up to whole huge pages wastes
+/// less than 1/8 of their size. Freed buffers can be kept in a pool per size class and handed
+/// out again, which avoids allocation churn when tensors are created per request.
+/// Sizes are rounded up to a size class of at most 25% waste when pooling is enabled.
+class ngraph::runtime::Allocator
+{
+public:
+    struct Statistics
+    {
+        size_t allocations = 0;
+        size_t deallocations = 0;
+        /// Allocations served from the pool of freed buffers
+        size_t pool_hits = 0;
+        size_t bytes_in_use = 0;
+        size_t peak_bytes_in_use = 0;
+        /// Freed bytes kept in the pool
+        size_t bytes_pooled = 0;
+        /// Bytes of the buffers in use that were advised to use huge pages
+        size_t huge_page_bytes = 0;
+    };
+
+    /// \param use_huge_pages Advise buffers of at least 2MB to use transparent huge pages,
+    ///     unless that rounds them up by 1/8 or more
+    /// \param pool_limit Most freed bytes kept for reuse; 0 returns freed buffers to the
+    ///     system
+    Allocator(bool use_huge_pages = false, size_t pool_limit = 0);
+    virtual ~Allocator();
+
+    /// \brief Allocates size bytes aligned to alignment, a power of two. Throws ngraph_error if
+    ///     the memory is not available.
+    virtual void* allocate(size_t size, size_t alignment);
+    /// \brief Frees a buffer from allocate with the same size and alignment
+    virtual void deallocate(void* ptr, size_t size, size_t alignment);
+
+    /// \brief Returns the pooled buffers to the system
+    void release_pool();
+    bool uses_huge_pages() const { return m_use_huge_pages; }
+    Statistics get_statistics() const;
+
+    /// \brief The allocator used by default. It uses huge pages if NGRAPH_HUGE_PAGES is set and
+    ///     pools up to NGRAPH_ALLOCATOR_POOL_LIMIT bytes.
+    static std::shared_ptr<Allocator> get_default();
+    /// \brief Makes allocator the default for buffers allocated afterwards. Existing buffers
+    ///     keep the allocator they came from.
+    static void set_default(std::shared_ptr<Allocator> allocator);
+
+private:
+    Allocator(const Allocator&) = delete;
+    Allocator& operator=(const Allocator&) = delete;
+
+    // Size of the block backing a buffer of size bytes
+    size_t get_block_size(size_t size) const;
+    bool is_huge(size_t block_size) const;
+
+    bool m_use_huge_pages;
+    size_t m_pool_limit;
+    Statistics m_statistics;
+    // Freed blocks by block size and alignment
+    std::map<std::pair<size_t, size_t>, std::vector<void*>> m_pool;
+    mutable std::mutex m_mutex;
+};
@@ -25,6 +25,35 @@
 using namespace std;
 using namespace ngraph;
 
+namespace
+{
+    class DefaultBoundCall : public runtime::BoundCall
+    {
+    public:
+        DefaultBoundCall(runtime::Backend* backend,
+                         shared_ptr<Function> func,
+                         const vector<shared_ptr<runtime::Tensor>>& outputs,
+                         const vector<shared_ptr<runtime::Tensor>>& inputs)
+            : m_backend(backend)
+            , m_function(func)
+            , m_outputs(outputs)
+            , m_inputs(inputs)
+        {
+        }
+
+        bool run() override { return m_backend->call(m_function, m_outputs, m_inputs); }
+    private:
+        runtime::Backend* m_backend;
+        shared_ptr<Function> m_function;
+        vector<shared_ptr<runtime::Tensor>> m_outputs;
+        vector<shared_ptr<runtime::Tensor>> m_inputs;
+    };
+}
+
+runtime::BoundCall::~BoundCall()
+{
+}
+
 runtime::Backend::~Backend()
 {
 }
@@ -43,12 +72,35 @@ void runtime::Backend::remove_compiled_function(shared_ptr<Function> func)
 {
 }
 
+future<bool> runtime::Backend::call_async(shared_ptr<Function> func,
+                                          const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                          const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    return async(launch::async,
+                 [this, func, outputs, inputs]() { return call(func, outputs, inputs); });
+}
+
+shared_ptr<runtime::BoundCall>
+    runtime::Backend::bind(shared_ptr<Function> func,
+                           const vector<shared_ptr<runtime::Tensor>>& outputs,
+                           const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    validate_call(func, outputs, inputs);
+    compile(func);
+    return make_shared<DefaultBoundCall>(this, func, outputs, inputs);
+}
+
 vector<ngraph::runtime::PerformanceCounter>
     runtime::Backend::get_performance_data(shared_ptr<Function> func) const
 {
     return vector<PerformanceCounter>();
 }
 
+runtime::MemoryUsage runtime::Backend::get_memory_usage(shared_ptr<Function> func) const
+{
+    return MemoryUsage();
+}
+
 void runtime::Backend::validate_call(shared_ptr<const Function> function,
                                      const vector<shared_ptr<runtime::Tensor>>& outputs,
                                      const vector<shared_ptr<runtime::Tensor>>& inputs)
@@ -79,12 +131,12 @@ void runtime::Backend::validate_call(shared_ptr<const Function> function,
                << "'";
             throw runtime_error(ss.str());
         }
-        if (input_parameters[i]->get_shape() != inputs[i]->get_shape())
+        const PartialShape& parameter_shape = input_parameters[i]->get_output_partial_shape(0);
+        if (!parameter_shape.compatible(inputs[i]->get_shape()))
         {
             stringstream ss;
             ss << "Input " << i << " shape {" << join(inputs[i]->get_shape())
-               << "} does not match Parameter shape {" << join(input_parameters[i]->get_shape())
-               << "}";
+               << "} does not match Parameter shape " << parameter_shape;
             throw runtime_error(ss.str());
         }
     }
@@ -98,11 +150,12 @@ void runtime::Backend::validate_call(shared_ptr<const Function> function,
                << "' does not match Result type '" << function->get_output_element_type(i) << "'";
             throw runtime_error(ss.str());
         }
-        if (function->get_output_shape(i) != outputs[i]->get_shape())
+        const PartialShape& result_shape = function->get_output_partial_shape(i);
+        if (!result_shape.compatible(outputs[i]->get_shape()))
         {
             stringstream ss;
             ss << "Output " << i << " shape {" << join(outputs[i]->get_shape())
-               << "} does not match Result shape {" << join(function->get_output_shape(i)) << "}";
+               << "} does not match Result shape " << result_shape;
             throw runtime_error(ss.str());
         }
     }
@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 
 #include "ngraph/function.hpp"
+#include "ngraph/runtime/memory_usage.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -30,9 +32,21 @@ namespace ngraph
         class ExternalFunction;
         class Tensor;
         class Backend;
+        class BoundCall;
     }
 }
 
+/// \brief A Function bound to fixed output and input tensors by Backend::bind.
+class ngraph::runtime::BoundCall
+{
+public:
+    virtual ~BoundCall();
+
+    /// \brief Executes a single iteration of the bound Function on the bound tensors.
+    /// \returns true if iteration is successful, false otherwise
+    virtual bool run() = 0;
+};
+
 /// \brief Interface to a generic backend.
 ///
 /// Backends are responsible for function execution and value allocation.
@@ -102,6 +116,30 @@ public:
         return call(func, outputs, inputs);
     }
 
+    /// \brief Executes a single iteration of a Function without blocking the caller. If func
+    ///     is not compiled the call will compile it.
+    ///
+    /// The tensors must stay alive and must not be accessed until the returned future is
+    /// ready. The backend must outlive the returned future.
+    /// \param func The function to execute
+    /// \returns future holding the result of the iteration. Any exception thrown during
+    ///     execution is rethrown from std::future::get.
+    virtual std::future<bool>
+        call_async(std::shared_ptr<Function> func,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+    /// \brief Compiles a Function and binds it to output and input tensors that are validated
+    ///     once, so that repeated executions skip per-call argument processing.
+    ///
+    /// The tensors are kept alive by the returned object. The backend must outlive it.
+    /// \param func The function to bind
+    /// \returns object executing func on the bound tensors
+    virtual std::shared_ptr<BoundCall>
+        bind(std::shared_ptr<Function> func,
+             const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
     /// \brief Compiled functions may be cached. This function removes a compiled function
     ///     from the cache.
     /// \param func The function to execute
@@ -118,6 +156,11 @@ public:
     virtual std::vector<PerformanceCounter>
         get_performance_data(std::shared_ptr<Function> func) const;
 
+    /// \brief Report the memory used by a compiled Function.
+    /// \param func The function to get the memory usage of.
+    /// \returns Breakdown of the memory of func; empty if func is not compiled.
+    virtual MemoryUsage get_memory_usage(std::shared_ptr<Function> func) const;
+
     /// \brief Test if a backend is capable of supporting an op
     /// \param node is the op to test.
     /// \returns true if the op is supported, false otherwise.
@@ -0,0 +1,284 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/batching_server.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Splits a batched shape into its batch dimension and the shape of one row
+static Shape get_row_shape(const PartialShape& shape, Dimension& batch)
+{
+    if (shape.rank().is_dynamic() || static_cast<size_t>(shape.rank()) == 0)
+    {
+        throw ngraph_error("BatchingServer needs a leading batch dimension");
+    }
+    Shape row_shape;
+    for (size_t i = 1; i < static_cast<size_t>(shape.rank()); i++)
+    {
+        if (shape[i].is_dynamic())
+        {
+            throw ngraph_error("BatchingServer only supports a dynamic batch dimension");
+        }
+        row_shape.push_back(static_cast<size_t>(shape[i]));
+    }
+    batch = shape[0];
+    return row_shape;
+}
+
+runtime::BatchingServer::BatchingServer(Backend* backend,
+                                        shared_ptr<Function> func,
+                                        size_t max_batch_size,
+                                        chrono::microseconds timeout)
+    : m_backend(backend)
+    , m_function(func)
+    , m_max_batch_size(max_batch_size)
+    , m_timeout(timeout)
+    , m_dynamic_batch(false)
+    , m_queued_rows(0)
+    , m_stop(false)
+{
+    if (max_batch_size == 0)
+    {
+        throw ngraph_error("BatchingServer needs a positive max_batch_size");
+    }
+
+    vector<Dimension> batch_dimensions;
+    for (const auto& parameter : func->get_parameters())
+    {
+        Dimension batch;
+        m_input_row_shapes.push_back(get_row_shape(parameter->get_output_partial_shape(0), batch));
+        m_input_types.push_back(parameter->get_element_type());
+        batch_dimensions.push_back(batch);
+    }
+    for (size_t i = 0; i < func->get_output_size(); i++)
+    {
+        Dimension batch;
+        m_output_row_shapes.push_back(get_row_shape(func->get_output_partial_shape(i), batch));
+        m_output_types.push_back(func->get_output_element_type(i));
+        batch_dimensions.push_back(batch);
+    }
+    m_dynamic_batch = batch_dimensions.at(0).is_dynamic();
+    for (const auto& batch : batch_dimensions)
+    {
+        if (batch.is_dynamic() != m_dynamic_batch ||
+            (batch.is_static() && static_cast<size_t>(batch) != max_batch_size))
+        {
+            throw ngraph_error(
+                "BatchingServer needs batch dimensions that are all dynamic or all equal to "
+                "max_batch_size");
+        }
+    }
+
+    for (size_t i = 0; i < m_input_row_shapes.size(); i++)
+    {
+        m_input_buffers.emplace_back(max_batch_size * shape_size(m_input_row_shapes[i]) *
+                                     m_input_types[i].size());
+    }
+    for (size_t i = 0; i < m_output_row_shapes.size(); i++)
+    {
+        m_output_buffers.emplace_back(max_batch_size * shape_size(m_output_row_shapes[i]) *
+                                      m_output_types[i].size());
+    }
+    m_statistics.batch_size_histogram.resize(max_batch_size + 1);
+
+    m_dispatcher = thread(&BatchingServer::dispatch, this);
+}
+
+runtime::BatchingServer::~BatchingServer()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    m_dispatcher.join();
+}
+
+future<void> runtime::BatchingServer::submit(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    if (inputs.size() != m_input_row_shapes.size() || outputs.size() != m_output_row_shapes.size())
+    {
+        throw ngraph_error("BatchingServer request does not match the Function's signature");
+    }
+    size_t rows = inputs.empty() ? 0 : inputs[0]->get_shape().at(0);
+    auto check = [rows](const shared_ptr<runtime::Tensor>& tv, const Shape& row_shape) {
+        const Shape& shape = tv->get_shape();
+        if (shape.empty() || shape[0] != rows || Shape(shape.begin() + 1, shape.end()) != row_shape)
+        {
+            throw ngraph_error("BatchingServer request tensor shape does not match the Function");
+        }
+    };
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        check(inputs[i], m_input_row_shapes[i]);
+    }
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        check(outputs[i], m_output_row_shapes[i]);
+    }
+    if (rows == 0 || rows > m_max_batch_size)
+    {
+        throw ngraph_error("BatchingServer request must have between 1 and max_batch_size rows");
+    }
+
+    Request request;
+    request.outputs = outputs;
+    request.inputs = inputs;
+    request.rows = rows;
+    request.submit_time = chrono::steady_clock::now();
+    auto result = request.promise.get_future();
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_stop)
+        {
+            throw ngraph_error("BatchingServer is stopped");
+        }
+        m_queue.push_back(move(request));
+        m_queued_rows += rows;
+    }
+    m_condition.notify_one();
+    return result;
+}
+
+runtime::BatchingServer::Statistics runtime::BatchingServer::get_statistics() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_statistics;
+}
+
+void runtime::BatchingServer::dispatch()
+{
+    unique_lock<mutex> lock(m_mutex);
+    vector<Request> batch;
+    while (true)
+    {
+        m_condition.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+        if (m_queue.empty())
+        {
+            return;
+        }
+
+        // Wait for a full batch until the oldest request times out
+        auto deadline = m_queue.front().submit_time + m_timeout;
+        m_condition.wait_until(
+            lock, deadline, [this]() { return m_stop || m_queued_rows >= m_max_batch_size; });
+
+        size_t rows = 0;
+        auto start_time = chrono::steady_clock::now();
+        while (!m_queue.empty() && rows + m_queue.front().rows <= m_max_batch_size)
+        {
+            auto latency = chrono::duration_cast<chrono::microseconds>(
+                start_time - m_queue.front().submit_time);
+            m_statistics.total_queue_latency += latency;
+            m_statistics.max_queue_latency = max(m_statistics.max_queue_latency, latency);
+            rows += m_queue.front().rows;
+            batch.push_back(move(m_queue.front()));
+            m_queue.pop_front();
+        }
+        m_queued_rows -= rows;
+        m_statistics.batches++;
+        m_statistics.requests += batch.size();
+        m_statistics.rows += rows;
+        m_statistics.batch_size_histogram[rows]++;
+
+        lock.unlock();
+        execute(batch, rows);
+        batch.clear();
+        lock.lock();
+    }
+}
+
+void runtime::BatchingServer::execute(vector<Request>& batch, size_t rows)
+{
+    try
+    {
+        size_t batch_size = m_dynamic_batch ? rows : m_max_batch_size;
+        const auto& inputs = get_tensors(
+            m_input_tensors, m_input_buffers, m_input_types, m_input_row_shapes, batch_size);
+        const auto& outputs = get_tensors(
+            m_output_tensors, m_output_buffers, m_output_types, m_output_row_shapes, batch_size);
+
+        // Concatenate the requests' inputs along axis 0
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            size_t row_bytes = shape_size(m_input_row_shapes[i]) * m_input_types[i].size();
+            size_t offset = 0;
+            for (const auto& request : batch)
+            {
+                size_t bytes = request.rows * row_bytes;
+                request.inputs[i]->read(m_input_buffers[i].data() + offset, 0, bytes);
+                offset += bytes;
+            }
+            inputs[i]->set_stale(true);
+        }
+
+        m_backend->call(m_function, outputs, inputs);
+
+        // Scatter the outputs back to the requests
+        for (size_t i = 0; i < outputs.size(); i++)
+        {
+            size_t row_bytes = shape_size(m_output_row_shapes[i]) * m_output_types[i].size();
+            size_t offset = 0;
+            for (const auto& request : batch)
+            {
+                size_t bytes = request.rows * row_bytes;
+                request.outputs[i]->write(m_output_buffers[i].data() + offset, 0, bytes);
+                offset += bytes;
+            }
+        }
+        for (auto& request : batch)
+        {
+            request.promise.set_value();
+        }
+    }
+    catch (...)
+    {
+        for (auto& request : batch)
+        {
+            request.promise.set_exception(current_exception());
+        }
+    }
+}
+
+const vector<shared_ptr<runtime::Tensor>>& runtime::BatchingServer::get_tensors(
+    map<size_t, vector<shared_ptr<runtime::Tensor>>>& tensors,
+    const vector<vector<char>>& buffers,
+    const vector<element::Type>& types,
+    const vector<Shape>& row_shapes,
+    size_t batch_size)
+{
+    auto it = tensors.find(batch_size);
+    if (it == tensors.end())
+    {
+        vector<shared_ptr<runtime::Tensor>> batch_tensors;
+        for (size_t i = 0; i < buffers.size(); i++)
+        {
+            Shape shape{batch_size};
+            shape.insert(shape.end(), row_shapes[i].begin(), row_shapes[i].end());
+            batch_tensors.push_back(m_backend->create_tensor(
+                types[i], shape, const_cast<char*>(buffers[i].data())));
+        }
+        it = tensors.emplace(batch_size, move(batch_tensors)).first;
+    }
+    return it->second;
+}
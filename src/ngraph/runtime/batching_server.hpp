@@ -0,0 +1,140 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/function.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Backend;
+        class Tensor;
+        class BatchingServer;
+    }
+}
+
+/// \brief Batches concurrent requests for a Function along axis 0.
+///
+/// Requests are queued until max_batch_size rows are pending or the oldest request has waited
+/// for the timeout. Their inputs are then concatenated into preallocated tensors, the Function
+/// is executed once and the outputs are scattered back to the requests.
+///
+/// The leading dimension of every Parameter and Result of the Function is the batch dimension.
+/// If it is dynamic, every batch runs with its exact size; this needs a backend that supports
+/// dynamic batch, such as CPU. Otherwise it must equal max_batch_size and partial batches are
+/// padded with unspecified rows.
+class ngraph::runtime::BatchingServer
+{
+public:
+    struct Statistics
+    {
+        size_t batches = 0;
+        size_t requests = 0;
+        size_t rows = 0;
+        /// Number of batches of each size, indexed by the number of rows
+        std::vector<size_t> batch_size_histogram;
+        /// Time from submission until the request's batch started executing
+        std::chrono::microseconds total_queue_latency{0};
+        std::chrono::microseconds max_queue_latency{0};
+
+        double get_mean_batch_size() const { return batches ? double(rows) / batches : 0.0; }
+        double get_mean_queue_latency_us() const
+        {
+            return requests ? double(total_queue_latency.count()) / requests : 0.0;
+        }
+    };
+
+    /// \param backend The backend executing the batches. It must outlive the server.
+    /// \param func The batched function
+    /// \param max_batch_size Maximum number of rows executed at once
+    /// \param timeout Longest time a request waits for the batch to fill up
+    BatchingServer(Backend* backend,
+                   std::shared_ptr<Function> func,
+                   size_t max_batch_size,
+                   std::chrono::microseconds timeout);
+    /// \brief Executes the requests still queued and stops the server
+    ~BatchingServer();
+
+    /// \brief Queues a request. Each tensor has the shape of the matching Parameter or Result
+    ///     with a leading dimension of at most max_batch_size rows.
+    ///
+    /// The tensors must stay alive and must not be accessed until the returned future is ready.
+    /// \returns future that is ready once the outputs are written; any exception thrown while
+    ///     executing the batch is rethrown from std::future::get.
+    std::future<void> submit(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+    Statistics get_statistics() const;
+
+private:
+    BatchingServer(const BatchingServer&) = delete;
+    BatchingServer& operator=(const BatchingServer&) = delete;
+
+    struct Request
+    {
+        std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+        std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+        size_t rows;
+        std::chrono::steady_clock::time_point submit_time;
+        std::promise<void> promise;
+    };
+
+    void dispatch();
+    void execute(std::vector<Request>& batch, size_t rows);
+    // Tensors of the given batch size viewing the preallocated buffers
+    const std::vector<std::shared_ptr<runtime::Tensor>>& get_tensors(
+        std::map<size_t, std::vector<std::shared_ptr<runtime::Tensor>>>& tensors,
+        const std::vector<std::vector<char>>& buffers,
+        const std::vector<element::Type>& types,
+        const std::vector<Shape>& row_shapes,
+        size_t batch_size);
+
+    Backend* m_backend;
+    std::shared_ptr<Function> m_function;
+    size_t m_max_batch_size;
+    std::chrono::microseconds m_timeout;
+    bool m_dynamic_batch;
+
+    std::vector<element::Type> m_input_types;
+    std::vector<element::Type> m_output_types;
+    // Shapes of one row, without the batch dimension
+    std::vector<Shape> m_input_row_shapes;
+    std::vector<Shape> m_output_row_shapes;
+    std::vector<std::vector<char>> m_input_buffers;
+    std::vector<std::vector<char>> m_output_buffers;
+    std::map<size_t, std::vector<std::shared_ptr<runtime::Tensor>>> m_input_tensors;
+    std::map<size_t, std::vector<std::shared_ptr<runtime::Tensor>>> m_output_tensors;
+
+    std::deque<Request> m_queue;
+    size_t m_queued_rows;
+    bool m_stop;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_condition;
+    Statistics m_statistics;
+    std::thread m_dispatcher;
+};
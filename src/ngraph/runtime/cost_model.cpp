@@ -0,0 +1,642 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+
+#include "nlohmann/json.hpp"
+
+#include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/batch_norm.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/lrn.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/not.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/op/util/binary_elementwise_logical.hpp"
+#include "ngraph/op/util/index_reduction.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/cost_model.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+using json = nlohmann::json;
+
+// Uncalibrated defaults: 1us of dispatch overhead, 10 GFLOP/s and 10 GB/s
+static const runtime::CostModel::Coefficients s_default_coefficients{1.0, 1e-4, 1e-4};
+
+runtime::CostModel::CostModel(const string& backend_name)
+    : m_backend_name(backend_name)
+    , m_default_coefficients(s_default_coefficients)
+{
+}
+
+static bool has_static_shapes(const Node& node)
+{
+    for (size_t i = 0; i < node.get_input_size(); i++)
+    {
+        if (!node.get_input_partial_shape(i).is_static())
+        {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < node.get_output_size(); i++)
+    {
+        if (!node.get_output_partial_shape(i).is_static())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Multiply-adds per output element of a convolution with the given filters
+static double convolution_macs(const Shape& filters_shape)
+{
+    return filters_shape.empty() || filters_shape[0] == 0
+               ? 0
+               : double(shape_size(filters_shape)) / filters_shape[0];
+}
+
+double runtime::CostModel::get_flops(const Node& node)
+{
+    if (node.is_parameter() || node.is_constant() || node.is_output() ||
+        !has_static_shapes(node) || node.get_output_size() == 0)
+    {
+        return 0;
+    }
+
+    double output_elements = shape_size(node.get_output_shape(0));
+    if (auto dot = dynamic_cast<const op::Dot*>(&node))
+    {
+        const Shape& arg0_shape = node.get_input_shape(0);
+        double reduction_size = 1;
+        for (size_t i = arg0_shape.size() - dot->get_reduction_axes_count();
+             i < arg0_shape.size();
+             i++)
+        {
+            reduction_size *= arg0_shape[i];
+        }
+        return 2 * output_elements * reduction_size;
+    }
+    if (dynamic_cast<const op::Convolution*>(&node))
+    {
+        return 2 * output_elements * convolution_macs(node.get_input_shape(1));
+    }
+    if (dynamic_cast<const op::ConvolutionBackpropData*>(&node))
+    {
+        return 2 * shape_size(node.get_input_shape(1)) *
+               convolution_macs(node.get_input_shape(0));
+    }
+    if (dynamic_cast<const op::ConvolutionBackpropFilters*>(&node))
+    {
+        return 2 * shape_size(node.get_input_shape(1)) *
+               convolution_macs(node.get_output_shape(0));
+    }
+    if (auto pool = dynamic_cast<const op::MaxPool*>(&node))
+    {
+        return output_elements * shape_size(pool->get_window_shape());
+    }
+    if (auto pool = dynamic_cast<const op::AvgPool*>(&node))
+    {
+        return output_elements * shape_size(pool->get_window_shape());
+    }
+    if (auto pool = dynamic_cast<const op::MaxPoolBackprop*>(&node))
+    {
+        return output_elements * shape_size(pool->get_window_shape());
+    }
+    if (auto pool = dynamic_cast<const op::AvgPoolBackprop*>(&node))
+    {
+        return output_elements * shape_size(pool->get_window_shape());
+    }
+    if (auto lrn = dynamic_cast<const op::LRN*>(&node))
+    {
+        return output_elements * lrn->get_nsize();
+    }
+    if (dynamic_cast<const op::util::ArithmeticReduction*>(&node) ||
+        dynamic_cast<const op::util::IndexReduction*>(&node))
+    {
+        return shape_size(node.get_input_shape(0));
+    }
+    if (dynamic_cast<const op::Softmax*>(&node))
+    {
+        // exp, sum and divide
+        return 3 * output_elements;
+    }
+    if (dynamic_cast<const op::BatchNormInference*>(&node))
+    {
+        return 2 * shape_size(node.get_input_shape(2));
+    }
+    if (dynamic_cast<const op::BatchNormTraining*>(&node))
+    {
+        return 5 * shape_size(node.get_input_shape(2));
+    }
+    if (dynamic_cast<const op::BatchNormTrainingBackprop*>(&node))
+    {
+        return 8 * shape_size(node.get_input_shape(2));
+    }
+    if (dynamic_cast<const op::util::UnaryElementwiseArithmetic*>(&node) ||
+        dynamic_cast<const op::util::BinaryElementwiseArithmetic*>(&node) ||
+        dynamic_cast<const op::util::BinaryElementwiseComparison*>(&node) ||
+        dynamic_cast<const op::util::BinaryElementwiseLogical*>(&node) ||
+        dynamic_cast<const op::Not*>(&node) || dynamic_cast<const op::Select*>(&node))
+    {
+        return output_elements;
+    }
+    // Backends fuse convolutions with the ops around them. These take data and filters like
+    // Convolution, whatever else they add.
+    static const set<string> fused_convolutions{"ConvolutionAdd",
+                                                "ConvolutionBias",
+                                                "ConvolutionBiasAdd",
+                                                "ConvolutionRelu",
+                                                "QuantizedConvolution",
+                                                "QuantizedConvolutionBias",
+                                                "QuantizedConvolutionRelu"};
+    if (fused_convolutions.count(node.description()) != 0)
+    {
+        return 2 * output_elements * convolution_macs(node.get_input_shape(1));
+    }
+    if (node.description() == "MatmulBias" && output_elements > 0)
+    {
+        // A (m x k) times B (k x n), transposed or not, so |A| * |B| / |C| = k * k
+        double k = sqrt(double(shape_size(node.get_input_shape(0))) *
+                        shape_size(node.get_input_shape(1)) / output_elements);
+        return 2 * output_elements * k;
+    }
+    // Data movement, or an op without a model
+    return 0;
+}
+
+size_t runtime::CostModel::get_bytes_moved(const Node& node)
+{
+    if (node.is_parameter() || node.is_constant() || !has_static_shapes(node))
+    {
+        return 0;
+    }
+
+    size_t bytes = 0;
+    for (size_t i = 0; i < node.get_input_size(); i++)
+    {
+        bytes += shape_size(node.get_input_shape(i)) * node.get_input_element_type(i).size();
+    }
+    for (size_t i = 0; i < node.get_output_size(); i++)
+    {
+        bytes += shape_size(node.get_output_shape(i)) * node.get_output_element_type(i).size();
+    }
+    return bytes;
+}
+
+runtime::OpCost runtime::CostModel::get_cost(const Node& node) const
+{
+    OpCost cost;
+    if (node.is_parameter() || node.is_constant())
+    {
+        return cost;
+    }
+    cost.flops = get_flops(node);
+    cost.bytes = get_bytes_moved(node);
+    const Coefficients& coefficients = get_coefficients(node.description());
+    cost.microseconds = coefficients.overhead_us + cost.flops * coefficients.us_per_flop +
+                        cost.bytes * coefficients.us_per_byte;
+    return cost;
+}
+
+runtime::OpCost runtime::CostModel::get_cost(const shared_ptr<Function>& f) const
+{
+    OpCost total;
+    for (const shared_ptr<Node>& node : f->get_ordered_ops())
+    {
+        OpCost cost = get_cost(*node);
+        total.flops += cost.flops;
+        total.bytes += cost.bytes;
+        total.microseconds += cost.microseconds;
+    }
+    return total;
+}
+
+const runtime::CostModel::Coefficients&
+    runtime::CostModel::get_coefficients(const string& op_type) const
+{
+    auto it = m_coefficients.find(op_type);
+    return it == m_coefficients.end() ? m_default_coefficients : it->second;
+}
+
+void runtime::CostModel::set_coefficients(const string& op_type,
+                                          const Coefficients& coefficients)
+{
+    m_coefficients[op_type] = coefficients;
+}
+
+void runtime::CostModel::set_default_coefficients(const Coefficients& coefficients)
+{
+    m_default_coefficients = coefficients;
+}
+
+bool runtime::CostModel::has_coefficients(const string& op_type) const
+{
+    return m_coefficients.count(op_type) != 0;
+}
+
+// Solves the weighted least squares problem restricted to the features in mask. Returns false
+// if the system is singular or a coefficient comes out negative.
+static bool solve_least_squares(const vector<array<double, 3>>& features,
+                                const vector<double>& times,
+                                const vector<double>& weights,
+                                unsigned mask,
+                                array<double, 3>& solution)
+{
+    vector<size_t> columns;
+    for (size_t j = 0; j < 3; j++)
+    {
+        if (mask & (1u << j))
+        {
+            columns.push_back(j);
+        }
+    }
+    size_t n = columns.size();
+
+    // Scale every feature to at most 1 to keep the normal equations well conditioned
+    array<double, 3> scale{{0, 0, 0}};
+    for (const array<double, 3>& x : features)
+    {
+        for (size_t j : columns)
+        {
+            scale[j] = max(scale[j], fabs(x[j]));
+        }
+    }
+    for (size_t j : columns)
+    {
+        if (scale[j] == 0)
+        {
+            return false;
+        }
+    }
+
+    // Augmented normal equations [A^T W A | A^T W t]
+    vector<vector<double>> m(n, vector<double>(n + 1, 0));
+    for (size_t i = 0; i < features.size(); i++)
+    {
+        for (size_t r = 0; r < n; r++)
+        {
+            double xr = features[i][columns[r]] / scale[columns[r]];
+            for (size_t c = 0; c < n; c++)
+            {
+                m[r][c] += weights[i] * xr * features[i][columns[c]] / scale[columns[c]];
+            }
+            m[r][n] += weights[i] * xr * times[i];
+        }
+    }
+
+    // Gaussian elimination with partial pivoting
+    for (size_t c = 0; c < n; c++)
+    {
+        size_t pivot = c;
+        for (size_t r = c + 1; r < n; r++)
+        {
+            if (fabs(m[r][c]) > fabs(m[pivot][c]))
+            {
+                pivot = r;
+            }
+        }
+        if (fabs(m[pivot][c]) < 1e-12)
+        {
+            return false;
+        }
+        swap(m[c], m[pivot]);
+        for (size_t r = 0; r < n; r++)
+        {
+            if (r != c)
+            {
+                double factor = m[r][c] / m[c][c];
+                for (size_t k = c; k <= n; k++)
+                {
+                    m[r][k] -= factor * m[c][k];
+                }
+            }
+        }
+    }
+
+    solution = {{0, 0, 0}};
+    for (size_t r = 0; r < n; r++)
+    {
+        double value = m[r][n] / m[r][r] / scale[columns[r]];
+        if (value < 0)
+        {
+            return false;
+        }
+        solution[columns[r]] = value;
+    }
+    return true;
+}
+
+static runtime::CostModel::Coefficients
+    fit_coefficients(const vector<runtime::CostModel::Sample>& samples)
+{
+    vector<array<double, 3>> features;
+    vector<double> times;
+    vector<double> weights;
+    for (const runtime::CostModel::Sample& sample : samples)
+    {
+        features.push_back({{1.0, sample.flops, double(sample.bytes)}});
+        times.push_back(sample.microseconds);
+        // Minimize the relative error, so that small ops are predicted as well as large ones
+        weights.push_back(1.0 / pow(max(sample.microseconds, 1.0), 2));
+    }
+
+    // Flops and bytes are often proportional, so rather than a single fit of all three
+    // coefficients, take the best non-negative fit over every subset of them.
+    bool found = false;
+    double best_error = 0;
+    array<double, 3> best{{0, 0, 0}};
+    for (unsigned mask = 1; mask < 8; mask++)
+    {
+        array<double, 3> solution;
+        if (!solve_least_squares(features, times, weights, mask, solution))
+        {
+            continue;
+        }
+        double error = 0;
+        for (size_t i = 0; i < features.size(); i++)
+        {
+            double predicted = solution[0] + solution[1] * features[i][1] +
+                               solution[2] * features[i][2];
+            error += weights[i] * (predicted - times[i]) * (predicted - times[i]);
+        }
+        if (!found || error < best_error)
+        {
+            found = true;
+            best_error = error;
+            best = solution;
+        }
+    }
+    return {best[0], best[1], best[2]};
+}
+
+void runtime::CostModel::fit(const string& op_type, const vector<Sample>& samples)
+{
+    if (samples.empty())
+    {
+        throw ngraph_error("Cannot fit the cost of " + op_type + " without samples");
+    }
+    set_coefficients(op_type, fit_coefficients(samples));
+}
+
+// One op of every calibrated type at a few sizes, each on its own parameters
+static vector<shared_ptr<Node>> build_calibration_sweep()
+{
+    vector<shared_ptr<Node>> sweep;
+    auto parameter = [](const Shape& shape) {
+        return make_shared<op::Parameter>(element::f32, shape);
+    };
+
+    for (size_t n : {size_t(1) << 10, size_t(1) << 14, size_t(1) << 18})
+    {
+        Shape shape{n};
+        sweep.push_back(make_shared<op::Add>(parameter(shape), parameter(shape)));
+        sweep.push_back(make_shared<op::Subtract>(parameter(shape), parameter(shape)));
+        sweep.push_back(make_shared<op::Multiply>(parameter(shape), parameter(shape)));
+        sweep.push_back(make_shared<op::Divide>(parameter(shape), parameter(shape)));
+        sweep.push_back(make_shared<op::Maximum>(parameter(shape), parameter(shape)));
+        sweep.push_back(make_shared<op::Abs>(parameter(shape)));
+        sweep.push_back(make_shared<op::Negative>(parameter(shape)));
+        sweep.push_back(make_shared<op::Exp>(parameter(shape)));
+        sweep.push_back(make_shared<op::Sqrt>(parameter(shape)));
+        sweep.push_back(make_shared<op::Tanh>(parameter(shape)));
+        sweep.push_back(make_shared<op::Sigmoid>(parameter(shape)));
+        sweep.push_back(make_shared<op::Relu>(parameter(shape)));
+
+        Shape rows{n / 64, 64};
+        sweep.push_back(make_shared<op::Sum>(parameter(rows), AxisSet{1}));
+        sweep.push_back(make_shared<op::Softmax>(parameter(rows), AxisSet{1}));
+        sweep.push_back(
+            make_shared<op::Reshape>(parameter(rows), AxisVector{1, 0}, Shape{64, n / 64}));
+        sweep.push_back(make_shared<op::Broadcast>(parameter(Shape{n / 64}), rows, AxisSet{1}));
+        sweep.push_back(
+            make_shared<op::Slice>(parameter(rows), Coordinate{0, 0}, Coordinate{n / 128, 64}));
+        sweep.push_back(
+            make_shared<op::Concat>(NodeVector{parameter(shape), parameter(shape)}, 0));
+    }
+
+    for (size_t n : {16, 64, 128})
+    {
+        sweep.push_back(make_shared<op::Dot>(parameter(Shape{n, n}), parameter(Shape{n, n})));
+    }
+
+    for (size_t n : {8, 16, 32})
+    {
+        Shape image{1, 8, n, n};
+        sweep.push_back(
+            make_shared<op::Convolution>(parameter(image), parameter(Shape{8, 8, 3, 3})));
+        sweep.push_back(make_shared<op::MaxPool>(parameter(image), Shape{3, 3}));
+        sweep.push_back(make_shared<op::AvgPool>(parameter(image), Shape{3, 3}));
+    }
+
+    return sweep;
+}
+
+shared_ptr<runtime::CostModel> runtime::CostModel::calibrate(const string& backend_name,
+                                                             size_t iterations)
+{
+    auto backend = runtime::Backend::create(backend_name);
+    map<string, vector<Sample>> samples;
+    for (const shared_ptr<Node>& node : build_calibration_sweep())
+    {
+        op::ParameterVector parameters;
+        for (const shared_ptr<Node>& arg : node->get_arguments())
+        {
+            parameters.push_back(static_pointer_cast<op::Parameter>(arg));
+        }
+        auto f = make_shared<Function>(node, parameters);
+
+        vector<shared_ptr<runtime::Tensor>> inputs;
+        for (const shared_ptr<op::Parameter>& parameter : parameters)
+        {
+            auto tensor = backend->create_tensor(element::f32, parameter->get_shape());
+            vector<float> data(shape_size(parameter->get_shape()), 1.0f);
+            tensor->write(data.data(), 0, data.size() * sizeof(float));
+            inputs.push_back(tensor);
+        }
+        vector<shared_ptr<runtime::Tensor>> outputs{
+            backend->create_tensor(element::f32, node->get_shape())};
+
+        backend->enable_performance_data(f, true);
+        backend->compile(f);
+        backend->call(f, outputs, inputs);
+        stopwatch timer;
+        timer.start();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            backend->call(f, outputs, inputs);
+        }
+        timer.stop();
+
+        // Prefer the backend's own timing of the op, which leaves out the call overhead
+        double microseconds = double(timer.get_nanoseconds()) / 1000 / max<size_t>(iterations, 1);
+        for (const PerformanceCounter& counter : backend->get_performance_data(f))
+        {
+            if (counter.name() == node->get_name() && counter.total_microseconds() > 0)
+            {
+                microseconds = double(counter.total_microseconds()) / counter.call_count();
+            }
+        }
+        backend->remove_compiled_function(f);
+
+        samples[node->description()].push_back(
+            {get_flops(*node), get_bytes_moved(*node), microseconds});
+    }
+
+    auto model = make_shared<CostModel>(backend_name);
+    vector<Sample> all_samples;
+    for (const pair<const string, vector<Sample>>& op_samples : samples)
+    {
+        model->fit(op_samples.first, op_samples.second);
+        all_samples.insert(all_samples.end(), op_samples.second.begin(), op_samples.second.end());
+    }
+    // Ops outside the sweep fall back to a fit over all of it
+    model->set_default_coefficients(fit_coefficients(all_samples));
+    return model;
+}
+
+static json coefficients_to_json(const runtime::CostModel::Coefficients& coefficients)
+{
+    json j;
+    j["overhead_us"] = coefficients.overhead_us;
+    j["us_per_flop"] = coefficients.us_per_flop;
+    j["us_per_byte"] = coefficients.us_per_byte;
+    return j;
+}
+
+static runtime::CostModel::Coefficients coefficients_from_json(const json& j)
+{
+    return {j.at("overhead_us").get<double>(),
+            j.at("us_per_flop").get<double>(),
+            j.at("us_per_byte").get<double>()};
+}
+
+void runtime::CostModel::save(const string& path) const
+{
+    json j;
+    j["backend"] = m_backend_name;
+    j["default"] = coefficients_to_json(m_default_coefficients);
+    json ops = json::object();
+    for (const pair<const string, Coefficients>& op_coefficients : m_coefficients)
+    {
+        ops[op_coefficients.first] = coefficients_to_json(op_coefficients.second);
+    }
+    j["ops"] = ops;
+
+    ofstream out(path);
+    if (!out)
+    {
+        throw ngraph_error("Cannot write cost model to " + path);
+    }
+    out << j.dump(4) << "\n";
+}
+
+shared_ptr<runtime::CostModel> runtime::CostModel::load(const string& path)
+{
+    ifstream in(path);
+    if (!in)
+    {
+        throw ngraph_error("Cannot read cost model from " + path);
+    }
+    json j;
+    try
+    {
+        in >> j;
+        auto model = make_shared<CostModel>(j.at("backend").get<string>());
+        model->set_default_coefficients(coefficients_from_json(j.at("default")));
+        for (auto it = j.at("ops").begin(); it != j.at("ops").end(); ++it)
+        {
+            model->set_coefficients(it.key(), coefficients_from_json(it.value()));
+        }
+        return model;
+    }
+    catch (const json::exception& e)
+    {
+        throw ngraph_error("Malformed cost model " + path + ": " + e.what());
+    }
+}
+
+shared_ptr<runtime::CostModel> runtime::CostModel::get_default(const string& backend_name)
+{
+    // Each file is read once; callers get a copy they are free to change
+    static mutex loaded_mutex;
+    static map<string, shared_ptr<CostModel>> loaded;
+
+    if (const char* dir = getenv("NGRAPH_COST_MODEL_DIR"))
+    {
+        string path = file_util::path_join(dir, backend_name + ".json");
+        lock_guard<mutex> lock(loaded_mutex);
+        auto it = loaded.find(path);
+        if (it == loaded.end() && file_util::exists(path))
+        {
+            shared_ptr<CostModel> model;
+            try
+            {
+                model = load(path);
+            }
+            catch (const ngraph_error& e)
+            {
+                NGRAPH_WARN << e.what() << ", using the default cost model";
+                model = make_shared<CostModel>(backend_name);
+            }
+            it = loaded.emplace(path, model).first;
+        }
+        if (it != loaded.end())
+        {
+            return make_shared<CostModel>(*it->second);
+        }
+    }
+    return make_shared<CostModel>(backend_name);
+}
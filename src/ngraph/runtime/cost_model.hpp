@@ -0,0 +1,110 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ngraph
+{
+    class Function;
+    class Node;
+
+    namespace runtime
+    {
+        /// \brief Work done by one op and the time it is expected to take
+        struct OpCost
+        {
+            /// Arithmetic operations, counting a multiply-add as two
+            double flops = 0;
+            /// Bytes read from the inputs plus bytes written to the outputs
+            size_t bytes = 0;
+            /// Estimated execution time
+            double microseconds = 0;
+        };
+
+        /// \brief Predicts the execution time of ops on one backend.
+        ///
+        /// Each op type has a linear model,
+        /// time = overhead_us + flops * us_per_flop + bytes * us_per_byte,
+        /// whose coefficients are either defaults or fitted to a microbenchmark sweep run by
+        /// calibrate(). Models can be saved to and loaded from a file. Backends with a better
+        /// idea of their kernels can derive from CostModel and override get_cost.
+        class CostModel
+        {
+        public:
+            struct Coefficients
+            {
+                double overhead_us;
+                double us_per_flop;
+                double us_per_byte;
+            };
+
+            /// \brief One measurement of an op, used to fit its coefficients
+            struct Sample
+            {
+                double flops;
+                size_t bytes;
+                double microseconds;
+            };
+
+            CostModel(const std::string& backend_name = "");
+            virtual ~CostModel() {}
+            const std::string& get_backend_name() const { return m_backend_name; }
+            /// \returns The arithmetic operations performed by node, or 0 for data movement
+            static double get_flops(const Node& node);
+            /// \returns The bytes node reads and writes, or 0 if its shapes are not static
+            static size_t get_bytes_moved(const Node& node);
+
+            virtual OpCost get_cost(const Node& node) const;
+            /// \returns The summed cost of the ops of f
+            OpCost get_cost(const std::shared_ptr<Function>& f) const;
+
+            /// \returns The coefficients of an op type, or the default ones if it has none
+            const Coefficients& get_coefficients(const std::string& op_type) const;
+            void set_coefficients(const std::string& op_type, const Coefficients& coefficients);
+            void set_default_coefficients(const Coefficients& coefficients);
+            bool has_coefficients(const std::string& op_type) const;
+
+            /// \brief Fits the coefficients of an op type to measured samples with a
+            ///     non-negative least squares fit.
+            void fit(const std::string& op_type, const std::vector<Sample>& samples);
+
+            /// \brief Measures a sweep of op types and sizes on a backend and fits a model.
+            /// \param backend_name The backend to measure, as passed to Backend::create
+            /// \param iterations Timed calls per op and size, after one warm-up call
+            static std::shared_ptr<CostModel> calibrate(const std::string& backend_name,
+                                                        size_t iterations = 10);
+
+            void save(const std::string& path) const;
+            static std::shared_ptr<CostModel> load(const std::string& path);
+
+            /// \returns A copy of the model saved as <backend_name>.json in the directory named
+            ///     by NGRAPH_COST_MODEL_DIR, or a model with default coefficients if there is no
+            ///     such file or it can't be parsed. Each file is only read once.
+            static std::shared_ptr<CostModel> get_default(const std::string& backend_name);
+
+        private:
+            std::string m_backend_name;
+            Coefficients m_default_coefficients;
+            std::map<std::string, Coefficients> m_coefficients;
+        };
+    }
+}
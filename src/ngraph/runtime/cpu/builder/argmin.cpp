@@ -33,13 +33,12 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::ArgMin)
             {
                 auto& functors = external_function->get_functors();
-                auto& tensor_data = external_function->get_tensor_data();
 
                 const ngraph::op::ArgMin* argmin = static_cast<const ngraph::op::ArgMin*>(node);
                 CPUKernelFunctor functor;
 
-                auto& arg_tensor = tensor_data[args[0].get_name()];
-                auto& out_tensor = tensor_data[out[0].get_name()];
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 if (out[0].get_element_type() != element::i64 &&
                     out[0].get_element_type() != element::i32)
                 {
@@ -61,9 +60,20 @@ namespace ngraph
                         SELECT_RANK2(
                             kernel, float, int64_t, in_shape.size(), runtime::cpu::kernel::argmin);
 
-                        functor = [&, kernel, in_shape, out_shape, axis](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            kernel(arg_tensor, out_tensor, in_shape, out_shape, axis, ectx->arena);
+                        functor = [&,
+                                   kernel,
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   arg_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                            kernel(ctx->buffer_data[arg_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   ectx->arena);
                         };
                     }
                     else
@@ -73,9 +83,20 @@ namespace ngraph
                         SELECT_RANK2(
                             kernel, float, int, in_shape.size(), runtime::cpu::kernel::argmin);
 
-                        functor = [&, kernel, in_shape, out_shape, axis](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            kernel(arg_tensor, out_tensor, in_shape, out_shape, axis, ectx->arena);
+                        functor = [&,
+                                   kernel,
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   arg_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                            kernel(ctx->buffer_data[arg_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   ectx->arena);
                         };
                     }
                 }
@@ -89,9 +110,20 @@ namespace ngraph
                         SELECT_RANK2(
                             kernel, double, int64_t, in_shape.size(), runtime::cpu::kernel::argmin);
 
-                        functor = [&, kernel, in_shape, out_shape, axis](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            kernel(arg_tensor, out_tensor, in_shape, out_shape, axis, ectx->arena);
+                        functor = [&,
+                                   kernel,
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   arg_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                            kernel(ctx->buffer_data[arg_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   ectx->arena);
                         };
                     }
                     else
@@ -102,9 +134,20 @@ namespace ngraph
                         SELECT_RANK2(
                             kernel, double, int, in_shape.size(), runtime::cpu::kernel::argmin);
 
-                        functor = [&, kernel, in_shape, out_shape, axis](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            kernel(arg_tensor, out_tensor, in_shape, out_shape, axis, ectx->arena);
+                        functor = [&,
+                                   kernel,
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   arg_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                            kernel(ctx->buffer_data[arg_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   ectx->arena);
                         };
                     }
                 }
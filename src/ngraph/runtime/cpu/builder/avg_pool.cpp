@@ -39,8 +39,8 @@ namespace ngraph
                 auto arg0_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto window_shape = avg_pool->get_window_shape();
                 auto window_movement_strides = avg_pool->get_window_movement_strides();
@@ -68,10 +68,12 @@ namespace ngraph
 
                     auto& deps = mkldnn_emitter->get_primitive_deps(avg_pool_index);
 
-                    auto functor = [&, avg_pool_index](CPURuntimeContext* ctx,
-                                                       CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                    auto functor = [&, avg_pool_index, arg0_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, avg_pool_index);
                     };
                     functors.emplace_back(functor);
@@ -91,10 +93,12 @@ namespace ngraph
                                     window_movement_strides,
                                     padding_below,
                                     padding_above,
-                                    include_padding_in_avg_computation](CPURuntimeContext* ctx,
-                                                                        CPUExecutionContext* ectx) {
-                        kernel(arg0_tensor,
-                               out_tensor,
+                                    include_padding_in_avg_computation,
+                                    arg0_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
                                arg0_shape,
                                out_shape,
                                window_shape,
@@ -117,8 +121,8 @@ namespace ngraph
                 auto delta_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
 
-                auto& delta_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto delta_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto window_shape = apb->get_window_shape();
                 auto window_movement_strides = apb->get_window_movement_strides();
@@ -145,10 +149,12 @@ namespace ngraph
                         apb->get_padding_above());
 
                     auto& deps = mkldnn_emitter->get_primitive_deps(avg_pool_index);
-                    auto functor = [&, avg_pool_index](CPURuntimeContext* ctx,
-                                                       CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], delta_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                    auto functor = [&, avg_pool_index, out_buffer_index, delta_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[delta_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, avg_pool_index);
                     };
                     functors.emplace_back(functor);
@@ -167,10 +173,12 @@ namespace ngraph
                                     window_movement_strides,
                                     padding_below,
                                     padding_above,
-                                    include_padding_in_avg_computation](CPURuntimeContext* ctx,
-                                                                        CPUExecutionContext* ectx) {
-                        kernel(delta_tensor,
-                               out_tensor,
+                                    include_padding_in_avg_computation,
+                                    out_buffer_index,
+                                    delta_buffer_index](CPURuntimeContext* ctx,
+                                                        CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[delta_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
                                delta_shape,
                                out_shape,
                                window_shape,
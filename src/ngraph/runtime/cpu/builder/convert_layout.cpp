@@ -35,8 +35,8 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
 
@@ -78,10 +78,12 @@ namespace ngraph
                 size_t reorder_index = mkldnn_emitter->build_reorder(input_desc, result_desc);
 
                 auto& deps = mkldnn_emitter->get_primitive_deps(reorder_index);
-                auto functor = [&, reorder_index](CPURuntimeContext* ctx,
-                                                  CPUExecutionContext* ectx) {
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                auto functor = [&, reorder_index, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                     cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, reorder_index);
                 };
                 functors.emplace_back(functor);
@@ -14,10 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <mutex>
+
 #include "ngraph/op/function_call.hpp"
-#include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -33,28 +36,19 @@ namespace ngraph
             {
                 auto function_call = static_cast<const ngraph::op::FunctionCall*>(node);
                 auto function = function_call->get_functions()[0];
-                shared_ptr<runtime::Backend> backend = runtime::Backend::create("CPU");
 
                 auto& functors = external_function->get_functors();
                 auto& callees = external_function->get_callees();
 
-                // Note: We bypass the completely broken ngraph "backend" API here
-                vector<reference_wrapper<void *>> arg_tensors, out_tensors;
-                vector<Shape> arg_shapes, out_shapes;
-                vector<element::Type> arg_types, out_types;
-
+                vector<size_t> arg_indices, out_indices;
                 for (const auto& arg : args)
                 {
-                    arg_shapes.emplace_back(arg.get_shape());
-                    arg_types.emplace_back(arg.get_element_type());
-                    arg_tensors.emplace_back(external_function->get_tensor_data(arg.get_name()));
+                    arg_indices.emplace_back(external_function->get_buffer_index(arg.get_name()));
                 }
-
                 for (const auto& result : out)
                 {
-                    out_shapes.emplace_back(result.get_shape());
-                    out_types.emplace_back(result.get_element_type());
-                    out_tensors.emplace_back(external_function->get_tensor_data(result.get_name()));
+                    out_indices.emplace_back(
+                        external_function->get_buffer_index(result.get_name()));
                 }
 
                 if (!callees.count(function->get_name()))
@@ -64,28 +58,66 @@ namespace ngraph
 
                 auto& callee_external_function = callees[function->get_name()];
 
-                auto functor = [&,
-                                backend,
-                                arg_shapes,
-                                arg_types,
-                                arg_tensors,
-                                out_shapes,
-                                out_types,
-                                out_tensors](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                    TensorViewPtrs inputs, outputs;
-                    for (int i = 0; i < arg_shapes.size(); i++)
+                // Idle call frames of the callee. Each call takes one, preferring a frame whose
+                // memory is on the NUMA node of its arena, so concurrent calls of the caller
+                // run the callee in parallel.
+                auto callee_call_frames = make_shared<vector<shared_ptr<CPU_CallFrame>>>();
+                auto callee_mutex = make_shared<mutex>();
+
+                auto functor = [&, arg_indices, out_indices, callee_call_frames, callee_mutex](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    vector<void*> inputs, outputs;
+                    for (size_t index : arg_indices)
                     {
-                        inputs.emplace_back(
-                            backend->create_tensor(arg_types[i], arg_shapes[i], arg_tensors[i]));
+                        inputs.push_back(ctx->buffer_data[index]);
                     }
-                    for (int i = 0; i < out_shapes.size(); i++)
+                    for (size_t index : out_indices)
                     {
-                        outputs.emplace_back(
-                            backend->create_tensor(out_types[i], out_shapes[i], out_tensors[i]));
+                        outputs.push_back(ctx->buffer_data[index]);
                     }
 
-                    auto call_frame = callee_external_function->make_call_frame();
-                    call_frame->call(outputs, inputs);
+                    int numa_node = executor::GetCPUExecutor().get_numa_node(ectx->arena);
+                    shared_ptr<CPU_CallFrame> call_frame;
+                    {
+                        lock_guard<mutex> lock(*callee_mutex);
+                        auto& frames = *callee_call_frames;
+                        auto it = find_if(frames.begin(),
+                                          frames.end(),
+                                          [numa_node](const shared_ptr<CPU_CallFrame>& f) {
+                                              return f->get_numa_node() == numa_node;
+                                          });
+                        if (it == frames.end())
+                        {
+                            it = find_if(frames.begin(),
+                                         frames.end(),
+                                         [](const shared_ptr<CPU_CallFrame>& f) {
+                                             return f->get_numa_node() < 0;
+                                         });
+                        }
+                        if (it != frames.end())
+                        {
+                            call_frame = *it;
+                            frames.erase(it);
+                        }
+                    }
+                    if (!call_frame)
+                    {
+                        call_frame = callee_external_function->make_call_frame();
+                    }
+                    auto release = [&]() {
+                        lock_guard<mutex> lock(*callee_mutex);
+                        callee_call_frames->push_back(call_frame);
+                    };
+                    try
+                    {
+                        call_frame->call(outputs, inputs, ectx->arena);
+                    }
+                    catch (...)
+                    {
+                        release();
+                        throw;
+                    }
+                    release();
                 };
                 functors.emplace_back(functor);
             }
@@ -0,0 +1,230 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/loop_kernel.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            using namespace kernel::loop_kernel;
+
+            static const unordered_map<type_index, Opcode> s_opcodes{
+                {TI(ngraph::op::Abs), Opcode::Abs},
+                {TI(ngraph::op::Add), Opcode::Add},
+                {TI(ngraph::op::Divide), Opcode::Divide},
+                {TI(ngraph::op::Exp), Opcode::Exp},
+                {TI(ngraph::op::Maximum), Opcode::Maximum},
+                {TI(ngraph::op::Minimum), Opcode::Minimum},
+                {TI(ngraph::op::Multiply), Opcode::Multiply},
+                {TI(ngraph::op::Negative), Opcode::Negative},
+                {TI(ngraph::op::Relu), Opcode::Relu},
+                {TI(ngraph::op::Sigmoid), Opcode::Sigmoid},
+                {TI(ngraph::op::Sqrt), Opcode::Sqrt},
+                {TI(ngraph::op::Subtract), Opcode::Subtract},
+                {TI(ngraph::op::Tanh), Opcode::Tanh}};
+
+            // Translates the nodes of a loop kernel into instructions over slots. Intermediate
+            // values get scratch registers, which are reused once their last reader has run.
+            static Program compile_loop_kernel(const ngraph::runtime::cpu::op::LoopKernel& lk)
+            {
+                Program program;
+                unordered_map<const Node*, size_t> slots;
+
+                const NodeVector& inputs = lk.get_kernel_inputs();
+                for (size_t i = 0; i < inputs.size(); i++)
+                {
+                    if (slots.count(inputs[i].get()) == 0)
+                    {
+                        slots[inputs[i].get()] = program.slots.size();
+                        program.slots.push_back({Slot::Kind::Input, i, false, 0, 1, 1});
+                    }
+                }
+
+                unordered_map<const Node*, size_t> outputs;
+                for (size_t i = 0; i < lk.get_kernel_outputs().size(); i++)
+                {
+                    outputs[lk.get_kernel_outputs()[i].get()] = i;
+                }
+
+                // Index of the last instruction reading each node
+                unordered_map<const Node*, size_t> last_use;
+                const NodeVector& nodes = lk.get_node_list();
+                for (size_t i = 0; i < nodes.size(); i++)
+                {
+                    for (const shared_ptr<Node>& arg : nodes[i]->get_arguments())
+                    {
+                        last_use[arg.get()] = i;
+                    }
+                }
+
+                vector<size_t> free_registers;
+                auto allocate_slot = [&](const Node* node, bool broadcast) {
+                    Slot slot{Slot::Kind::Register, 0, broadcast, 0, 1, 1};
+                    auto output = outputs.find(node);
+                    if (output != outputs.end())
+                    {
+                        slot.kind = Slot::Kind::Output;
+                        slot.index = output->second;
+                    }
+                    else if (!broadcast && !free_registers.empty())
+                    {
+                        slot.index = free_registers.back();
+                        free_registers.pop_back();
+                    }
+                    else
+                    {
+                        // Broadcasts are filled at the start of every block, so their registers
+                        // are never reused
+                        slot.index = program.register_count++;
+                    }
+                    slots[node] = program.slots.size();
+                    program.slots.push_back(slot);
+                    return program.slots.size() - 1;
+                };
+
+                for (size_t i = 0; i < nodes.size(); i++)
+                {
+                    const Node& node = *nodes[i];
+                    if (auto broadcast = dynamic_cast<const ngraph::op::Broadcast*>(&node))
+                    {
+                        Slot source = program.slots.at(slots.at(node.get_argument(0).get()));
+                        if (source.kind != Slot::Kind::Input)
+                        {
+                            throw ngraph_error("Loop kernels only broadcast their inputs");
+                        }
+                        size_t slot = allocate_slot(&node, true);
+                        program.slots[slot].source = source.index;
+                        if (!ngraph::runtime::cpu::op::LoopKernel::is_contiguous_broadcast(
+                                *broadcast, program.slots[slot].inner, program.slots[slot].size))
+                        {
+                            throw ngraph_error("Unsupported broadcast in loop kernel");
+                        }
+                        continue;
+                    }
+
+                    auto opcode = s_opcodes.find(TI(node));
+                    if (opcode == s_opcodes.end())
+                    {
+                        throw ngraph_error("Unsupported op in loop kernel: " + node.description());
+                    }
+                    size_t arg0 = slots.at(node.get_argument(0).get());
+                    size_t arg1 =
+                        node.get_input_size() > 1 ? slots.at(node.get_argument(1).get()) : arg0;
+
+                    // Release the registers of values read for the last time, so the result
+                    // can overwrite one of them
+                    for (const shared_ptr<Node>& arg : node.get_arguments())
+                    {
+                        auto it = slots.find(arg.get());
+                        const Slot& slot = program.slots[it->second];
+                        if (slot.kind == Slot::Kind::Register && !slot.broadcast &&
+                            last_use.at(arg.get()) == i &&
+                            find(free_registers.begin(), free_registers.end(), slot.index) ==
+                                free_registers.end())
+                        {
+                            free_registers.push_back(slot.index);
+                        }
+                    }
+
+                    size_t result = allocate_slot(&node, false);
+                    program.instructions.push_back({opcode->second, result, arg0, arg1});
+                }
+                return program;
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::runtime::cpu::op::LoopKernel)
+            {
+                auto& functors = external_function->get_functors();
+                auto lk = static_cast<const ngraph::runtime::cpu::op::LoopKernel*>(node);
+
+                // Point the input and output slots straight at the function's buffers, so
+                // a call needs no per-kernel pointer tables
+                auto program = make_shared<Program>(compile_loop_kernel(*lk));
+                for (Slot& slot : program->slots)
+                {
+                    if (slot.kind == Slot::Kind::Input)
+                    {
+                        slot.index =
+                            external_function->get_buffer_index(args[slot.index].get_name());
+                    }
+                    else if (slot.kind == Slot::Kind::Output)
+                    {
+                        slot.index =
+                            external_function->get_buffer_index(out[slot.index].get_name());
+                    }
+                    if (slot.broadcast)
+                    {
+                        slot.source =
+                            external_function->get_buffer_index(args[slot.source].get_name());
+                    }
+                }
+                size_t count = out[0].get_size();
+
+                std::function<decltype(loop_kernel<float>)> kernel;
+                if (out[0].get_element_type() == element::f32)
+                {
+                    kernel = loop_kernel<float>;
+                }
+                else if (out[0].get_element_type() == element::f64)
+                {
+                    kernel = loop_kernel<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       out[0].get_element_type().c_type_string() +
+                                       " for loop kernel");
+                }
+
+                auto functor = [&, kernel, program, count](CPURuntimeContext* ctx,
+                                                           CPUExecutionContext* ectx) {
+                    kernel(*program, ctx->buffer_data, count, ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+        }
+    }
+}
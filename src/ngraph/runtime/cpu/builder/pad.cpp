@@ -35,9 +35,10 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& padding_value = external_function->get_tensor_data(args[1].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto padding_value_buffer_index =
+                    external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto pad = static_cast<const ngraph::op::Pad*>(node);
 
@@ -55,11 +56,19 @@ namespace ngraph
                                           arg_shape.size(),
                                           runtime::cpu::kernel::pad);
 
-                    auto functor = [&, kernel, arg_shape, out_shape, padding_below, padding_above](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        kernel(arg_tensor,
-                               out_tensor,
-                               padding_value,
+                    auto functor = [&,
+                                    kernel,
+                                    arg_shape,
+                                    out_shape,
+                                    padding_below,
+                                    padding_above,
+                                    arg_buffer_index,
+                                    padding_value_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               ctx->buffer_data[padding_value_buffer_index],
                                arg_shape,
                                out_shape,
                                padding_below,
@@ -82,11 +91,14 @@ namespace ngraph
                                     out_shape,
                                     padding_below,
                                     padding_above,
-                                    padding_interior](CPURuntimeContext* ctx,
+                                    padding_interior,
+                                    arg_buffer_index,
+                                    padding_value_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        kernel(arg_tensor,
-                               padding_value,
-                               out_tensor,
+                        kernel(ctx->buffer_data[arg_buffer_index],
+                               ctx->buffer_data[padding_value_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
                                arg_shape,
                                out_shape,
                                padding_below,
@@ -38,7 +38,6 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::Dequantize)
             {
                 auto& functors = external_function->get_functors();
-                auto& tensor_data = external_function->get_tensor_data();
 
                 const ngraph::op::Dequantize* dequantize =
                     static_cast<const ngraph::op::Dequantize*>(node);
@@ -46,28 +45,34 @@ namespace ngraph
 
                 if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
                 {
-                    auto& arg0_tensor = tensor_data[args[0].get_name()];
-                    auto& out_tensor = tensor_data[out[0].get_name()];
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                     auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 0);
                     auto result_desc = mkldnn_utils::get_output_mkldnn_md(node, 0);
                     size_t dequantize_index =
                         mkldnn_emitter->build_dequantization(node, input_desc, result_desc);
                     auto& deps = mkldnn_emitter->get_primitive_deps(dequantize_index);
-                    functor = [&, dequantize_index](CPURuntimeContext* ctx,
-                                                    CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                    functor = [&, dequantize_index, arg0_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, dequantize_index);
                     };
                     functors.emplace_back(functor);
                 }
                 else
                 {
-                    auto& arg0_tensor = tensor_data[args[0].get_name()];
-                    auto& arg1_tensor = tensor_data[args[1].get_name()];
-                    auto& arg2_tensor = tensor_data[args[2].get_name()];
-                    auto& out_tensor = tensor_data[out[0].get_name()];
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto arg2_buffer_index =
+                        external_function->get_buffer_index(args[2].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                     auto arg0_shape = args[0].get_shape();
                     auto arg1_shape = args[1].get_shape();
                     auto daxes = dequantize->get_axes();
@@ -76,13 +81,20 @@ namespace ngraph
                     {
                         if (out[0].get_element_type() == element::f32)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       arg0_buffer_index,
+                                       out_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::dequantize<int8_t>(
-                                    static_cast<int8_t*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<int8_t*>(arg2_tensor),
-                                    static_cast<float*>(out_tensor),
+                                    static_cast<int8_t*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<int8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes);
@@ -90,13 +102,20 @@ namespace ngraph
                         }
                         else if (out[0].get_element_type() == element::f64)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       arg0_buffer_index,
+                                       out_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::dequantize<int8_t>(
-                                    static_cast<int8_t*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<int8_t*>(arg2_tensor),
-                                    static_cast<double*>(out_tensor),
+                                    static_cast<int8_t*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<int8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes);
@@ -111,13 +130,20 @@ namespace ngraph
                     {
                         if (out[0].get_element_type() == element::f32)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       arg0_buffer_index,
+                                       out_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::dequantize<uint8_t>(
-                                    static_cast<uint8_t*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<uint8_t*>(arg2_tensor),
-                                    static_cast<float*>(out_tensor),
+                                    static_cast<uint8_t*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<uint8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes);
@@ -125,13 +151,20 @@ namespace ngraph
                         }
                         else if (out[0].get_element_type() == element::f64)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       arg0_buffer_index,
+                                       out_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::dequantize<uint8_t>(
-                                    static_cast<uint8_t*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<uint8_t*>(arg2_tensor),
-                                    static_cast<double*>(out_tensor),
+                                    static_cast<uint8_t*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<uint8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes);
@@ -157,8 +190,9 @@ namespace ngraph
                 {
                     auto quantize = static_cast<const ngraph::op::Quantize*>(node);
                     auto& functors = external_function->get_functors();
-                    auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                    auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                     auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 0);
                     auto result_desc = mkldnn_utils::get_output_mkldnn_md(node, 0);
@@ -176,10 +210,12 @@ namespace ngraph
                     size_t quantize_index =
                         mkldnn_emitter->build_quantize_reorder(input_desc, result_desc, scales);
                     auto& deps = mkldnn_emitter->get_primitive_deps(quantize_index);
-                    auto functor = [&, quantize_index](CPURuntimeContext* ctx,
-                                                       CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                    auto functor = [&, quantize_index, arg0_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, quantize_index);
                     };
                     functors.emplace_back(functor);
@@ -187,16 +223,18 @@ namespace ngraph
                 else
                 {
                     auto& functors = external_function->get_functors();
-                    auto& tensor_data = external_function->get_tensor_data();
 
                     const ngraph::op::Quantize* quantize =
                         static_cast<const ngraph::op::Quantize*>(node);
                     CPUKernelFunctor functor;
 
-                    auto& arg0_tensor = tensor_data[args[0].get_name()];
-                    auto& arg1_tensor = tensor_data[args[1].get_name()];
-                    auto& arg2_tensor = tensor_data[args[2].get_name()];
-                    auto& out_tensor = tensor_data[out[0].get_name()];
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto arg2_buffer_index =
+                        external_function->get_buffer_index(args[2].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                     auto arg0_shape = args[0].get_shape();
                     auto arg1_shape = args[1].get_shape();
@@ -207,13 +245,21 @@ namespace ngraph
                     {
                         if (out[0].get_element_type() == element::i8)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       round_mode,
+                                       arg0_buffer_index,
+                                       out_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::quantize<float>(
-                                    static_cast<float*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<int8_t*>(arg2_tensor),
-                                    static_cast<int8_t*>(out_tensor),
+                                    static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<int8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<int8_t*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
@@ -222,13 +268,21 @@ namespace ngraph
                         }
                         else if (out[0].get_element_type() == element::u8)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       round_mode,
+                                       arg0_buffer_index,
+                                       out_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::quantize<float>(
-                                    static_cast<float*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<uint8_t*>(arg2_tensor),
-                                    static_cast<uint8_t*>(out_tensor),
+                                    static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<uint8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<uint8_t*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
@@ -244,13 +298,21 @@ namespace ngraph
                     {
                         if (out[0].get_element_type() == element::i8)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       round_mode,
+                                       arg0_buffer_index,
+                                       out_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::quantize<double>(
-                                    static_cast<double*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<int8_t*>(arg2_tensor),
-                                    static_cast<int8_t*>(out_tensor),
+                                    static_cast<double*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<int8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<int8_t*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
@@ -259,13 +321,21 @@ namespace ngraph
                         }
                         else if (out[0].get_element_type() == element::u8)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       round_mode,
+                                       arg0_buffer_index,
+                                       out_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::quantize<double>(
-                                    static_cast<double*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<uint8_t*>(arg2_tensor),
-                                    static_cast<uint8_t*>(out_tensor),
+                                    static_cast<double*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<uint8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<uint8_t*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
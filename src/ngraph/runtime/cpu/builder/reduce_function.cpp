@@ -45,9 +45,9 @@ namespace ngraph
                 }
                 auto& reducer_external_function = callees[function->get_name()];
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto arg0_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
@@ -57,8 +57,11 @@ namespace ngraph
                 if (reduction_axes.empty())
                 {
                     size_t size = args[0].get_size() * args[0].get_element_type().size();
-                    auto functor = [&, size](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        memcpy(out_tensor, arg0_tensor, size);
+                    auto functor = [&, size, arg0_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        memcpy(ctx->buffer_data[out_buffer_index],
+                               ctx->buffer_data[arg0_buffer_index],
+                               size);
                     };
                     functors.emplace_back(functor);
                 }
@@ -72,11 +75,18 @@ namespace ngraph
                                           arg0_shape.size(),
                                           runtime::cpu::kernel::reduce_function_1rd);
 
-                    auto functor = [&, kernel, arg0_shape, out_shape, reduction_axes](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        kernel(arg0_tensor,
-                               arg1_tensor,
-                               out_tensor,
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    out_shape,
+                                    reduction_axes,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
                                arg0_shape,
                                out_shape,
                                reduction_axes,
@@ -94,11 +104,18 @@ namespace ngraph
                                   args[0].get_element_type(),
                                   runtime::cpu::kernel::reduce_function_2d_2rd);
 
-                    auto functor = [&, kernel, arg0_shape, out_shape, reduction_axes](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        kernel(arg0_tensor,
-                               arg1_tensor,
-                               out_tensor,
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    out_shape,
+                                    reduction_axes,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
                                arg0_shape,
                                out_shape,
                                reduction_axes,
@@ -116,11 +133,18 @@ namespace ngraph
                                   args[0].get_element_type(),
                                   runtime::cpu::kernel::reduce_function_3d_2rd);
 
-                    auto functor = [&, kernel, arg0_shape, out_shape, reduction_axes](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        kernel(arg0_tensor,
-                               arg1_tensor,
-                               out_tensor,
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    out_shape,
+                                    reduction_axes,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
                                arg0_shape,
                                out_shape,
                                reduction_axes,
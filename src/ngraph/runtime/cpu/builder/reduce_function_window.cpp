@@ -44,9 +44,9 @@ namespace ngraph
                 }
                 auto& reducer_external_function = callees[function->get_name()];
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto arg0_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
@@ -61,11 +61,18 @@ namespace ngraph
                               runtime::cpu::kernel::reduce_function_window);
 
                 auto functor =
-                    [&, kernel, arg0_shape, out_shape, window_shape, window_movement_strides](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        kernel(arg0_tensor,
-                               arg1_tensor,
-                               out_tensor,
+                    [&,
+                     kernel,
+                     arg0_shape,
+                     out_shape,
+                     window_shape,
+                     window_movement_strides,
+                     arg0_buffer_index,
+                     arg1_buffer_index,
+                     out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
                                arg0_shape,
                                out_shape,
                                window_shape,
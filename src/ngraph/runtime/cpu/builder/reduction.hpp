@@ -17,8 +17,8 @@
 #define BUILD_REDUCTION_FUNCTOR(OP, K)                                                             \
     auto& functors = external_function->get_functors();                                            \
                                                                                                    \
-    auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());                     \
-    auto& out_tensor = external_function->get_tensor_data(out[0].get_name());                      \
+    auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());               \
+    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());                \
                                                                                                    \
     auto op = static_cast<const ngraph::op::OP*>(node);                                            \
                                                                                                    \
@@ -33,8 +33,9 @@
     if (reduction_axes.empty())                                                                    \
     {                                                                                              \
         size_t size = out[0].get_size() * out[0].get_element_type().size();                        \
-        auto functor = [&, size](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {              \
-            memcpy(out_tensor, arg_tensor, size);                                                  \
+        auto functor = [&, size, arg_buffer_index, out_buffer_index](                              \
+            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
+            memcpy(ctx->buffer_data[out_buffer_index], ctx->buffer_data[arg_buffer_index], size);  \
         };                                                                                         \
         functors.emplace_back(functor);                                                            \
         return;                                                                                    \
@@ -45,9 +46,13 @@
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_all<float, 2>)> kernel;          \
         SELECT_KERNEL_BY_RANK(                                                                     \
             kernel, result_element_type, arg_rank, runtime::cpu::kernel::reduce_##K##_all);        \
-        auto functor = [&, kernel, arg_shape, result_shape](CPURuntimeContext* ctx,                \
-                                                            CPUExecutionContext* ectx) {           \
-            kernel(arg_tensor, out_tensor, arg_shape, result_shape, ectx->arena);                  \
+        auto functor = [&, kernel, arg_shape, result_shape, arg_buffer_index, out_buffer_index](   \
+            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
+            kernel(ctx->buffer_data[arg_buffer_index],                                             \
+                   ctx->buffer_data[out_buffer_index],                                             \
+                   arg_shape,                                                                      \
+                   result_shape,                                                                   \
+                   ectx->arena);                                                                   \
         };                                                                                         \
         functors.emplace_back(functor);                                                            \
         return;                                                                                    \
@@ -63,9 +68,18 @@
                                   result_element_type,                                             \
                                   arg_rank,                                                        \
                                   runtime::cpu::kernel::reduce_##K##_innermost_1rd);               \
-            auto functor = [&, kernel, arg_shape, result_shape](CPURuntimeContext* ctx,            \
-                                                                CPUExecutionContext* ectx) {       \
-                kernel(arg_tensor, out_tensor, arg_shape, result_shape, ectx->arena);              \
+            auto functor = [&,                                                                     \
+                            kernel,                                                                \
+                            arg_shape,                                                             \
+                            result_shape,                                                          \
+                            arg_buffer_index,                                                      \
+                            out_buffer_index](                                                     \
+                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                               \
+                kernel(ctx->buffer_data[arg_buffer_index],                                         \
+                       ctx->buffer_data[out_buffer_index],                                         \
+                       arg_shape,                                                                  \
+                       result_shape,                                                               \
+                       ectx->arena);                                                               \
             };                                                                                     \
             functors.emplace_back(functor);                                                        \
             return;                                                                                \
@@ -74,9 +88,20 @@
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_1rd<float, 2>)> kernel;          \
         SELECT_KERNEL_BY_RANK(                                                                     \
             kernel, result_element_type, arg_rank, runtime::cpu::kernel::reduce_##K##_1rd);        \
-        auto functor = [&, kernel, arg_shape, result_shape, reduction_axes](                       \
+        auto functor = [&,                                                                         \
+                        kernel,                                                                    \
+                        arg_shape,                                                                 \
+                        result_shape,                                                              \
+                        reduction_axes,                                                            \
+                        arg_buffer_index,                                                          \
+                        out_buffer_index](                                                         \
             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
-            kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes, ectx->arena);  \
+            kernel(ctx->buffer_data[arg_buffer_index],                                             \
+                   ctx->buffer_data[out_buffer_index],                                             \
+                   arg_shape,                                                                      \
+                   result_shape,                                                                   \
+                   reduction_axes,                                                                 \
+                   ectx->arena);                                                                   \
         };                                                                                         \
         functors.emplace_back(functor);                                                            \
         return;                                                                                    \
@@ -86,9 +111,20 @@
     {                                                                                              \
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_3d_2rd<float>)> kernel;          \
         SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_3d_2rd);     \
-        auto functor = [&, kernel, arg_shape, result_shape, reduction_axes](                       \
+        auto functor = [&,                                                                         \
+                        kernel,                                                                    \
+                        arg_shape,                                                                 \
+                        result_shape,                                                              \
+                        reduction_axes,                                                            \
+                        arg_buffer_index,                                                          \
+                        out_buffer_index](                                                         \
             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
-            kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes, ectx->arena);  \
+            kernel(ctx->buffer_data[arg_buffer_index],                                             \
+                   ctx->buffer_data[out_buffer_index],                                             \
+                   arg_shape,                                                                      \
+                   result_shape,                                                                   \
+                   reduction_axes,                                                                 \
+                   ectx->arena);                                                                   \
         };                                                                                         \
         functors.emplace_back(functor);                                                            \
         return;                                                                                    \
@@ -98,9 +134,20 @@
     {                                                                                              \
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_4d_2rd<float>)> kernel;          \
         SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_4d_2rd);     \
-        auto functor = [&, kernel, arg_shape, result_shape, reduction_axes](                       \
+        auto functor = [&,                                                                         \
+                        kernel,                                                                    \
+                        arg_shape,                                                                 \
+                        result_shape,                                                              \
+                        reduction_axes,                                                            \
+                        arg_buffer_index,                                                          \
+                        out_buffer_index](                                                         \
             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
-            kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes, ectx->arena);  \
+            kernel(ctx->buffer_data[arg_buffer_index],                                             \
+                   ctx->buffer_data[out_buffer_index],                                             \
+                   arg_shape,                                                                      \
+                   result_shape,                                                                   \
+                   reduction_axes,                                                                 \
+                   ectx->arena);                                                                   \
         };                                                                                         \
         functors.emplace_back(functor);                                                            \
         return;                                                                                    \
@@ -110,9 +157,20 @@
     {                                                                                              \
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_5d_2rd<float>)> kernel;          \
         SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_5d_2rd);     \
-        auto functor = [&, kernel, arg_shape, result_shape, reduction_axes](                       \
+        auto functor = [&,                                                                         \
+                        kernel,                                                                    \
+                        arg_shape,                                                                 \
+                        result_shape,                                                              \
+                        reduction_axes,                                                            \
+                        arg_buffer_index,                                                          \
+                        out_buffer_index](                                                         \
             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
-            kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes, ectx->arena);  \
+            kernel(ctx->buffer_data[arg_buffer_index],                                             \
+                   ctx->buffer_data[out_buffer_index],                                             \
+                   arg_shape,                                                                      \
+                   result_shape,                                                                   \
+                   reduction_axes,                                                                 \
+                   ectx->arena);                                                                   \
         };                                                                                         \
         functors.emplace_back(functor);                                                            \
         return;                                                                                    \
@@ -122,8 +180,19 @@
                                                                                                    \
     SELECT_KERNEL(ref_kernel, result_element_type, runtime::cpu::kernel::K);                       \
                                                                                                    \
-    auto functor = [&, ref_kernel, arg_shape, result_shape, reduction_axes](                       \
+    auto functor = [&,                                                                             \
+                    ref_kernel,                                                                    \
+                    arg_shape,                                                                     \
+                    result_shape,                                                                  \
+                    reduction_axes,                                                                \
+                    arg_buffer_index,                                                              \
+                    out_buffer_index](                                                             \
         CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                       \
-        ref_kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes, ectx->arena);  \
+        ref_kernel(ctx->buffer_data[arg_buffer_index],                                             \
+                   ctx->buffer_data[out_buffer_index],                                             \
+                   arg_shape,                                                                      \
+                   result_shape,                                                                   \
+                   reduction_axes,                                                                 \
+                   ectx->arena);                                                                   \
     };                                                                                             \
     functors.emplace_back(functor);
@@ -36,8 +36,8 @@ namespace ngraph
                 {
                     auto& functors = external_function->get_functors();
 
-                    auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                    auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                    auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                     auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 0);
@@ -47,10 +47,12 @@ namespace ngraph
 
                     auto& deps = mkldnn_emitter->get_primitive_deps(relu_index);
 
-                    auto functor = [&, relu_index](CPURuntimeContext* ctx,
-                                                   CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                    auto functor = [&, relu_index, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, relu_index);
                     };
                     functors.emplace_back(functor);
@@ -66,9 +68,9 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg_fwd_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& delta_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_fwd_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto delta_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 size_t count = out[0].get_size();
 
                 if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
@@ -82,11 +84,18 @@ namespace ngraph
                         mkldnn_emitter->build_relu_backward(input_desc, delta_desc, result_desc);
 
                     auto& deps = mkldnn_emitter->get_primitive_deps(relu_index);
-                    auto functor = [&, relu_index](CPURuntimeContext* ctx,
-                                                   CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg_fwd_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], delta_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out_tensor);
+                    auto functor = [&,
+                                    relu_index,
+                                    out_buffer_index,
+                                    arg_fwd_buffer_index,
+                                    delta_buffer_index](CPURuntimeContext* ctx,
+                                                        CPUExecutionContext* ectx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg_fwd_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[delta_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[2], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, relu_index);
                     };
                     functors.emplace_back(functor);
@@ -98,9 +107,18 @@ namespace ngraph
                     SELECT_KERNEL(
                         kernel, out[0].get_element_type(), runtime::cpu::kernel::relu_backprop);
 
-                    auto functor = [&, kernel, count](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* ectx) {
-                        kernel(arg_fwd_tensor, delta_tensor, out_tensor, count, ectx->arena);
+                    auto functor = [&,
+                                    kernel,
+                                    count,
+                                    out_buffer_index,
+                                    arg_fwd_buffer_index,
+                                    delta_buffer_index](CPURuntimeContext* ctx,
+                                                        CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg_fwd_buffer_index],
+                               ctx->buffer_data[delta_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               count,
+                               ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
@@ -32,11 +32,11 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& arg2_tensor = external_function->get_tensor_data(args[2].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
 
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto element_count = args[0].get_size();
 
@@ -44,12 +44,18 @@ namespace ngraph
 
                 SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::select);
 
-                auto functor = [&, kernel, element_count](CPURuntimeContext* ctx,
-                                                          CPUExecutionContext* ectx) {
-                    kernel(arg0_tensor,
-                           arg1_tensor,
-                           arg2_tensor,
-                           out_tensor,
+                auto functor = [&,
+                                kernel,
+                                element_count,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[arg2_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
                            element_count,
                            ectx->arena);
                 };
@@ -36,8 +36,8 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 const ngraph::op::Slice* slice = static_cast<const ngraph::op::Slice*>(node);
 
@@ -64,14 +64,19 @@ namespace ngraph
                         auto arg_size = shape_size(arg_shape) * element_size;
                         auto offset = start * element_size;
 
-                        auto functor = [&, out_size, arg_size, offset](CPURuntimeContext* ctx,
-                                                                       CPUExecutionContext* ectx) {
-                            if (out_tensor < arg_tensor ||
-                                out_tensor >= reinterpret_cast<char*>(arg_tensor) + arg_size)
+                        auto functor = [&,
+                                        out_size,
+                                        arg_size,
+                                        offset,
+                                        arg_buffer_index,
+                                        out_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
+                            auto arg_tensor =
+                                static_cast<char*>(ctx->buffer_data[arg_buffer_index]);
+                            auto out_tensor = ctx->buffer_data[out_buffer_index];
+                            if (out_tensor < arg_tensor || out_tensor >= arg_tensor + arg_size)
                             {
-                                memcpy(out_tensor,
-                                       reinterpret_cast<char*>(arg_tensor) + offset,
-                                       out_size);
+                                memcpy(out_tensor, arg_tensor + offset, out_size);
                             }
                         };
                         functors.emplace_back(functor);
@@ -89,10 +94,12 @@ namespace ngraph
                         input_desc, result_desc, lower_bounds, out_shape);
                     auto& deps = mkldnn_emitter->get_primitive_deps(slice_index);
 
-                    auto functor = [&, slice_index](CPURuntimeContext* ctx,
-                                                    CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                    auto functor = [&, slice_index, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, slice_index);
                     };
 
@@ -111,10 +118,17 @@ namespace ngraph
                                               runtime::cpu::kernel::strided_slice);
 
                         auto functor =
-                            [&, kernel, arg_shape, out_shape, lower_bounds, upper_bounds, strides](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                kernel(arg_tensor,
-                                       out_tensor,
+                            [&,
+                             kernel,
+                             arg_shape,
+                             out_shape,
+                             lower_bounds,
+                             upper_bounds,
+                             strides,
+                             arg_buffer_index,
+                             out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                                kernel(ctx->buffer_data[arg_buffer_index],
+                                       ctx->buffer_data[out_buffer_index],
                                        arg_shape,
                                        out_shape,
                                        lower_bounds,
@@ -133,10 +147,16 @@ namespace ngraph
                                               arg_shape.size(),
                                               runtime::cpu::kernel::slice);
 
-                        auto functor = [&, kernel, arg_shape, out_shape, lower_bounds](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            kernel(arg_tensor,
-                                   out_tensor,
+                        auto functor = [&,
+                                        kernel,
+                                        arg_shape,
+                                        out_shape,
+                                        lower_bounds,
+                                        arg_buffer_index,
+                                        out_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
+                            kernel(ctx->buffer_data[arg_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
                                    arg_shape,
                                    out_shape,
                                    lower_bounds,
@@ -14,13 +14,19 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstring>
+
 #include <tbb/tbb_stddef.h>
 
 #include "ngraph/graph_util.hpp"
+#include "ngraph/op/parameter.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_shared_arena.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/util.hpp"
 
@@ -54,10 +60,30 @@ namespace
     } s_cpu_static_init;
 }
 
+runtime::cpu::CPU_Backend::CPU_Backend()
+{
+    set_shared_arena(std::getenv("NGRAPH_CPU_SHARED_ARENA") != nullptr);
+    const char* shape_bucketing = std::getenv("NGRAPH_CPU_SHAPE_BUCKETING");
+    set_shape_bucketing(shape_bucketing == nullptr || string(shape_bucketing) != "0");
+}
+
 shared_ptr<runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Backend::make_call_frame(
     const shared_ptr<runtime::cpu::CPU_ExternalFunction>& external_function)
 {
-    return external_function->make_call_frame();
+    return external_function->make_call_frame(m_shared_arena);
+}
+
+void runtime::cpu::CPU_Backend::set_shared_arena(bool enable)
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
+    if (!enable)
+    {
+        m_shared_arena = nullptr;
+    }
+    else if (!m_shared_arena)
+    {
+        m_shared_arena = make_shared<CPUSharedArena>();
+    }
 }
 
 shared_ptr<runtime::Tensor>
@@ -72,63 +98,621 @@ shared_ptr<runtime::Tensor> runtime::cpu::CPU_Backend::create_tensor(
     return make_shared<runtime::cpu::CPUTensorView>(element_type, shape, memory_pointer);
 }
 
+static bool has_dynamic_parameters(const shared_ptr<Function>& func)
+{
+    for (const auto& parameter : func->get_parameters())
+    {
+        if (parameter->get_output_partial_shape(0).is_dynamic())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Whether only the leading dimension of func's parameters is dynamic and every result
+// keeps it, so that padding the batch pads the results the same way
+static bool is_dynamic_batch(const shared_ptr<Function>& func)
+{
+    auto has_batch_only = [](const PartialShape& shape, bool require_batch) {
+        if (shape.rank().is_dynamic() || static_cast<size_t>(shape.rank()) == 0)
+        {
+            return false;
+        }
+        for (size_t axis = 1; axis < static_cast<size_t>(shape.rank()); axis++)
+        {
+            if (shape[axis].is_dynamic())
+            {
+                return false;
+            }
+        }
+        return !require_batch || shape[0].is_dynamic();
+    };
+    for (const auto& parameter : func->get_parameters())
+    {
+        if (!has_batch_only(parameter->get_output_partial_shape(0), false))
+        {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < func->get_output_size(); i++)
+    {
+        if (!has_batch_only(func->get_output_partial_shape(i), true))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
 {
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+    shared_ptr<promise<void>> compiling;
+    shared_future<void> compiled;
+    bool performance_counters_enabled;
+    shared_ptr<CPUSharedArena> shared_arena;
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        FunctionInstance& instance = m_function_map[func];
+        if (instance.m_is_dynamic)
+        {
+            return true;
+        }
+        if (!instance.m_compiled.valid())
+        {
+            if (has_dynamic_parameters(func))
+            {
+                // Compiled per input shapes when called
+                instance.m_is_dynamic = true;
+                instance.m_is_bucketed = is_dynamic_batch(func);
+                return true;
+            }
+            compiling = make_shared<promise<void>>();
+            instance.m_compiled = compiling->get_future().share();
+        }
+        compiled = instance.m_compiled;
+        performance_counters_enabled = instance.m_performance_counters_enabled;
+        shared_arena = m_shared_arena;
+    }
+
+    if (compiling)
     {
-        instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
-        instance.m_external_function->m_emit_timing = instance.m_performance_counters_enabled;
-        auto cf = instance.m_external_function->make_call_frame();
-        instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+        // Other functions compile and run while this one is compiled
+        try
+        {
+            auto external_function = make_shared<CPU_ExternalFunction>(func);
+            external_function->m_emit_timing = performance_counters_enabled;
+            m_compile_count++;
+            auto call_frame = external_function->make_call_frame(shared_arena);
+
+            lock_guard<mutex> lock(m_function_map_mutex);
+            auto it = m_function_map.find(func);
+            if (it != m_function_map.end() && it->second.m_external_function == nullptr)
+            {
+                FunctionInstance& instance = it->second;
+                instance.m_external_function = external_function;
+                instance.m_call_frame = call_frame;
+                instance.m_idle_call_frames.push_back(call_frame);
+                instance.m_call_frame_count = 1;
+                instance.m_pool_owning_call_frame_count = shared_arena ? 0 : 1;
+            }
+        }
+        catch (...)
+        {
+            {
+                // A later compile tries again
+                lock_guard<mutex> lock(m_function_map_mutex);
+                auto it = m_function_map.find(func);
+                if (it != m_function_map.end() && it->second.m_external_function == nullptr)
+                {
+                    it->second.m_compiled = shared_future<void>();
+                }
+            }
+            compiling->set_exception(current_exception());
+            throw;
+        }
+        compiling->set_value();
     }
+    // Rethrows the error of a failed compile started by another thread
+    compiled.get();
     return true;
 }
 
+vector<Shape>
+    runtime::cpu::CPU_Backend::get_call_shapes(shared_ptr<Function> func,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    vector<Shape> shapes;
+    for (const auto& tv : inputs)
+    {
+        shapes.push_back(tv->get_shape());
+    }
+    if (!m_shape_bucketing)
+    {
+        return shapes;
+    }
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        auto it = m_function_map.find(func);
+        if (it == m_function_map.end() || !it->second.m_is_bucketed)
+        {
+            return shapes;
+        }
+    }
+
+    // Round the batch up to a power of two, so any mix of batch sizes up to 2^n
+    // compiles at most n + 1 specializations
+    const auto& parameters = func->get_parameters();
+    for (size_t i = 0; i < parameters.size() && i < shapes.size(); i++)
+    {
+        const PartialShape& shape = parameters[i]->get_output_partial_shape(0);
+        if (size_t(shape.rank()) != shapes[i].size() || shape[0].is_static())
+        {
+            continue;
+        }
+        size_t bucket = 1;
+        while (bucket < shapes[i][0])
+        {
+            bucket <<= 1;
+        }
+        shapes[i][0] = bucket;
+    }
+    return shapes;
+}
+
+shared_ptr<Function> runtime::cpu::CPU_Backend::acquire_specialization(shared_ptr<Function> func,
+                                                                       const vector<Shape>& shapes)
+{
+    bool performance_counters_enabled;
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        FunctionInstance& instance = m_function_map[func];
+        if (!instance.m_is_dynamic)
+        {
+            instance.m_active_calls++;
+            return func;
+        }
+        auto it = instance.m_specializations.find(shapes);
+        if (it != instance.m_specializations.end())
+        {
+            FunctionInstance& specialization = m_function_map.at(it->second);
+            specialization.m_last_use = ++m_specialization_uses;
+            specialization.m_active_calls++;
+            return it->second;
+        }
+        performance_counters_enabled = instance.m_performance_counters_enabled;
+    }
+
+    // Rebuild the graph on static parameters; shapes propagate through the cloned ops
+    const auto& parameters = func->get_parameters();
+    if (parameters.size() != shapes.size())
+    {
+        throw ngraph_error("Call input count does not match Function's Parameter count");
+    }
+    NodeMap node_map;
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        if (!parameters[i]->get_output_partial_shape(0).compatible(shapes[i]))
+        {
+            throw ngraph_error("Input " + to_string(i) + " shape does not match Parameter shape");
+        }
+        node_map.add(parameters[i],
+                     make_shared<op::Parameter>(parameters[i]->get_element_type(),
+                                                shapes[i],
+                                                parameters[i]->get_cacheable()));
+    }
+    auto specialization = clone_function(*func, node_map);
+
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        auto& specializations = m_function_map[func].m_specializations;
+        auto it = specializations.find(shapes);
+        if (it != specializations.end())
+        {
+            // Another thread specialized func for these shapes first
+            specialization = it->second;
+        }
+        else
+        {
+            // Evict the least recently used specializations not in use by a call
+            while (specializations.size() >= m_max_specializations)
+            {
+                auto victim = specializations.end();
+                for (auto candidate = specializations.begin(); candidate != specializations.end();
+                     ++candidate)
+                {
+                    const FunctionInstance& instance = m_function_map.at(candidate->second);
+                    if (instance.m_active_calls == 0 &&
+                        (victim == specializations.end() ||
+                         instance.m_last_use < m_function_map.at(victim->second).m_last_use))
+                    {
+                        victim = candidate;
+                    }
+                }
+                if (victim == specializations.end())
+                {
+                    break;
+                }
+                m_function_map.erase(victim->second);
+                specializations.erase(victim);
+            }
+            specializations[shapes] = specialization;
+            m_function_map[specialization].m_performance_counters_enabled =
+                performance_counters_enabled;
+        }
+        FunctionInstance& instance = m_function_map[specialization];
+        instance.m_last_use = ++m_specialization_uses;
+        instance.m_active_calls++;
+    }
+    try
+    {
+        compile(specialization);
+    }
+    catch (...)
+    {
+        release_specialization(specialization);
+        throw;
+    }
+    return specialization;
+}
+
+void runtime::cpu::CPU_Backend::release_specialization(shared_ptr<Function> specialization)
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
+    auto it = m_function_map.find(specialization);
+    if (it != m_function_map.end() && it->second.m_active_calls > 0)
+    {
+        it->second.m_active_calls--;
+    }
+}
+
+void runtime::cpu::CPU_Backend::set_max_specializations(size_t max_specializations)
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
+    m_max_specializations = max<size_t>(max_specializations, 1);
+}
+
+void runtime::cpu::CPU_Backend::set_shape_bucketing(bool enable)
+{
+    m_shape_bucketing = enable;
+}
+
 std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
     runtime::cpu::CPU_Backend::get_call_frame(std::shared_ptr<Function> func)
 {
-    bool rc = true;
+    bool rc = compile(func);
+    if (!rc)
+    {
+        throw ngraph_error("couldn't compile a function");
+    }
+
+    lock_guard<mutex> lock(m_function_map_mutex);
+    return m_function_map[func].m_call_frame;
+}
+
+shared_ptr<runtime::cpu::CPU_CallFrame>
+    runtime::cpu::CPU_Backend::acquire_call_frame(shared_ptr<Function> func, int numa_node)
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+    auto& frames = instance.m_idle_call_frames;
+    auto it = frames.end();
+    if (numa_node < 0)
+    {
+        it = frames.empty() ? frames.end() : frames.end() - 1;
+    }
+    else
+    {
+        // Reuse a frame whose memory is already on this node, otherwise one that
+        // has not been bound to a node yet
+        it = find_if(frames.begin(), frames.end(), [numa_node](const shared_ptr<CPU_CallFrame>& f) {
+            return f->get_numa_node() == numa_node;
+        });
+        if (it == frames.end())
+        {
+            it = find_if(frames.begin(), frames.end(), [](const shared_ptr<CPU_CallFrame>& f) {
+                return f->get_numa_node() < 0;
+            });
+        }
+    }
+    if (it == frames.end())
     {
-        rc = compile(func);
+        // No suitable frame is idle; the new frame shares the compiled functors and
+        // constants of the external function but creates its own MKLDNN primitives
+        auto call_frame = instance.m_external_function->make_call_frame(m_shared_arena);
+        instance.m_call_frame_count++;
+        instance.m_pool_owning_call_frame_count += m_shared_arena ? 0 : 1;
+        return call_frame;
     }
+    auto call_frame = *it;
+    frames.erase(it);
+    return call_frame;
+}
 
-    if (!rc)
+void runtime::cpu::CPU_Backend::release_call_frame(shared_ptr<Function> func,
+                                                   shared_ptr<CPU_CallFrame> call_frame)
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end())
     {
-        throw ngraph_error("couldn't compile a function");
+        it->second.m_idle_call_frames.push_back(call_frame);
     }
+}
 
-    return instance.m_call_frame;
+// Copies the leading corner two row-major tensors have in common
+static void copy_corner(const char* src,
+                        const Shape& src_shape,
+                        char* dst,
+                        const Shape& dst_shape,
+                        size_t element_size)
+{
+    Shape corner(src_shape.size());
+    for (size_t axis = 0; axis < corner.size(); axis++)
+    {
+        corner[axis] = min(src_shape[axis], dst_shape[axis]);
+    }
+    if (shape_size(corner) == 0)
+    {
+        return;
+    }
+    if (corner.empty())
+    {
+        memcpy(dst, src, element_size);
+        return;
+    }
+    auto src_strides = row_major_strides(src_shape);
+    auto dst_strides = row_major_strides(dst_shape);
+    size_t row_size = corner.back() * element_size;
+    size_t rows = shape_size(corner) / corner.back();
+    for (size_t row = 0; row < rows; row++)
+    {
+        size_t src_offset = 0;
+        size_t dst_offset = 0;
+        size_t remainder = row;
+        for (size_t axis = corner.size() - 1; axis-- > 0;)
+        {
+            size_t index = remainder % corner[axis];
+            remainder /= corner[axis];
+            src_offset += index * src_strides[axis];
+            dst_offset += index * dst_strides[axis];
+        }
+        memcpy(dst + dst_offset * element_size, src + src_offset * element_size, row_size);
+    }
 }
 
 bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
                                      const vector<shared_ptr<runtime::Tensor>>& outputs,
                                      const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
-    bool rc = true;
+    bool rc = compile(func);
+    vector<Shape> shapes = get_call_shapes(func, inputs);
+    auto specialization = acquire_specialization(func, shapes);
+    try
+    {
+        bool is_padded = false;
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            is_padded |= shapes[i] != inputs[i]->get_shape();
+        }
+        if (!is_padded)
+        {
+            call_specialization(specialization, outputs, inputs);
+        }
+        else
+        {
+            // Run the bucket's specialization on zero-padded copies of the inputs and
+            // return the corner of each result that belongs to the real inputs
+            vector<shared_ptr<runtime::Tensor>> padded_inputs;
+            for (size_t i = 0; i < inputs.size(); i++)
+            {
+                const element::Type& type = inputs[i]->get_element_type();
+                vector<char> data(shape_size(inputs[i]->get_shape()) * type.size());
+                inputs[i]->read(data.data(), 0, data.size());
+                vector<char> padded(shape_size(shapes[i]) * type.size(), 0);
+                copy_corner(data.data(),
+                            inputs[i]->get_shape(),
+                            padded.data(),
+                            shapes[i],
+                            type.size());
+                padded_inputs.push_back(create_tensor(type, shapes[i]));
+                padded_inputs.back()->write(padded.data(), 0, padded.size());
+            }
+            vector<shared_ptr<runtime::Tensor>> padded_outputs;
+            for (size_t i = 0; i < specialization->get_output_size(); i++)
+            {
+                padded_outputs.push_back(create_tensor(specialization->get_output_element_type(i),
+                                                       specialization->get_output_shape(i)));
+            }
+            call_specialization(specialization, padded_outputs, padded_inputs);
+            for (size_t i = 0; i < outputs.size(); i++)
+            {
+                const Shape& padded_shape = padded_outputs.at(i)->get_shape();
+                const Shape& shape = outputs[i]->get_shape();
+                if (padded_shape.size() != shape.size())
+                {
+                    throw ngraph_error("Output " + to_string(i) + " rank does not match Result");
+                }
+                size_t element_size = outputs[i]->get_element_type().size();
+                vector<char> padded(shape_size(padded_shape) * element_size);
+                padded_outputs[i]->read(padded.data(), 0, padded.size());
+                vector<char> data(shape_size(shape) * element_size);
+                copy_corner(padded.data(), padded_shape, data.data(), shape, element_size);
+                outputs[i]->write(data.data(), 0, data.size());
+            }
+        }
+    }
+    catch (...)
+    {
+        release_specialization(specialization);
+        throw;
+    }
+    release_specialization(specialization);
+    return rc;
+}
 
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+void runtime::cpu::CPU_Backend::call_specialization(
+    shared_ptr<Function> func,
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    bool is_first_call = false;
     {
-        rc = compile(func);
+        lock_guard<mutex> lock(m_function_map_mutex);
+        FunctionInstance& instance = m_function_map[func];
+        is_first_call = !instance.m_is_called;
+        instance.m_is_called = true;
     }
+    size_t peak_rss = is_first_call ? get_peak_rss() : 0;
 
-    instance.m_call_frame->call(outputs, inputs);
+    auto& cpu_executor = executor::GetCPUExecutor();
+    auto arena = cpu_executor.select_arena();
+    auto call_frame = acquire_call_frame(func, cpu_executor.get_numa_node(arena));
+    try
+    {
+        call_frame->call(outputs, inputs, arena);
+    }
+    catch (...)
+    {
+        release_call_frame(func, call_frame);
+        throw;
+    }
+    release_call_frame(func, call_frame);
 
-    return rc;
+    if (is_first_call)
+    {
+        size_t peak_rss_delta = get_peak_rss() - peak_rss;
+        lock_guard<mutex> lock(m_function_map_mutex);
+        m_function_map[func].m_peak_rss_delta = peak_rss_delta;
+    }
+}
+
+future<bool>
+    runtime::cpu::CPU_Backend::call_async(shared_ptr<Function> func,
+                                          const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                          const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    auto promise = make_shared<std::promise<bool>>();
+    auto result = promise->get_future();
+    auto& cpu_executor = executor::GetCPUExecutor();
+    cpu_executor.schedule(
+        [this, promise, func, outputs, inputs]() {
+            try
+            {
+                promise->set_value(call(func, outputs, inputs));
+            }
+            catch (...)
+            {
+                promise->set_exception(current_exception());
+            }
+        },
+        cpu_executor.select_arena());
+    return result;
+}
+
+class runtime::cpu::CPU_Backend::CPUBoundCall : public runtime::BoundCall
+{
+public:
+    CPUBoundCall(CPU_Backend* backend,
+                 shared_ptr<Function> func,
+                 const vector<shared_ptr<runtime::Tensor>>& outputs,
+                 const vector<shared_ptr<runtime::Tensor>>& inputs)
+        : m_backend(backend)
+        , m_function(func)
+        , m_output_tvs(outputs)
+        , m_input_tvs(inputs)
+    {
+        auto& cpu_executor = executor::GetCPUExecutor();
+        m_arena = cpu_executor.select_arena();
+        m_call_frame = m_backend->acquire_call_frame(func, cpu_executor.get_numa_node(m_arena));
+        shared_ptr<CPU_ExternalFunction> external_function;
+        {
+            lock_guard<mutex> lock(m_backend->m_function_map_mutex);
+            external_function = m_backend->m_function_map[func].m_external_function;
+        }
+        m_call_frame->propagate_layouts(outputs,
+                                        external_function->get_result_layout_descriptors());
+        for (const auto& tv : inputs)
+        {
+            m_inputs.push_back(static_pointer_cast<CPUTensorView>(tv)->get_data_ptr());
+            m_input_ptrs.push_back(tv.get());
+        }
+        for (const auto& tv : outputs)
+        {
+            m_outputs.push_back(static_pointer_cast<CPUTensorView>(tv)->get_data_ptr());
+        }
+    }
+
+    ~CPUBoundCall() override
+    {
+        m_backend->release_call_frame(m_function, m_call_frame);
+        m_backend->release_specialization(m_function);
+    }
+    bool run() override
+    {
+        m_call_frame->call(m_input_ptrs, m_outputs, m_inputs, m_arena);
+        return true;
+    }
+
+private:
+    CPU_Backend* m_backend;
+    shared_ptr<Function> m_function;
+    shared_ptr<CPU_CallFrame> m_call_frame;
+    int m_arena;
+    vector<shared_ptr<runtime::Tensor>> m_output_tvs;
+    vector<shared_ptr<runtime::Tensor>> m_input_tvs;
+    vector<runtime::Tensor*> m_input_ptrs;
+    vector<void*> m_outputs;
+    vector<void*> m_inputs;
+};
+
+shared_ptr<runtime::BoundCall>
+    runtime::cpu::CPU_Backend::bind(shared_ptr<Function> func,
+                                    const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    validate_call(func, outputs, inputs);
+    if (!compile(func))
+    {
+        throw ngraph_error("couldn't compile a function");
+    }
+    // Bound tensors are used in place, so the specialization is for their exact shapes
+    vector<Shape> shapes;
+    for (const auto& tv : inputs)
+    {
+        shapes.push_back(tv->get_shape());
+    }
+    auto specialization = acquire_specialization(func, shapes);
+    try
+    {
+        return make_shared<CPUBoundCall>(this, specialization, outputs, inputs);
+    }
+    catch (...)
+    {
+        release_specialization(specialization);
+        throw;
+    }
 }
 
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Function> func)
 {
-    m_function_map.erase(func);
+    lock_guard<mutex> lock(m_function_map_mutex);
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end())
+    {
+        for (const auto& p : it->second.m_specializations)
+        {
+            m_function_map.erase(p.second);
+        }
+        m_function_map.erase(it);
+    }
 }
 
 void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> func, bool enable)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function != nullptr)
+    if (instance.m_compiled.valid())
     {
         throw runtime_error("Performance data collection must be enabled prior to compiling.");
     }
@@ -138,6 +722,7 @@ void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> fun
 vector<runtime::PerformanceCounter>
     runtime::cpu::CPU_Backend::get_performance_data(shared_ptr<Function> func) const
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     vector<runtime::PerformanceCounter> rc;
     auto it = m_function_map.find(func);
     if (it != m_function_map.end())
@@ -145,10 +730,49 @@ vector<runtime::PerformanceCounter>
         const FunctionInstance& instance = it->second;
         if (instance.m_external_function != nullptr)
         {
-            rc.insert(rc.end(),
-                      instance.m_external_function->get_perf_counters().begin(),
-                      instance.m_external_function->get_perf_counters().end());
+            auto counters = instance.m_external_function->get_perf_counters();
+            rc.insert(rc.end(), counters.begin(), counters.end());
+        }
+        // Counters of every shape a dynamic function was compiled for
+        for (const auto& p : instance.m_specializations)
+        {
+            const auto& external_function = m_function_map.at(p.second).m_external_function;
+            if (external_function != nullptr)
+            {
+                auto counters = external_function->get_perf_counters();
+                rc.insert(rc.end(), counters.begin(), counters.end());
+            }
         }
     }
     return rc;
 }
+
+runtime::MemoryUsage runtime::cpu::CPU_Backend::get_memory_usage(shared_ptr<Function> func) const
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
+    MemoryUsage usage;
+    auto add_instance = [&usage](const FunctionInstance& instance) {
+        if (instance.m_external_function != nullptr)
+        {
+            MemoryUsage instance_usage = instance.m_external_function->get_memory_usage();
+            // Every frame made for concurrent calls owns its pools, unless they come from the
+            // shared arena, and its workspaces
+            instance_usage.temporary_pool_size *=
+                max(instance.m_pool_owning_call_frame_count, size_t(1));
+            instance_usage.workspace_bytes *= max(instance.m_call_frame_count, size_t(1));
+            instance_usage.peak_rss_delta = instance.m_peak_rss_delta;
+            usage.merge(instance_usage);
+        }
+    };
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end())
+    {
+        add_instance(it->second);
+        // Every shape a dynamic function was compiled for has its own pools
+        for (const auto& p : it->second.m_specializations)
+        {
+            add_instance(m_function_map.at(p.second));
+        }
+    }
+    return usage;
+}
@@ -16,8 +16,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <future>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "ngraph/runtime/backend.hpp"
 
@@ -29,13 +33,41 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+            class CPUSharedArena;
 
             class CPU_Backend : public runtime::Backend
             {
             public:
+                CPU_Backend();
+
                 std::shared_ptr<CPU_CallFrame>
                     make_call_frame(const std::shared_ptr<CPU_ExternalFunction>& external_function);
 
+                // Makes the call frames of functions compiled afterwards borrow their
+                // intermediate memory from pools shared per executor stream instead of
+                // owning it. Also enabled by NGRAPH_CPU_SHARED_ARENA.
+                void set_shared_arena(bool enable);
+                const std::shared_ptr<CPUSharedArena>& get_shared_arena() const
+                {
+                    return m_shared_arena;
+                }
+
+                // Functions with dynamic parameter shapes keep at most this many compiled
+                // specializations, evicting the least recently used ones. Defaults to 16.
+                void set_max_specializations(size_t max_specializations);
+
+                // Calls of dynamic-batch functions compile one specialization per batch
+                // bucket, the batch size rounded up to a power of two, and run it on
+                // zero-padded copies of the inputs. A dynamic-batch function has only a
+                // dynamic leading dimension on its parameters and keeps it on every result;
+                // its rows must not depend on the padding rows, as in per-sample inference.
+                // Other dynamic functions are compiled per exact input shapes. Enabled by
+                // default; NGRAPH_CPU_SHAPE_BUCKETING=0 disables it.
+                void set_shape_bucketing(bool enable);
+
+                // The number of functions and specializations compiled so far
+                size_t get_compile_count() const { return m_compile_count; }
+
                 std::shared_ptr<ngraph::runtime::Tensor>
                     create_tensor(const ngraph::element::Type& element_type,
                                   const Shape& shape,
@@ -51,23 +83,89 @@ namespace ngraph
                           const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+                std::future<bool> call_async(
+                    std::shared_ptr<Function> func,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+                std::shared_ptr<BoundCall>
+                    bind(std::shared_ptr<Function> func,
+                         const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                         const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
                 void remove_compiled_function(std::shared_ptr<Function> func) override;
                 std::shared_ptr<CPU_CallFrame> get_call_frame(std::shared_ptr<Function> func);
 
                 void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
                 std::vector<PerformanceCounter>
                     get_performance_data(std::shared_ptr<Function> func) const override;
+                MemoryUsage get_memory_usage(std::shared_ptr<Function> func) const override;
 
             private:
+                // Owns a call frame for as long as the tensors stay bound to it
+                class CPUBoundCall;
+
                 class FunctionInstance
                 {
                 public:
                     std::shared_ptr<CPU_ExternalFunction> m_external_function;
                     std::shared_ptr<CPU_CallFrame> m_call_frame;
+                    // Valid once a compile has started; ready when it finished. Callers
+                    // of compile wait on it without holding m_function_map_mutex.
+                    std::shared_future<void> m_compiled;
+                    // Call frames not currently executing. Every concurrent call takes
+                    // its own frame so runtime contexts and intermediate buffers are
+                    // never shared between threads.
+                    std::vector<std::shared_ptr<CPU_CallFrame>> m_idle_call_frames;
+                    // Frames made so far, and those of them that own their pools rather
+                    // than borrowing them from the shared arena
+                    size_t m_call_frame_count = 0;
+                    size_t m_pool_owning_call_frame_count = 0;
                     bool m_performance_counters_enabled = false;
+                    // Set by the first call, which measures the growth of the peak RSS
+                    bool m_is_called = false;
+                    size_t m_peak_rss_delta = 0;
+                    // Functions with dynamic parameter shapes, such as a dynamic batch
+                    // dimension, are compiled once per distinct set of input shapes
+                    bool m_is_dynamic = false;
+                    bool m_is_bucketed = false;
+                    std::map<std::vector<Shape>, std::shared_ptr<Function>> m_specializations;
+                    // Of a specialization: when it was last acquired, and the calls and bound
+                    // calls holding it, which keep it from being evicted
+                    size_t m_last_use = 0;
+                    size_t m_active_calls = 0;
                 };
 
+                // The shapes to specialize func for when called on inputs
+                std::vector<Shape>
+                    get_call_shapes(std::shared_ptr<Function> func,
+                                    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+                // func itself if its parameter shapes are static, otherwise its
+                // specialization to shapes, which is compiled on first use. Either is held
+                // until release_specialization.
+                std::shared_ptr<Function> acquire_specialization(std::shared_ptr<Function> func,
+                                                                 const std::vector<Shape>& shapes);
+                void release_specialization(std::shared_ptr<Function> specialization);
+
+                void call_specialization(
+                    std::shared_ptr<Function> func,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+                // Prefers an idle frame bound to numa_node, or unbound when numa_node is -1
+                std::shared_ptr<CPU_CallFrame> acquire_call_frame(std::shared_ptr<Function> func,
+                                                                  int numa_node);
+                void release_call_frame(std::shared_ptr<Function> func,
+                                        std::shared_ptr<CPU_CallFrame> call_frame);
+
                 std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+                mutable std::mutex m_function_map_mutex;
+                std::shared_ptr<CPUSharedArena> m_shared_arena;
+                size_t m_max_specializations = 16;
+                size_t m_specialization_uses = 0;
+                std::atomic<bool> m_shape_bucketing{true};
+                std::atomic<size_t> m_compile_count{0};
             };
         }
     }
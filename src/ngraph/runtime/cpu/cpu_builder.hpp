@@ -208,11 +208,15 @@
     SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
                                                                                                    \
     auto element_count = out[0].get_size();                                                        \
-    auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());                    \
-    auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());                     \
+    auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());              \
+    auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());               \
                                                                                                    \
-    auto functor = [&, kernel, element_count](CPURuntimeContext* ctx, CPUExecutionContext* ectx) { \
-        kernel(arg0_tensor, out0_tensor, element_count, ectx->arena);                              \
+    auto functor = [&, kernel, element_count, arg0_buffer_index, out0_buffer_index](               \
+        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                       \
+        kernel(ctx->buffer_data[arg0_buffer_index],                                                \
+               ctx->buffer_data[out0_buffer_index],                                                \
+               element_count,                                                                      \
+               ectx->arena);                                                                       \
     };                                                                                             \
     functors.emplace_back(functor);
 
@@ -223,13 +227,19 @@
     SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
                                                                                                    \
     auto element_count = out[0].get_size();                                                        \
-    auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());                    \
-    auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());                    \
-    auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());                     \
+    auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());              \
+    auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());              \
+    auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());               \
                                                                                                    \
-    auto functor = [&, kernel, element_count](CPURuntimeContext* ctx, CPUExecutionContext* ectx) { \
-        kernel(arg0_tensor, arg1_tensor, out0_tensor, element_count, ectx->arena);                 \
-    };                                                                                             \
+    auto functor =                                                                                 \
+        [&, kernel, element_count, arg0_buffer_index, arg1_buffer_index, out0_buffer_index](       \
+            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
+            kernel(ctx->buffer_data[arg0_buffer_index],                                            \
+                   ctx->buffer_data[arg1_buffer_index],                                            \
+                   ctx->buffer_data[out0_buffer_index],                                            \
+                   element_count,                                                                  \
+                   ectx->arena);                                                                   \
+        };                                                                                         \
     functors.emplace_back(functor);
 
 #define REGISTER_OP_BUILDER(OP)                                                                    \
@@ -15,20 +15,26 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <mutex>
 
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_shared_arena.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
+#include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
-                                           EntryPoint compiled_function)
+                                           EntryPoint compiled_function,
+                                           std::shared_ptr<CPUSharedArena> shared_arena)
     : m_external_function(external_function)
     , m_compiled_function(compiled_function)
+    , m_shared_arena(shared_arena)
 {
     setup_runtime_context();
 }
@@ -59,10 +65,46 @@ void runtime::cpu::CPU_CallFrame::inner_call(
         outputs.push_back(tv->get_data_ptr());
     }
 
+    execute(outputs, inputs);
+}
+
+void runtime::cpu::CPU_CallFrame::execute(std::vector<void*>& outputs, std::vector<void*>& inputs)
+{
+    if (m_shared_arena)
+    {
+        m_shared_arena->acquire(ctx, m_external_function->get_memory_buffer_sizes());
+        try
+        {
+            dispatch(outputs, inputs);
+        }
+        catch (...)
+        {
+            m_shared_arena->release(ctx);
+            throw;
+        }
+        m_shared_arena->release(ctx);
+    }
+    else
+    {
+        dispatch(outputs, inputs);
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::dispatch(std::vector<void*>& outputs, std::vector<void*>& inputs)
+{
     // Invoke compiled computation
     if (!m_external_function->is_direct_execution())
     {
-        m_compiled_function(inputs.data(), outputs.data(), ctx);
+        // Generated code shares op states across call frames
+        if (!m_external_function->m_states.empty())
+        {
+            std::lock_guard<std::mutex> lock(m_external_function->m_compiled_function_mutex);
+            m_compiled_function(inputs.data(), outputs.data(), ctx);
+        }
+        else
+        {
+            m_compiled_function(inputs.data(), outputs.data(), ctx);
+        }
     }
     else
     {
@@ -79,13 +121,79 @@ void runtime::cpu::CPU_CallFrame::inner_call(
 
 void runtime::cpu::CPU_CallFrame::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
-    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs,
+    int arena)
 {
     ctx->pc = 0;
+    ctx->arena = arena < 0 ? executor::GetCPUExecutor().select_arena() : arena;
+    bind_numa_node();
     propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
     inner_call(output_tvs, input_tvs);
 }
 
+void runtime::cpu::CPU_CallFrame::call(const std::vector<runtime::Tensor*>& input_tvs,
+                                       std::vector<void*>& outputs,
+                                       std::vector<void*>& inputs,
+                                       int arena)
+{
+    ctx->pc = 0;
+    ctx->arena = arena;
+    bind_numa_node();
+    for (size_t i = 0; i < input_tvs.size(); i++)
+    {
+        ctx->p_en[i] = input_tvs[i]->get_stale();
+    }
+    execute(outputs, inputs);
+}
+
+void runtime::cpu::CPU_CallFrame::call(std::vector<void*>& outputs,
+                                       std::vector<void*>& inputs,
+                                       int arena)
+{
+    ctx->pc = 0;
+    ctx->arena = arena;
+    bind_numa_node();
+    std::fill_n(ctx->p_en, inputs.size(), true);
+    execute(outputs, inputs);
+}
+
+void runtime::cpu::CPU_CallFrame::bind_numa_node()
+{
+    auto& cpu_executor = executor::GetCPUExecutor();
+    auto numa_node = cpu_executor.get_numa_node(ctx->arena);
+    if (numa_node < 0)
+    {
+        return;
+    }
+
+    auto& counters = cpu_executor.get_numa_counters();
+    if (ctx->numa_node < 0)
+    {
+        // The frame is bound to the node of the stream that first runs it. Its
+        // intermediate pool has not been touched yet, so initialize it from the
+        // stream's threads to place the pages there. Shared pools are placed when
+        // they are allocated.
+        ctx->numa_node = numa_node;
+        if (!m_shared_arena)
+        {
+            for (auto buffer : ctx->memory_buffers)
+            {
+                cpu_executor.first_touch(buffer->get_ptr(), nullptr, buffer->size(), ctx->arena);
+                counters.first_touch_bytes += buffer->size();
+            }
+        }
+    }
+
+    if (ctx->numa_node == numa_node)
+    {
+        counters.local_calls++;
+    }
+    else
+    {
+        counters.remote_calls++;
+    }
+}
+
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
     const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
     const LayoutDescriptorPtrs& layouts) const
@@ -111,6 +219,8 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
     ctx = new CPURuntimeContext;
 
     ctx->pc = 0;
+    ctx->arena = 0;
+    ctx->numa_node = -1;
     ctx->op_durations = nullptr;
     if (runtime::cpu::IsTracingEnabled())
     {
@@ -118,18 +228,44 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
     }
     ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
 
+    // Tensor addresses and cache state are private to each call frame so that
+    // frames of the same function can execute concurrently
+    auto buffer_size = m_external_function->get_buffer_size();
+    ctx->buffer_data = new void*[buffer_size]();
+    ctx->buffer_stale = new bool[buffer_size]();
+
     ctx->first_iteration = true;
 
-    // Create temporary buffer pools
+    // Create temporary buffer pools, or borrow them from the shared arena on each call
     size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+    auto allocator = executor::GetCPUExecutor().get_allocator();
     for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
     {
-        auto buffer = new AlignedBuffer(buffer_size, alignment);
+        auto buffer =
+            m_shared_arena ? nullptr : new AlignedBuffer(buffer_size, alignment, allocator);
         ctx->memory_buffers.push_back(buffer);
     }
+    // Kernels set the data handles of MKLDNN primitives as they run, so only one
+    // frame at a time uses the external function's own
     const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
-    ctx->mkldnn_primitives = mkldnn_emitter->get_mkldnn_primitives().data();
-    ctx->mkldnn_workspaces = mkldnn_emitter->get_mkldnn_workspaces().data();
+    m_owns_mkldnn_primitives = mkldnn_emitter->get_mkldnn_primitives().empty() ||
+                               m_external_function->m_mkldnn_primitives_in_use.exchange(true);
+    if (!m_owns_mkldnn_primitives)
+    {
+        ctx->mkldnn_primitives = mkldnn_emitter->get_mkldnn_primitives().data();
+        ctx->mkldnn_workspaces = mkldnn_emitter->get_mkldnn_workspaces().data();
+    }
+    else
+    {
+        m_mkldnn_primitives = mkldnn_emitter->build_primitive_replicas();
+        m_mkldnn_workspaces = mkldnn_emitter->build_workspace_replicas();
+        for (const auto& workspace : m_mkldnn_workspaces)
+        {
+            m_mkldnn_workspace_bufs.push_back(workspace->buf);
+        }
+        ctx->mkldnn_primitives = m_mkldnn_primitives.data();
+        ctx->mkldnn_workspaces = m_mkldnn_workspace_bufs.data();
+    }
     ctx->states = m_external_function->m_states.data();
 
     if (std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
@@ -143,11 +279,30 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
 
 void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 {
+    if (m_owns_mkldnn_primitives)
+    {
+        for (auto p : m_mkldnn_primitives)
+        {
+            delete p;
+        }
+        m_mkldnn_primitives.clear();
+        m_mkldnn_workspaces.clear();
+        m_mkldnn_workspace_bufs.clear();
+    }
+    else
+    {
+        m_external_function->m_mkldnn_primitives_in_use = false;
+    }
     delete[] ctx->op_durations;
     delete[] ctx->p_en;
-    for (auto buffer : ctx->memory_buffers)
+    delete[] ctx->buffer_data;
+    delete[] ctx->buffer_stale;
+    if (!m_shared_arena)
     {
-        delete buffer;
+        for (auto buffer : ctx->memory_buffers)
+        {
+            delete buffer;
+        }
     }
     if (std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
     {
@@ -35,6 +35,8 @@ namespace ngraph
             class CPU_CallFrame;
             class CPU_ExternalFunction;
             class CPU_Debugger;
+            class CPUSharedArena;
+            class MKLDNNWorkspace;
 
             using EntryPoint_t = void(void** inputs, void** outputs, CPURuntimeContext* ctx);
 
@@ -46,15 +48,36 @@ namespace ngraph
             public:
                 friend class CPU_Debugger;
 
+                /// \param shared_arena Pools to borrow intermediate memory from for each
+                ///     call, or null to allocate the frame's own pools
                 CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
-                              EntryPoint compiled_function);
+                              EntryPoint compiled_function,
+                              std::shared_ptr<CPUSharedArena> shared_arena = nullptr);
                 ~CPU_CallFrame();
 
                 /// \brief Invoke the function with values matching the signature of the function.
                 ///
                 /// Tuples will be expanded into their tensor views to build the call frame.
+                /// \param arena Executor arena (stream) to run on, or -1 to let the executor pick
                 void call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
-                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                          int arena = -1);
+
+                /// \brief Invoke the function on tensors whose data pointers were resolved
+                ///     and whose output layouts were propagated once, when they were bound.
+                ///
+                /// Nothing is allocated; the pointer vectors are reused across calls.
+                void call(const std::vector<runtime::Tensor*>& input_tvs,
+                          std::vector<void*>& outputs,
+                          std::vector<void*>& inputs,
+                          int arena);
+
+                /// \brief Invoke the function on buffers of a calling function, such as the
+                ///     arguments of a FunctionCall. All inputs are treated as changed.
+                void call(std::vector<void*>& outputs, std::vector<void*>& inputs, int arena);
+
+                /// \brief NUMA node holding this frame's memory, or -1 if it is not bound yet
+                int get_numa_node() const { return ctx->numa_node; }
 
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
@@ -69,10 +92,21 @@ namespace ngraph
 
                 void inner_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                                 const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+                void execute(std::vector<void*>& outputs, std::vector<void*>& inputs);
+                void dispatch(std::vector<void*>& outputs, std::vector<void*>& inputs);
+
+                void bind_numa_node();
 
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
                 EntryPoint m_compiled_function;
+                std::shared_ptr<CPUSharedArena> m_shared_arena;
                 CPURuntimeContext* ctx;
+                // Set when another frame was using the external function's MKLDNN
+                // primitives, so this frame created its own
+                bool m_owns_mkldnn_primitives = false;
+                std::vector<mkldnn::primitive*> m_mkldnn_primitives;
+                std::vector<std::unique_ptr<MKLDNNWorkspace>> m_mkldnn_workspaces;
+                std::vector<char*> m_mkldnn_workspace_bufs;
             };
         }
     }
@@ -4659,10 +4659,21 @@ namespace ngraph
                     std::bind(emit_function_call, std::string("std::min"), std::placeholders::_1);
                 auto maxe =
                     std::bind(emit_function_call, std::string("std::max"), std::placeholders::_1);
+                auto expe =
+                    std::bind(emit_function_call, std::string("std::exp"), std::placeholders::_1);
+                auto sqrte =
+                    std::bind(emit_function_call, std::string("std::sqrt"), std::placeholders::_1);
+                auto tanhe =
+                    std::bind(emit_function_call, std::string("std::tanh"), std::placeholders::_1);
                 auto adde = std::bind(emit_infix_operator, std::string("+"), std::placeholders::_1);
+                auto dive = std::bind(emit_infix_operator, std::string("/"), std::placeholders::_1);
+                auto mule = std::bind(emit_infix_operator, std::string("*"), std::placeholders::_1);
                 auto nege =
                     std::bind(emit_prefix_operator, std::string("-"), std::placeholders::_1);
                 auto sube = std::bind(emit_infix_operator, std::string("-"), std::placeholders::_1);
+                auto sigmoide = [](const std::vector<std::string>& args) {
+                    return "1 / (1 + std::exp(-" + args.at(0) + "))";
+                };
 
                 return std::unordered_map<
                     std::type_index,
@@ -4672,8 +4683,14 @@ namespace ngraph
                     {TI(ngraph::op::Relu), maxe},
                     {TI(ngraph::op::Maximum), maxe},
                     {TI(ngraph::op::Add), adde},
+                    {TI(ngraph::op::Divide), dive},
+                    {TI(ngraph::op::Exp), expe},
+                    {TI(ngraph::op::Multiply), mule},
                     {TI(ngraph::op::Negative), nege},
+                    {TI(ngraph::op::Sigmoid), sigmoide},
+                    {TI(ngraph::op::Sqrt), sqrte},
                     {TI(ngraph::op::Subtract), sube},
+                    {TI(ngraph::op::Tanh), tanhe},
                 };
             }
 
@@ -4681,20 +4698,6 @@ namespace ngraph
                                       std::function<std::string(const std::vector<std::string>&)>>
                 inline_emitters = initialize_inline_emitters();
 
-            // GOEE doesn't see GOEs in subgraphs that are hidden inside LoopKernels
-            // we have to manually propagate the source output
-            static const ngraph::descriptor::Output*
-                get_goe_input_output(ngraph::descriptor::Output* output)
-            {
-                auto it = output;
-                while (auto goe =
-                           std::dynamic_pointer_cast<ngraph::op::GetOutputElement>(it->get_node()))
-                {
-                    it = &goe->get_inputs().at(goe->get_n()).get_output();
-                }
-                return it;
-            }
-
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::runtime::cpu::op::LoopKernel)
             {
@@ -4705,14 +4708,19 @@ namespace ngraph
                 const ngraph::runtime::cpu::op::LoopKernel* clk =
                     static_cast<const ngraph::runtime::cpu::op::LoopKernel*>(node);
 
+                NodeVector input_nodes = clk->get_kernel_inputs();
                 NodeVector output_nodes = clk->get_kernel_outputs();
                 NodeVector node_list = clk->get_node_list();
 
+                // members still read the original input nodes, even after later passes
+                // rewire the inputs of the kernel itself
+                std::unordered_map<const ngraph::descriptor::Output*, std::string> input_names;
                 for (size_t i = 0; i < args.size(); i++)
                 {
-                    std::string sname = std::string(args[i].get_name()) + "[i]";
-                    auto entry = std::make_pair(&clk->get_inputs().at(i).get_output(), sname);
-                    loop_symbol_table.insert(entry);
+                    auto input = &input_nodes.at(i)->get_outputs().at(0);
+                    input_names.insert(std::make_pair(input, args[i].get_name()));
+                    loop_symbol_table.insert(
+                        std::make_pair(input, std::string(args[i].get_name()) + "[i]"));
                 }
 
                 // add outputs so we write output values directly into their
@@ -4752,13 +4760,26 @@ namespace ngraph
                         tmp = loop_symbol_table.at(op);
                     }
 
+                    // broadcasts index their (smaller) kernel input directly
+                    if (auto broadcast =
+                            std::dynamic_pointer_cast<ngraph::op::Broadcast>(op_node))
+                    {
+                        size_t inner;
+                        size_t size;
+                        ngraph::runtime::cpu::op::LoopKernel::is_contiguous_broadcast(
+                            *broadcast, inner, size);
+                        writer << tmp << " = "
+                               << input_names.at(&op_node->get_inputs().at(0).get_output())
+                               << "[(i / " << inner << ") % " << size << "];\n";
+                        continue;
+                    }
+
                     // prepare arguments
                     std::vector<std::string> sargs;
                     for (auto& input : op_node->get_inputs())
                     {
                         // args are expected to be in a map already
-                        sargs.push_back(
-                            loop_symbol_table.at(get_goe_input_output(&input.get_output())));
+                        sargs.push_back(loop_symbol_table.at(&input.get_output()));
                     }
 
                     if (std::dynamic_pointer_cast<ngraph::op::Relu>(op_node))
@@ -14,9 +14,25 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
 #include <thread>
 
+#ifndef __APPLE__
+#include <sched.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
 
 static int GetNumCores()
 {
@@ -52,6 +68,138 @@ static int GetNumThreadPools()
     return 1;
 }
 
+static int GetNumStreams()
+{
+    const auto ngraph_cpu_streams = std::getenv("NGRAPH_CPU_STREAMS");
+    int count = 0;
+
+    if (ngraph_cpu_streams && (count = std::atoi(ngraph_cpu_streams)) > 0)
+    {
+        return count;
+    }
+
+    return 0;
+}
+
+// Cores available to this process, physical cores first. The first GetNumCores()
+// logical CPUs are used, which skips hyper-thread siblings on the usual enumeration.
+static std::vector<int> GetAvailableCores()
+{
+    std::vector<int> cores;
+#ifndef __APPLE__
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+    {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (CPU_ISSET(cpu, &mask))
+            {
+                cores.push_back(cpu);
+            }
+        }
+    }
+#endif
+    if (cores.empty())
+    {
+        for (int cpu = 0; cpu < static_cast<int>(std::thread::hardware_concurrency()); cpu++)
+        {
+            cores.push_back(cpu);
+        }
+    }
+    size_t num_cores = std::min(cores.size(), static_cast<size_t>(GetNumCores()));
+    cores.resize(std::max(num_cores, static_cast<size_t>(1)));
+    return cores;
+}
+
+static int GetWavefrontWidth()
+{
+    const auto ngraph_cpu_wavefront_width = std::getenv("NGRAPH_CPU_WAVEFRONT_WIDTH");
+    int count = 0;
+
+    if (ngraph_cpu_wavefront_width && (count = std::atoi(ngraph_cpu_wavefront_width)) > 1)
+    {
+        return count;
+    }
+
+    return 1;
+}
+
+static bool IsNumaBindingEnabled()
+{
+    const auto ngraph_cpu_numa = std::getenv("NGRAPH_CPU_NUMA");
+    return ngraph_cpu_numa && std::atoi(ngraph_cpu_numa) != 0;
+}
+
+// Maps each logical CPU to its NUMA node using sysfs. CPUs missing from the
+// map (or every CPU when the topology is unavailable) are treated as node 0.
+static std::map<int, int> GetNumaNodeOfCores()
+{
+    std::map<int, int> core_nodes;
+    for (int node = 0; node < 256; node++)
+    {
+        std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(node) +
+                              "/cpulist");
+        if (!cpulist)
+        {
+            continue;
+        }
+        // Format is a comma separated list of CPUs and CPU ranges, e.g. "0-3,8-11"
+        std::string range;
+        while (std::getline(cpulist, range, ','))
+        {
+            int first = 0;
+            int last = 0;
+            char dash = 0;
+            std::istringstream range_stream(range);
+            if (!(range_stream >> first))
+            {
+                continue;
+            }
+            last = (range_stream >> dash >> last) ? last : first;
+            for (int cpu = first; cpu <= last; cpu++)
+            {
+                core_nodes[cpu] = node;
+            }
+        }
+    }
+    return core_nodes;
+}
+
+static thread_local int s_current_arena = -1;
+
+static void PinCurrentThread(const std::vector<int>& cores)
+{
+#ifndef __APPLE__
+    if (cores.empty())
+    {
+        return;
+    }
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (auto cpu : cores)
+    {
+        CPU_SET(cpu, &mask);
+    }
+    sched_setaffinity(0, sizeof(mask), &mask);
+#endif
+}
+
+// MKLDNN and MKL kernels start their OpenMP teams from the calling thread. Size them for the
+// cores the thread is pinned to rather than for the whole machine.
+static void LimitCurrentThreadParallelism(const std::vector<int>& cores)
+{
+    if (cores.empty())
+    {
+        return;
+    }
+    int num_threads = static_cast<int>(cores.size());
+#ifdef _OPENMP
+    omp_set_num_threads(num_threads);
+#endif
+    mkl::MKL_Set_Num_Threads_Local(num_threads);
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -60,22 +208,106 @@ namespace ngraph
         {
             namespace executor
             {
-                CPUExecutor::CPUExecutor(int num_thread_pools)
-                    : m_num_thread_pools(num_thread_pools)
+                CPUThreadEnvironment::EnvThread*
+                    CPUThreadEnvironment::CreateThread(std::function<void()> f)
+                {
+                    auto cores = m_cores;
+                    auto arena = m_arena;
+                    return new EnvThread([cores, arena, f]() {
+                        PinCurrentThread(cores);
+                        LimitCurrentThreadParallelism(cores);
+                        s_current_arena = arena;
+                        f();
+                    });
+                }
+
+                CPUExecutor::CPUExecutor(int num_thread_pools,
+                                         bool partition_cores,
+                                         bool numa_binding)
+                    : m_next_arena(0)
+                    , m_num_thread_pools(num_thread_pools)
+                    , m_wavefront_width(GetWavefrontWidth())
+                    , m_partition_cores(partition_cores)
                 {
-                    for (int i = 0; i < num_thread_pools; i++)
+                    std::vector<int> available_cores;
+                    if (partition_cores)
                     {
+                        available_cores = GetAvailableCores();
+                        // Every stream needs at least one core
+                        m_num_thread_pools =
+                            std::min(num_thread_pools, static_cast<int>(available_cores.size()));
+                    }
+
+                    for (int i = 0; i < m_num_thread_pools; i++)
+                    {
+                        std::vector<int> cores;
+                        if (partition_cores)
+                        {
+                            size_t begin = available_cores.size() * i / m_num_thread_pools;
+                            size_t end = available_cores.size() * (i + 1) / m_num_thread_pools;
+                            cores.assign(available_cores.begin() + begin,
+                                         available_cores.begin() + end);
+                        }
+
                         int num_threads_per_pool;
 #if defined(EIGEN_OPENMP)
                         num_threads_per_pool = 1;
 #else
-                        num_threads_per_pool = GetNumCores();
+                        num_threads_per_pool =
+                            partition_cores ? static_cast<int>(cores.size()) : GetNumCores();
 #endif
-                        m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPool>(
-                            new Eigen::ThreadPool(num_threads_per_pool)));
+                        int parallelism =
+                            partition_cores ? static_cast<int>(cores.size()) : GetNumCores();
+                        m_thread_pools.push_back(std::unique_ptr<CPUThreadPool>(new CPUThreadPool(
+                            num_threads_per_pool, CPUThreadEnvironment(cores, i))));
                         m_thread_pool_devices.push_back(std::unique_ptr<Eigen::ThreadPoolDevice>(
-                            new Eigen::ThreadPoolDevice(m_thread_pools[i].get(), GetNumCores())));
+                            new Eigen::ThreadPoolDevice(m_thread_pools[i].get(), parallelism)));
                         m_tbb_arenas.emplace_back(1);
+                        m_cores.push_back(cores);
+
+                        if (partition_cores)
+                        {
+                            m_async_thread_pools.push_back(std::unique_ptr<CPUThreadPool>(
+                                new CPUThreadPool(1, CPUThreadEnvironment(cores, i))));
+                        }
+                        if (m_wavefront_width > 1)
+                        {
+                            // The calling thread runs one op group of every wavefront
+                            m_inter_op_thread_pools.push_back(
+                                std::unique_ptr<CPUThreadPool>(new CPUThreadPool(
+                                    m_wavefront_width - 1, CPUThreadEnvironment(cores, i))));
+                        }
+                    }
+                    if (partition_cores && numa_binding)
+                    {
+                        // A stream belongs to the node that holds most of its cores
+                        auto core_nodes = GetNumaNodeOfCores();
+                        for (const auto& cores : m_cores)
+                        {
+                            std::map<int, size_t> node_counts;
+                            for (auto cpu : cores)
+                            {
+                                auto it = core_nodes.find(cpu);
+                                node_counts[it == core_nodes.end() ? 0 : it->second]++;
+                            }
+                            auto node = std::max_element(
+                                node_counts.begin(),
+                                node_counts.end(),
+                                [](const std::pair<const int, size_t>& a,
+                                   const std::pair<const int, size_t>& b) {
+                                    return a.second < b.second;
+                                });
+                            m_numa_nodes.push_back(node == node_counts.end() ? 0 : node->first);
+                        }
+                        m_numa_allocator = std::make_shared<runtime::Allocator>(
+                            runtime::Allocator::get_default()->uses_huge_pages(), 0);
+                    }
+                    if (!partition_cores)
+                    {
+                        // Kernels parallelize on the pools above, so asynchronous calls get
+                        // their own threads, one per concurrently executing function
+                        m_async_thread_pools.push_back(std::unique_ptr<CPUThreadPool>(
+                            new CPUThreadPool(m_num_thread_pools, CPUThreadEnvironment())));
                     }
                 }
 
@@ -95,9 +327,98 @@ namespace ngraph
                     }
                 }
 
+                int CPUExecutor::select_arena()
+                {
+                    if (!m_partition_cores)
+                    {
+                        return 0;
+                    }
+                    if (s_current_arena >= 0)
+                    {
+                        return s_current_arena;
+                    }
+                    return static_cast<int>(m_next_arena++ % m_num_thread_pools);
+                }
+
+                void CPUExecutor::schedule(std::function<void()> f, int arena)
+                {
+                    if (m_partition_cores)
+                    {
+                        m_async_thread_pools[arena]->Schedule(std::move(f));
+                    }
+                    else
+                    {
+                        m_async_thread_pools[0]->Schedule(std::move(f));
+                    }
+                }
+
+                void CPUExecutor::run_parallel(size_t n,
+                                               const std::function<void(size_t)>& f,
+                                               int arena)
+                {
+                    if (n == 1 || m_inter_op_thread_pools.empty())
+                    {
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            f(i);
+                        }
+                        return;
+                    }
+
+                    Eigen::Barrier barrier(static_cast<unsigned int>(n - 1));
+                    std::exception_ptr exception;
+                    std::mutex exception_mutex;
+                    auto run = [&](size_t i) {
+                        try
+                        {
+                            f(i);
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard<std::mutex> lock(exception_mutex);
+                            if (!exception)
+                            {
+                                exception = std::current_exception();
+                            }
+                        }
+                    };
+                    for (size_t i = 1; i < n; i++)
+                    {
+                        m_inter_op_thread_pools[arena]->Schedule([&run, &barrier, i]() {
+                            run(i);
+                            barrier.Notify();
+                        });
+                    }
+                    run(0);
+                    barrier.Wait();
+                    if (exception)
+                    {
+                        std::rethrow_exception(exception);
+                    }
+                }
+
+                void CPUExecutor::first_touch(void* dst, const void* src, size_t size, int arena)
+                {
+                    Eigen::TensorMap<Eigen::Tensor<char, 1, Eigen::RowMajor>> out(
+                        static_cast<char*>(dst), static_cast<Eigen::Index>(size));
+                    if (src)
+                    {
+                        Eigen::TensorMap<Eigen::Tensor<const char, 1, Eigen::RowMajor>> in(
+                            static_cast<const char*>(src), static_cast<Eigen::Index>(size));
+                        out.device(get_device(arena)) = in;
+                    }
+                    else
+                    {
+                        out.device(get_device(arena)) = out.constant(0);
+                    }
+                }
+
                 CPUExecutor& GetCPUExecutor()
                 {
-                    static CPUExecutor cpu_executor(GetNumThreadPools());
+                    static int num_streams = GetNumStreams();
+                    static CPUExecutor cpu_executor(num_streams ? num_streams : GetNumThreadPools(),
+                                                    num_streams != 0,
+                                                    IsNumaBindingEnabled());
                     return cpu_executor;
                 }
 
@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <thread>
+#include <vector>
 
 #include <mkldnn.hpp>
 
+#include "ngraph/runtime/allocator.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 
 #define EIGEN_USE_THREADS
@@ -38,11 +42,56 @@ namespace ngraph
             {
                 extern mkldnn::engine global_cpu_engine;
 
+                // Thread environment for Eigen thread pools whose workers are
+                // pinned to a group of cores, with OpenMP and MKL teams of the same size.
+                // An empty group leaves threads unpinned.
+                struct CPUThreadEnvironment : public Eigen::StlThreadEnvironment
+                {
+                    CPUThreadEnvironment() = default;
+                    CPUThreadEnvironment(const std::vector<int>& cores, int arena)
+                        : m_cores(cores)
+                        , m_arena(arena)
+                    {
+                    }
+
+                    EnvThread* CreateThread(std::function<void()> f);
+
+                    std::vector<int> m_cores;
+                    int m_arena = 0;
+                };
+
+                using CPUThreadPool = Eigen::ThreadPoolTempl<CPUThreadEnvironment>;
+
+                // Counters for NUMA binding (NGRAPH_CPU_NUMA=1)
+                struct NumaCounters
+                {
+                    // Intermediate pool bytes first touched by stream threads
+                    std::atomic<size_t> first_touch_bytes{0};
+                    // Constant bytes copied into node-local replicas
+                    std::atomic<size_t> replicated_constant_bytes{0};
+                    // Calls on a call frame whose memory is local to the executing stream
+                    std::atomic<size_t> local_calls{0};
+                    // Calls on a call frame whose memory lives on another node
+                    std::atomic<size_t> remote_calls{0};
+                };
+
                 // CPUExecutor owns the resources for executing a graph.
+                //
+                // With NGRAPH_CPU_STREAMS=N the cores are split into N disjoint groups
+                // ("streams"). Each stream gets its own pinned thread pool, TBB arena and
+                // a pinned thread that runs asynchronous calls, so independent requests
+                // on different streams do not share caches. MKLDNN and MKL kernels run on
+                // the calling thread's OpenMP team, which is limited to the stream's cores.
+                //
+                // With NGRAPH_CPU_NUMA=1 as well, every stream is assigned the NUMA node
+                // of its cores. Call frames and large constants are then placed on that
+                // node by first touch from the stream's threads.
                 class CPUExecutor
                 {
                 public:
-                    explicit CPUExecutor(int num_thread_pools);
+                    CPUExecutor(int num_thread_pools,
+                                bool partition_cores = false,
+                                bool numa_binding = false);
 
                     Eigen::ThreadPoolDevice& get_device(int id)
                     {
@@ -54,11 +103,52 @@ namespace ngraph
                                  CPUExecutionContext* ectx,
                                  bool use_tbb = false);
                     int get_num_thread_pools() { return m_num_thread_pools; }
+                    // Cores assigned to the thread pool of an arena; empty when unpinned
+                    const std::vector<int>& get_cores(int arena) { return m_cores[arena]; }
+                    // Arena for a call issued from the current thread. Stream threads use
+                    // their own stream; other threads are spread round-robin over streams.
+                    int select_arena();
+                    // Runs a whole function invocation off the calling thread, on the
+                    // given arena's stream when cores are partitioned
+                    void schedule(std::function<void()> f, int arena = 0);
+                    // Number of independent ops a wavefront schedule may run at once
+                    // (NGRAPH_CPU_WAVEFRONT_WIDTH); 1 disables wavefront scheduling
+                    int get_wavefront_width() const { return m_wavefront_width; }
+                    // Runs f(0) .. f(n - 1) concurrently, f(0) on the calling thread and
+                    // the rest on the arena's inter-op threads, and waits for all of them
+                    void run_parallel(size_t n, const std::function<void(size_t)>& f, int arena);
+                    // NUMA node backing an arena, or -1 when NUMA binding is disabled
+                    int get_numa_node(int arena)
+                    {
+                        return m_numa_nodes.empty() ? -1 : m_numa_nodes[arena];
+                    }
+                    // Copies size bytes from src (or zero fills when src is null) using the
+                    // arena's threads so that the pages of dst are placed on its node
+                    void first_touch(void* dst, const void* src, size_t size, int arena);
+                    // Allocator for memory placed by first_touch. With NUMA binding, freed
+                    // buffers go back to the system instead of a pool, since a reused buffer
+                    // keeps its pages on the node that touched it first.
+                    std::shared_ptr<runtime::Allocator> get_allocator()
+                    {
+                        return m_numa_allocator ? m_numa_allocator
+                                                : runtime::Allocator::get_default();
+                    }
+                    NumaCounters& get_numa_counters() { return m_numa_counters; }
+
                 private:
-                    std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
+                    std::vector<std::unique_ptr<CPUThreadPool>> m_thread_pools;
                     std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
                     std::vector<tbb::task_arena> m_tbb_arenas;
+                    std::vector<std::unique_ptr<CPUThreadPool>> m_async_thread_pools;
+                    std::vector<std::unique_ptr<CPUThreadPool>> m_inter_op_thread_pools;
+                    std::vector<std::vector<int>> m_cores;
+                    std::vector<int> m_numa_nodes;
+                    std::shared_ptr<runtime::Allocator> m_numa_allocator;
+                    NumaCounters m_numa_counters;
+                    std::atomic<unsigned> m_next_arena;
                     int m_num_thread_pools;
+                    int m_wavefront_width;
+                    bool m_partition_cores;
                 };
 
                 extern CPUExecutor& GetCPUExecutor();
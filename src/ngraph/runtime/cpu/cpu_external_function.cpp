@@ -14,8 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
+#include <map>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -131,6 +133,7 @@
 #include "ngraph/pass/propagate_cacheability.hpp"
 #include "ngraph/pass/zero_dim_tensor_elimination.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cost_model.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
@@ -165,6 +168,7 @@
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
@@ -424,7 +428,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 
     codegen::CodeWriter writer;
 
-    writer << "// Generated by the nGraph CPU backend\n";
+    writer << "// Generated by the nGraph CPU backend " << NGRAPH_VERSION << "\n";
     if (m_use_tbb)
     {
         if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
@@ -555,7 +559,10 @@ using namespace ngraph::runtime;
         writer << "\n";
     }
 
+    // Constant addresses are bound after the module is loaded so that the generated
+    // code, and the compiled module cached for it, does not depend on this process
     writer << "// Declare all constants\n";
+    codegen::CodeWriter bind_constants_writer;
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
         for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
@@ -563,16 +570,24 @@ using namespace ngraph::runtime;
             ngraph::op::Constant* c = dynamic_cast<ngraph::op::Constant*>(node.get());
             if (c)
             {
-                m_active_constants.push_back(node);
                 shared_ptr<descriptor::Tensor> tv = node->get_outputs()[0].get_tensor_ptr();
                 string type = tv->get_element_type().c_type_string();
-                writer << "static " << type << "* " << tv->get_name() << " = ((" << type << "*)("
-                       << c->get_data_ptr() << "));\n";
+                writer << "static " << type << "* " << tv->get_name() << ";\n";
+                bind_constants_writer << tv->get_name() << " = static_cast<" << type
+                                      << "*>(constants[" << m_active_constants.size()
+                                      << "]);\n";
+                m_active_constants.push_back(node);
                 m_variable_name_map[tv->get_name()] = tv->get_name();
                 m_tensor_roles[tv->get_name()] = CPUTensorRole::CONSTANT;
             }
         }
     }
+    writer << "\nextern \"C\" void bind_constants(void** constants)\n";
+    writer << "{\n";
+    writer.indent++;
+    writer << bind_constants_writer.get_code();
+    writer.indent--;
+    writer << "}\n\n";
 
     writer << "// Declare all functions\n";
     for (shared_ptr<Function> f : pass_manager.get_state().get_functions())
@@ -970,6 +985,11 @@ using namespace ngraph::runtime;
     m_execution_engine.reset(new codegen::ExecutionEngine());
 
     m_compiler->set_precompiled_header_source(pch_header_source);
+    if (auto cache_dir = std::getenv("NGRAPH_CODEGEN_CACHE_DIR"))
+    {
+        m_compiler->set_cache_directory(cache_dir);
+        m_execution_engine->set_cache_directory(cache_dir);
+    }
 
     auto codegen_module = m_compiler->compile(code);
 
@@ -986,6 +1006,19 @@ using namespace ngraph::runtime;
         throw runtime_error("could not find compiled function");
     }
 
+    auto bind_constants = m_execution_engine->find_function<void(void**)>("bind_constants");
+    if (bind_constants == nullptr)
+    {
+        throw runtime_error("could not find compiled function bind_constants");
+    }
+    vector<void*> constants;
+    for (const auto& node : m_active_constants)
+    {
+        constants.push_back(
+            const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()));
+    }
+    bind_constants(constants.data());
+
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
     {
@@ -1023,6 +1056,7 @@ using namespace ngraph::runtime;
     }
 
     m_is_compiled = true;
+    collect_memory_usage();
     if (m_release_function)
     {
         release_function();
@@ -1052,6 +1086,7 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(ngraph::pass::Ma
 #if defined(NGRAPH_HALIDE)
     pass_manager.register_pass<ngraph::runtime::cpu::pass::HalideSubgraphExtraction>();
 #endif
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>();
 
     NodeVector nv_cwi; // We dont need CPUWorkspaceInsertion to return list of indices
     pass_manager.register_pass<runtime::cpu::pass::CPUWorkspaceInsertion>(nv_cwi, false);
@@ -1064,6 +1099,7 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(ngraph::pass::Ma
     pass_manager.register_pass<runtime::cpu::pass::CPUMemoryOptimization>();
     pass_manager.register_pass<ngraph::pass::GetOutputElementElimination>();
     pass_manager.get_state().set_visualize_tree_ops_map(runtime::cpu::get_visualize_tree_ops_map());
+    pass_manager.get_state().set_cost_model(runtime::CostModel::get_default("CPU"));
 }
 
 bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
@@ -1442,7 +1478,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         {
             for (auto tensor : node->liveness_new_list)
             {
-                intermediates_offsets.emplace_back(tensor_data[tensor->get_name()],
+                intermediates_offsets.emplace_back(get_raw_buffer_index(tensor->get_name()),
                                                    tensor->get_pool_offset());
                 m_tensor_roles[tensor->get_name()] = CPUTensorRole::INTERMEDIATE;
             }
@@ -1455,8 +1491,10 @@ void runtime::cpu::CPU_ExternalFunction::build()
         if (node->is_constant())
         {
             auto tv = node->get_outputs()[0].get_tensor_ptr();
-            tensor_data[tv->get_name()] =
-                const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr());
+            constant_tensor_data.emplace_back(
+                get_raw_buffer_index(tv->get_name()),
+                const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()),
+                tv->size());
             m_tensor_roles[tv->get_name()] = CPUTensorRole::CONSTANT;
             propagate_in_place_constant(&node->get_outputs().at(0), tv->get_name(), true);
         }
@@ -1469,8 +1507,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
             shared_ptr<descriptor::Tensor> tv = param->get_output_tensor_ptr(i);
-            function_input_index.emplace_back(
-                tensor_data[tv->get_name()], arg_index, tensor_stale[tv->get_name()]);
+            function_input_index.emplace_back(get_raw_buffer_index(tv->get_name()), arg_index);
             m_tensor_roles[tv->get_name()] = CPUTensorRole::INPUT;
             propagate_in_place_input(&param->get_outputs().at(i), tv->get_name(), true);
             arg_index++;
@@ -1482,7 +1519,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
     {
         shared_ptr<Node> op = m_function->get_output_op(i);
         shared_ptr<descriptor::Tensor> tv = op->get_output_tensor_ptr();
-        function_output_index.emplace_back(tensor_data[tv->get_name()], i);
+        function_output_index.emplace_back(get_raw_buffer_index(tv->get_name()), i);
         m_tensor_roles[tv->get_name()] = CPUTensorRole::OUTPUT;
 
         //keep assigning different outputs to a result descriptor
@@ -1494,7 +1531,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         {
             shared_ptr<descriptor::Tensor> itv =
                 res->get_inputs().at(0).get_output().get_tensor_ptr();
-            function_output_index.emplace_back(tensor_data[itv->get_name()], i);
+            function_output_index.emplace_back(get_raw_buffer_index(itv->get_name()), i);
             m_tensor_roles[itv->get_name()] = CPUTensorRole::OUTPUT;
             tensor_alias[itv->get_name()] = tv->get_name();
             propagate_in_place_output(
@@ -1502,6 +1539,24 @@ void runtime::cpu::CPU_ExternalFunction::build()
         }
     }
 
+    // Functors that can run concurrently (TBB flow graph or wavefront schedule) must
+    // also be ordered when they touch overlapping ranges of the intermediate pool
+    size_t wavefront_width =
+        m_use_tbb ? 1 : static_cast<size_t>(executor::GetCPUExecutor().get_wavefront_width());
+    bool track_dependencies = m_use_tbb || wavefront_width > 1;
+    struct PoolAccess
+    {
+        size_t functor;
+        const descriptor::Tensor* tensor;
+        size_t begin;
+        size_t end;
+        bool write;
+    };
+    vector<PoolAccess> pool_accesses;
+    // Estimated time of each functor, which balances the groups of a wavefront
+    vector<double> functor_costs;
+    auto cost_model = pass_manager.get_state().get_cost_model();
+
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1536,63 +1591,76 @@ void runtime::cpu::CPU_ExternalFunction::build()
 
         m_op_attrs.emplace_back(node->description(), out_names, in_names);
         op_names.push_back(node->get_name());
+        auto num_states = m_states.size();
         handler->second(this, node.get(), in, out);
 
-        bool disable_caching = computes_result(node.get()) || possibly_overwritten(node.get());
+        // Op states are owned by the external function and shared by all of its call
+        // frames, so serialize the kernels that update them across concurrent calls.
+        // MKLDNN primitives need no lock; every concurrent frame has its own.
+        if (m_states.size() != num_states)
+        {
+            auto kernel = functors.back();
+            auto kernel_mutex = make_shared<std::mutex>();
+            functors.back() = [kernel, kernel_mutex](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                std::lock_guard<std::mutex> lock(*kernel_mutex);
+                kernel(ctx, ectx);
+            };
+        }
 
-        vector<reference_wrapper<bool>> in_stale, out_stale;
-        for (const auto& name : in_names)
+        if (track_dependencies)
         {
-            if (tensor_alias.count(name))
+            size_t functor_index = functors.size() - 1;
+            auto add_access = [&](const descriptor::Tensor* tv, bool write) {
+                auto role = m_tensor_roles.find(tv->get_name());
+                if (role != m_tensor_roles.end() &&
+                    role->second == CPUTensorRole::INTERMEDIATE && tv->size() > 0)
+                {
+                    pool_accesses.push_back({functor_index,
+                                             tv,
+                                             tv->get_pool_offset(),
+                                             tv->get_pool_offset() + tv->size(),
+                                             write});
+                }
+            };
+            for (const descriptor::Input& input : node->get_inputs())
             {
-                in_stale.emplace_back(tensor_stale[tensor_alias[name]]);
+                add_access(&input.get_output().get_tensor(), false);
             }
-            else
+            for (const descriptor::Output& output : node->get_outputs())
             {
-                in_stale.emplace_back(tensor_stale[name]);
+                add_access(&output.get_tensor(), true);
             }
-        }
-        for (const auto& name : out_names)
-        {
-            out_stale.emplace_back(tensor_stale[name]);
+            functor_costs.push_back(cost_model->get_cost(*node).microseconds);
         }
 
-        function<bool(CPURuntimeContext*)> enable;
-        if (disable_caching)
+        // Always enable nodes computing output tensors or nodes whose outputs might get
+        // overwritten due to inplace kernels
+        ScheduledOp scheduled_op;
+        scheduled_op.always_enabled =
+            computes_result(node.get()) || possibly_overwritten(node.get());
+        scheduled_op.inputs_begin = m_schedule_buffers.size();
+        for (const auto& name : in_names)
         {
-            enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
-                for (auto& stale : out_stale)
-                {
-                    stale.get() = true;
-                }
-                return true;
-            };
+            m_schedule_buffers.push_back(get_buffer_index(name));
         }
-        else
+        scheduled_op.outputs_begin = m_schedule_buffers.size();
+        for (const auto& name : out_names)
         {
-            enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
-                bool en = false;
-                for (const auto& stale : in_stale)
-                {
-                    if (stale)
-                    {
-                        en = true;
-                        break;
-                    }
-                }
-                for (auto& stale : out_stale)
-                {
-                    stale.get() = en;
-                }
-                return en;
-            };
+            m_schedule_buffers.push_back(get_raw_buffer_index(name));
         }
-
-        enables.emplace_back(enable);
-        enable_nodename_list.emplace_back(make_pair(enable, node->get_name()));
+        scheduled_op.outputs_end = m_schedule_buffers.size();
+        m_schedule.push_back(scheduled_op);
 
         m_perf_counters.emplace_back(node->get_name().c_str(), 0, 0);
     }
+    m_perf_microseconds.reset(new std::atomic<size_t>[m_perf_counters.size()]);
+    m_perf_call_counts.reset(new std::atomic<size_t>[m_perf_counters.size()]);
+    for (size_t i = 0; i < m_perf_counters.size(); i++)
+    {
+        m_perf_microseconds[i] = 0;
+        m_perf_call_counts[i] = 0;
+    }
 
     if ((std::getenv("NGRAPH_DEX_DEBUG") != nullptr))
     {
@@ -1618,8 +1686,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
         write_to_file(strm.str(), s_debug_dir, filename);
         strm.str("");
 
-        //dump the op's order of execution along with the address of
-        //tensor_data which holds the base address of each tensor.
+        //dump the op's order of execution along with the index of the
+        //buffer_data slot which holds the base address of each tensor.
         for (shared_ptr<Node> node : m_function->get_ordered_ops())
         {
             std::vector<string> node_inputs;
@@ -1633,7 +1701,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
             {
                 const descriptor::Output& output = input.get_output();
                 shared_ptr<descriptor::Tensor> tv = output.get_tensor_ptr();
-                temp << &tensor_data[tv->get_name()];
+                temp << get_raw_buffer_index(tv->get_name());
                 node_inputs.push_back(tv->get_name() + "(" + temp.str() + ")");
                 temp.str("");
             }
@@ -1641,7 +1709,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
             for (const descriptor::Output& output : node->get_outputs())
             {
                 shared_ptr<descriptor::Tensor> tv = output.get_tensor_ptr();
-                temp << &tensor_data[tv->get_name()];
+                temp << get_raw_buffer_index(tv->get_name());
                 node_outputs.push_back(tv->get_name() + "(" + temp.str() + ")");
                 temp.str("");
             }
@@ -1657,121 +1725,171 @@ void runtime::cpu::CPU_ExternalFunction::build()
     //This check ensures we have exactly one functor for Op.
     assert(m_op_attrs.size() == functors.size());
 
+    // When every function input changed since the previous call, the ops that run are
+    // fixed: replay stale tracking once here, treating buffers read before any op
+    // writes them as stale
+    {
+        vector<bool> stale(get_buffer_size(), false);
+        vector<bool> written(get_buffer_size(), false);
+        for (const auto& p : function_input_index)
+        {
+            stale[p.first] = true;
+            written[p.first] = true;
+        }
+        for (const auto& p : constant_tensor_data)
+        {
+            written[get<0>(p)] = true;
+        }
+        for (size_t index = 0; index < m_schedule.size(); index++)
+        {
+            const auto& op = m_schedule[index];
+            bool enabled = op.always_enabled;
+            for (size_t i = op.inputs_begin; i < op.outputs_begin; i++)
+            {
+                auto buffer = m_schedule_buffers[i];
+                enabled = enabled || stale[buffer] || !written[buffer];
+            }
+            for (size_t i = op.outputs_begin; i < op.outputs_end; i++)
+            {
+                stale[m_schedule_buffers[i]] = enabled;
+                written[m_schedule_buffers[i]] = true;
+            }
+            if (enabled)
+            {
+                m_uncached_functors.push_back(index);
+            }
+        }
+    }
+
+    if (track_dependencies)
+    {
+        // Sweep the pool accesses in order of offset. The accesses still active when one
+        // starts are exactly the ones it overlaps, so only overlapping pairs are visited.
+        sort(pool_accesses.begin(),
+             pool_accesses.end(),
+             [](const PoolAccess& a, const PoolAccess& b) { return a.begin < b.begin; });
+        multimap<size_t, const PoolAccess*> active_accesses;
+        for (const auto& access : pool_accesses)
+        {
+            active_accesses.erase(active_accesses.begin(),
+                                  active_accesses.upper_bound(access.begin));
+            for (const auto& active : active_accesses)
+            {
+                const PoolAccess& other = *active.second;
+                if (other.functor != access.functor && other.tensor != access.tensor &&
+                    (other.write || access.write))
+                {
+                    m_functor_edges.emplace_back(min(other.functor, access.functor),
+                                                 max(other.functor, access.functor));
+                }
+            }
+            active_accesses.emplace(access.end, &access);
+        }
+
+        // Record the functor dependencies now so that flow graphs can be built for
+        // call frames created after the function has been released
+        unordered_map<string, size_t> nodename_functor_index;
+        for (size_t functor_index = 0; functor_index < op_names.size(); functor_index++)
+        {
+            nodename_functor_index[op_names[functor_index]] = functor_index;
+        }
+        traverse_nodes(m_function, [&](shared_ptr<Node> n) {
+            if (!n->is_parameter() && !n->is_constant())
+            {
+                for (auto arg : n->get_arguments())
+                {
+                    if (!arg->is_parameter() && !arg->is_constant())
+                    {
+                        m_functor_edges.emplace_back(nodename_functor_index.at(arg->get_name()),
+                                                     nodename_functor_index.at(n->get_name()));
+                    }
+                }
+            }
+        });
+        sort(m_functor_edges.begin(), m_functor_edges.end());
+        m_functor_edges.erase(unique(m_functor_edges.begin(), m_functor_edges.end()),
+                              m_functor_edges.end());
+
+        vector<bool> has_predecessor(functors.size(), false);
+        for (const auto& edge : m_functor_edges)
+        {
+            has_predecessor[edge.second] = true;
+        }
+        for (size_t index = 0; index < functors.size(); index++)
+        {
+            if (!has_predecessor[index])
+            {
+                m_functor_heads.push_back(index);
+            }
+        }
+
+        if (wavefront_width > 1)
+        {
+            build_wavefront_schedule(functor_costs, wavefront_width);
+        }
+    }
+
     executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
         cpu::Timestamp start_ts, end_ts;
         int profiler_count = 0;
+        bool timing = runtime::cpu::IsTracingEnabled() || m_emit_timing;
+        bool track_stale = ctx->first_iteration;
 
         if (ctx->first_iteration)
         {
             for (auto& p : intermediates_offsets)
             {
-                p.first.get() = static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
+                ctx->buffer_data[p.first] =
+                    static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
+            }
+            for (auto& p : get_constant_tensor_data(ctx->numa_node, ctx->arena))
+            {
+                ctx->buffer_data[p.first] = p.second;
             }
         }
 
         for (const auto& p : function_input_index)
         {
-            get<0>(p).get() = inputs[get<1>(p)];
-            get<2>(p).get() = ctx->p_en[get<1>(p)];
+            ctx->buffer_data[p.first] = inputs[p.second];
+            ctx->buffer_stale[p.first] = ctx->p_en[p.second];
+            track_stale = track_stale || !ctx->p_en[p.second];
         }
 
         for (const auto& p : function_output_index)
         {
-            p.first.get() = outputs[p.second];
+            ctx->buffer_data[p.first] = outputs[p.second];
         }
 
-        auto functor = functors.begin();
         if (m_use_tbb)
         {
             // Build the flow graph
             if (ctx->first_iteration)
             {
-                std::unordered_map<std::string, tbb::flow::continue_node<tbb::flow::continue_msg>*>
-                    nodename_tbbnode_map;
+                vector<tbb::flow::continue_node<tbb::flow::continue_msg>*> flowgraph_nodes;
                 tbb::flow::continue_node<tbb::flow::continue_msg>* flowgraph_node_start =
                     new tbb::flow::continue_node<tbb::flow::continue_msg>(
                         *(ctx->G), [&](const tbb::flow::continue_msg& msg) {});
-                auto it = enable_nodename_list.begin();
-                for (const auto& p : enables)
+                for (size_t index = 0; index < functors.size(); index++)
                 {
-                    auto index = profiler_count++;
                     tbb::flow::continue_node<tbb::flow::continue_msg>* flowgraph_node =
                         new tbb::flow::continue_node<tbb::flow::continue_msg>(
-                            *(ctx->G), [&, functor, index](const tbb::flow::continue_msg& msg) {
-                                if (p(ctx) || ctx->first_iteration)
-                                {
-                                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
-                                    {
-                                        start_ts = cpu::Clock::now();
-                                    }
-                                    CPUExecutionContext ectx{0};
-                                    executor::GetCPUExecutor().execute(*functor, ctx, &ectx, true);
-                                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
-                                    {
-                                        end_ts = cpu::Clock::now();
-
-                                        if (runtime::cpu::IsTracingEnabled())
-                                        {
-                                            ctx->op_durations[index] =
-                                                (std::chrono::duration_cast<cpu::Timescale>(
-                                                     end_ts - start_ts))
-                                                    .count();
-                                        }
-                                        if (m_emit_timing)
-                                        {
-                                            m_perf_counters[index].m_total_microseconds +=
-                                                std::chrono::duration_cast<
-                                                    std::chrono::microseconds>(end_ts - start_ts)
-                                                    .count();
-                                            m_perf_counters[index].m_call_count++;
-                                        }
-                                    }
-                                }
-                                else
-                                {
-                                    if (runtime::cpu::IsTracingEnabled())
-                                    {
-                                        ctx->op_durations[index] = 0;
-                                    }
-                                    if (m_emit_timing)
-                                    {
-                                        m_perf_counters[index].m_call_count++;
-                                    }
-                                }
+                            *(ctx->G), [this, ctx, index](const tbb::flow::continue_msg& msg) {
+                                execute_functor(ctx, index, true);
                             });
 #ifdef TBB_PREVIEW_FLOW_GRAPH_TRACE
-                    flowgraph_node->set_name(it->second.c_str());
+                    flowgraph_node->set_name(op_names[index].c_str());
 #endif
-                    std::advance(functor, 1);
-                    nodename_tbbnode_map.insert({it->second, flowgraph_node});
-                    it++;
+                    flowgraph_nodes.push_back(flowgraph_node);
                 }
 
-                traverse_nodes(
-                    m_function, [&flowgraph_node_start, &nodename_tbbnode_map](shared_ptr<Node> n) {
-                        if (!n->is_parameter() && !n->is_constant())
-                        {
-                            bool is_head = true;
-                            for (auto arg : n->get_arguments())
-                            {
-                                if (!arg->is_parameter() && !arg->is_constant())
-                                {
-                                    is_head = false;
-                                    tbb::flow::make_edge(*(nodename_tbbnode_map[arg->get_name()]),
-                                                         *(nodename_tbbnode_map[n->get_name()]));
-                                }
-                            }
-                            if (is_head)
-                            {
-                                tbb::flow::make_edge(*flowgraph_node_start,
-                                                     *(nodename_tbbnode_map[n->get_name()]));
-                            }
-                        }
-                    });
-
-                if (m_release_function)
+                for (const auto& edge : m_functor_edges)
+                {
+                    tbb::flow::make_edge(*flowgraph_nodes[edge.first],
+                                         *flowgraph_nodes[edge.second]);
+                }
+                for (auto head : m_functor_heads)
                 {
-                    release_function();
+                    tbb::flow::make_edge(*flowgraph_node_start, *flowgraph_nodes[head]);
                 }
             }
             // Execute the flow graph
@@ -1785,13 +1903,52 @@ void runtime::cpu::CPU_ExternalFunction::build()
             {
                 throw;
             }
+            profiler_count = static_cast<int>(functors.size());
+        }
+        else if (!m_wavefronts.empty() && ctx->breakpoints.empty() && ctx->pc == 0)
+        {
+            for (const auto& wavefront : m_wavefronts)
+            {
+                auto run_group = [this, ctx, &wavefront](size_t group) {
+                    for (auto index : wavefront[group])
+                    {
+                        execute_functor(ctx, index, false);
+                    }
+                };
+                executor::GetCPUExecutor().run_parallel(wavefront.size(), run_group, ctx->arena);
+            }
+            profiler_count = static_cast<int>(functors.size());
+            ctx->pc = functors.size();
+        }
+        else if (!timing && ctx->breakpoints.empty() && ctx->pc == 0)
+        {
+            CPUExecutionContext ectx{ctx->arena};
+            if (track_stale)
+            {
+                for (size_t index = 0; index < functors.size(); index++)
+                {
+                    if (is_enabled(ctx, m_schedule[index]) || ctx->first_iteration)
+                    {
+                        functors[index](ctx, &ectx);
+                    }
+                }
+            }
+            else
+            {
+                for (auto index : m_uncached_functors)
+                {
+                    functors[index](ctx, &ectx);
+                }
+            }
+            profiler_count = static_cast<int>(functors.size());
+            ctx->pc = functors.size();
         }
         else
         {
             for (; ctx->pc < functors.size(); ctx->pc++)
             {
                 auto index = profiler_count++;
-                if ((enables.at(ctx->pc))(ctx) || ctx->first_iteration)
+                if (is_enabled(ctx, m_schedule[ctx->pc]) || ctx->first_iteration)
                 {
                     // Each Op will have exactly one functor, start the clock before the exceution of functor
                     // and collect the profiler_count once the execution complets
@@ -1799,7 +1956,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
                     {
                         start_ts = cpu::Clock::now();
                     }
-                    CPUExecutionContext ectx{0};
+                    CPUExecutionContext ectx{ctx->arena};
                     executor::GetCPUExecutor().execute(functors.at(ctx->pc), ctx, &ectx);
 
                     if (ctx->breakpoints.count(ctx->pc + 1))
@@ -1820,11 +1977,12 @@ void runtime::cpu::CPU_ExternalFunction::build()
                         }
                         if (m_emit_timing)
                         {
-                            m_perf_counters[index].m_total_microseconds +=
+                            m_perf_microseconds[index].fetch_add(
                                 std::chrono::duration_cast<std::chrono::microseconds>(end_ts -
                                                                                       start_ts)
-                                    .count();
-                            m_perf_counters[index].m_call_count++;
+                                    .count(),
+                                std::memory_order_relaxed);
+                            m_perf_call_counts[index].fetch_add(1, std::memory_order_relaxed);
                         }
                     }
                 }
@@ -1836,7 +1994,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
                     }
                     if (m_emit_timing)
                     {
-                        m_perf_counters[index].m_call_count++;
+                        m_perf_call_counts[index].fetch_add(1, std::memory_order_relaxed);
                     }
                 }
             }
@@ -1850,27 +2008,184 @@ void runtime::cpu::CPU_ExternalFunction::build()
     };
 
     m_is_built = true;
+    collect_memory_usage();
 
-    if (m_release_function && !m_use_tbb)
+    if (m_release_function)
     {
         release_function();
     }
 }
 
-void*& runtime::cpu::CPU_ExternalFunction::get_tensor_data(const std::string& name)
+void runtime::cpu::CPU_ExternalFunction::collect_memory_usage()
+{
+    m_memory_usage = MemoryUsage();
+    m_memory_usage.add_function(m_function);
+    // Generated code also allocates pools for the functions it calls
+    m_memory_usage.temporary_pool_size = 0;
+    for (auto size : m_memory_buffer_sizes)
+    {
+        m_memory_usage.temporary_pool_size += size;
+    }
+    m_memory_usage.workspace_bytes = m_mkldnn_emitter->get_mkldnn_workspace_size();
+    for (const auto& node : m_function->get_ordered_ops())
+    {
+        if (dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(node))
+        {
+            m_memory_usage.layout_conversion_bytes += node->get_output_tensor().size();
+        }
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::execute_functor(CPURuntimeContext* ctx,
+                                                         size_t index,
+                                                         bool use_tbb)
+{
+    cpu::Timestamp op_start_ts, op_end_ts;
+    if (is_enabled(ctx, m_schedule[index]) || ctx->first_iteration)
+    {
+        if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+        {
+            op_start_ts = cpu::Clock::now();
+        }
+        CPUExecutionContext ectx{ctx->arena};
+        executor::GetCPUExecutor().execute(functors[index], ctx, &ectx, use_tbb);
+        if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+        {
+            op_end_ts = cpu::Clock::now();
+
+            if (runtime::cpu::IsTracingEnabled())
+            {
+                ctx->op_durations[index] =
+                    (std::chrono::duration_cast<cpu::Timescale>(op_end_ts - op_start_ts)).count();
+            }
+            if (m_emit_timing)
+            {
+                m_perf_microseconds[index].fetch_add(
+                    std::chrono::duration_cast<std::chrono::microseconds>(op_end_ts - op_start_ts)
+                        .count(),
+                    std::memory_order_relaxed);
+                m_perf_call_counts[index].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    else
+    {
+        if (runtime::cpu::IsTracingEnabled())
+        {
+            ctx->op_durations[index] = 0;
+        }
+        if (m_emit_timing)
+        {
+            m_perf_call_counts[index].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::build_wavefront_schedule(
+    const std::vector<double>& functor_costs, size_t width)
+{
+    // Functors are in topological order, so every predecessor is leveled first
+    vector<size_t> levels(functors.size(), 0);
+    size_t num_levels = functors.empty() ? 0 : 1;
+    for (const auto& edge : m_functor_edges)
+    {
+        levels[edge.second] = std::max(levels[edge.second], levels[edge.first] + 1);
+        num_levels = std::max(num_levels, levels[edge.second] + 1);
+    }
+
+    vector<vector<size_t>> level_functors(num_levels);
+    for (size_t index = 0; index < functors.size(); index++)
+    {
+        level_functors[levels[index]].push_back(index);
+    }
+
+    for (auto& level : level_functors)
+    {
+        // Longest processing time first: place the costliest functor on the least
+        // loaded group, then run each group's functors in their original order
+        size_t num_groups = std::min(width, level.size());
+        vector<size_t> by_cost = level;
+        stable_sort(by_cost.begin(), by_cost.end(), [&](size_t a, size_t b) {
+            return functor_costs[a] > functor_costs[b];
+        });
+        vector<vector<size_t>> groups(num_groups);
+        vector<double> loads(num_groups, 0);
+        for (auto index : by_cost)
+        {
+            size_t group = static_cast<size_t>(
+                std::distance(loads.begin(), std::min_element(loads.begin(), loads.end())));
+            groups[group].push_back(index);
+            loads[group] += functor_costs[index];
+        }
+        for (auto& group : groups)
+        {
+            sort(group.begin(), group.end());
+        }
+        m_wavefronts.push_back(move(groups));
+    }
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_raw_buffer_index(const std::string& name)
+{
+    auto it = m_buffer_indices.find(name);
+    if (it == m_buffer_indices.end())
+    {
+        if (m_is_built)
+        {
+            throw ngraph_error("Unknown tensor " + name + " in " + m_function_name);
+        }
+        it = m_buffer_indices.emplace(name, m_buffer_indices.size()).first;
+    }
+    return it->second;
+}
+
+const list<pair<size_t, void*>>&
+    runtime::cpu::CPU_ExternalFunction::get_constant_tensor_data(int numa_node, int arena)
+{
+    // Constants smaller than this are not worth a replica per node
+    static const size_t s_numa_replica_threshold = 64 * 1024;
+
+    lock_guard<mutex> lock(m_numa_mutex);
+    auto it = m_numa_constant_tensor_data.find(numa_node);
+    if (it != m_numa_constant_tensor_data.end())
+    {
+        return it->second;
+    }
+
+    auto& cpu_executor = executor::GetCPUExecutor();
+    auto& constants = m_numa_constant_tensor_data[numa_node];
+    for (auto& c : constant_tensor_data)
+    {
+        auto data = get<1>(c);
+        auto size = get<2>(c);
+        if (numa_node >= 0 && size >= s_numa_replica_threshold)
+        {
+            auto replica =
+                new AlignedBuffer(size, s_memory_pool_alignment, cpu_executor.get_allocator());
+            m_numa_constant_replicas.emplace_back(replica);
+            cpu_executor.first_touch(replica->get_ptr(), data, size, arena);
+            cpu_executor.get_numa_counters().replicated_constant_bytes += size;
+            data = replica->get_ptr();
+        }
+        constants.emplace_back(get<0>(c), data);
+    }
+    return constants;
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_buffer_index(const std::string& name)
 {
     if (tensor_alias.count(name))
     {
-        return tensor_data[tensor_alias[name]];
+        return get_raw_buffer_index(tensor_alias[name]);
     }
     else
     {
-        return tensor_data[name];
+        return get_raw_buffer_index(name);
     }
 }
 
 shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
-    runtime::cpu::CPU_ExternalFunction::make_call_frame()
+    runtime::cpu::CPU_ExternalFunction::make_call_frame(shared_ptr<CPUSharedArena> shared_arena)
 {
 #if !defined(NGRAPH_DEX_ONLY)
     if (!m_is_compiled && !m_direct_execution)
@@ -1884,8 +2199,8 @@ shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
         build();
     }
 
-    return make_shared<ngraph::runtime::cpu::CPU_CallFrame>(shared_from_this(),
-                                                            m_compiled_function);
+    return make_shared<ngraph::runtime::cpu::CPU_CallFrame>(
+        shared_from_this(), m_compiled_function, shared_arena);
 }
 
 const runtime::cpu::LayoutDescriptorPtrs&
@@ -1900,8 +2215,18 @@ const runtime::cpu::LayoutDescriptorPtrs&
     return result_layout_descriptors;
 }
 
-const vector<runtime::PerformanceCounter>& runtime::cpu::CPU_ExternalFunction::get_perf_counters()
+vector<runtime::PerformanceCounter> runtime::cpu::CPU_ExternalFunction::get_perf_counters()
 {
+    lock_guard<mutex> lock(m_perf_counters_mutex);
+    if (m_perf_call_counts)
+    {
+        for (size_t i = 0; i < m_perf_counters.size(); i++)
+        {
+            m_perf_counters[i].m_total_microseconds =
+                m_perf_microseconds[i].load(std::memory_order_relaxed);
+            m_perf_counters[i].m_call_count = m_perf_call_counts[i].load(std::memory_order_relaxed);
+        }
+    }
 #if !defined(NGRAPH_DEX_ONLY)
     // Codegen. Retrieve perf counters from compiled module
     if (m_execution_engine)
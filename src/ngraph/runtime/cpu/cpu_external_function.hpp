@@ -16,11 +16,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <tuple>
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
@@ -42,10 +45,12 @@
 #include "ngraph/function.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
+#include "ngraph/runtime/memory_usage.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/state/state.hpp"
 
@@ -58,6 +63,7 @@ namespace ngraph
             class CPU_ExternalFunction;
             class CPU_Emitter;
             class CPU_CallFrame;
+            class CPUSharedArena;
             class CPU_Debugger;
 
 #if !defined(NGRAPH_DEX_ONLY)
@@ -104,7 +110,8 @@ namespace ngraph
                 CPU_ExternalFunction(const std::shared_ptr<ngraph::Function>& function,
                                      bool release_function = true);
                 ~CPU_ExternalFunction();
-                std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> make_call_frame();
+                std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
+                    make_call_frame(std::shared_ptr<CPUSharedArena> shared_arena = nullptr);
 
                 const LayoutDescriptorPtrs& get_parameter_layout_descriptors();
                 const LayoutDescriptorPtrs& get_result_layout_descriptors();
@@ -130,8 +137,10 @@ namespace ngraph
                 static constexpr size_t s_memory_pool_alignment = 4096;
 
                 std::vector<CPUKernelFunctor>& get_functors() { return functors; }
-                std::unordered_map<std::string, void*>& get_tensor_data() { return tensor_data; }
-                void*& get_tensor_data(const std::string& name);
+                // Returns the slot in CPURuntimeContext::buffer_data that holds the
+                // base address of the named tensor in every call frame
+                size_t get_buffer_index(const std::string& name);
+                size_t get_buffer_size() const { return m_buffer_indices.size(); }
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
                     get_executor()
                 {
@@ -147,7 +156,10 @@ namespace ngraph
                                    const std::string& directory,
                                    const std::string& filename);
 
-                const std::vector<PerformanceCounter>& get_perf_counters();
+                // Snapshot of the counters; call frames keep updating them while it is taken
+                std::vector<PerformanceCounter> get_perf_counters();
+                // Memory breakdown recorded when the function was compiled
+                const MemoryUsage& get_memory_usage() const { return m_memory_usage; }
 
 #if defined(NGRAPH_HALIDE)
                 std::unordered_map<std::string, Halide::Func>& get_halide_functions()
@@ -162,10 +174,9 @@ namespace ngraph
                 {
                     return subgraph_param_sizes;
                 }
-                std::unordered_map<std::string, std::reference_wrapper<void*>>&
-                    get_subgraph_param_ptrs()
+                std::unordered_map<std::string, size_t>& get_subgraph_param_indices()
                 {
-                    return subgraph_param_ptrs;
+                    return subgraph_param_indices;
                 }
 #endif
 
@@ -209,8 +220,47 @@ namespace ngraph
                 // Find in-place slice ops and set appropriate memory pool offset for its output
                 void process_in_place_slice(std::list<std::shared_ptr<Node>> nodes);
 
+                // Stale tracking of one functor, flattened into ranges of
+                // m_schedule_buffers so that DEX needs no closure per op
+                struct ScheduledOp
+                {
+                    size_t inputs_begin;
+                    size_t outputs_begin;
+                    size_t outputs_end;
+                    bool always_enabled;
+                };
+
+                // An op runs when it computes a result or any of its inputs is stale;
+                // its outputs are stale exactly when it runs
+                bool is_enabled(CPURuntimeContext* ctx, const ScheduledOp& op) const
+                {
+                    bool enabled = op.always_enabled;
+                    for (size_t i = op.inputs_begin; !enabled && i < op.outputs_begin; i++)
+                    {
+                        enabled = ctx->buffer_stale[m_schedule_buffers[i]];
+                    }
+                    for (size_t i = op.outputs_begin; i < op.outputs_end; i++)
+                    {
+                        ctx->buffer_stale[m_schedule_buffers[i]] = enabled;
+                    }
+                    return enabled;
+                }
+
                 bool computes_result(Node* node);
                 void release_function() { m_function = nullptr; }
+                // Records the memory breakdown while the graph is still available
+                void collect_memory_usage();
+                size_t get_raw_buffer_index(const std::string& name);
+                // Runs a single functor if its inputs changed, recording its timing
+                void execute_functor(CPURuntimeContext* ctx, size_t index, bool use_tbb);
+                // Levels the functor dependency graph into wavefronts of independent
+                // functors, each split into at most width groups of similar estimated time
+                void build_wavefront_schedule(const std::vector<double>& functor_costs,
+                                              size_t width);
+                // Constant addresses for a call frame bound to numa_node (-1 if unbound).
+                // Large constants are replicated once per node on first use.
+                const std::list<std::pair<size_t, void*>>&
+                    get_constant_tensor_data(int numa_node, int arena);
 #if !defined(NGRAPH_DEX_ONLY)
                 void emit_debug_function_entry(codegen::CodeWriter& writer,
                                                Node* node,
@@ -260,6 +310,7 @@ namespace ngraph
                 LayoutDescriptorPtrs parameter_layout_descriptors;
                 LayoutDescriptorPtrs result_layout_descriptors;
                 std::vector<size_t> m_memory_buffer_sizes;
+                MemoryUsage m_memory_usage;
                 std::vector<OpAttributes> m_op_attrs;
 
                 std::unique_ptr<MKLDNNEmitter> m_mkldnn_emitter;
@@ -268,28 +319,49 @@ namespace ngraph
 
                 std::vector<CPUKernelFunctor> functors;
                 std::vector<std::string> op_names;
-                std::vector<std::function<bool(CPURuntimeContext*)>> enables;
-                std::list<std::pair<std::function<bool(CPURuntimeContext*)>, std::string>>
-                    enable_nodename_list;
+                std::vector<ScheduledOp> m_schedule;
+                // Input buffer indices followed by output buffer indices of every functor
+                std::vector<size_t> m_schedule_buffers;
+                // Functors that run when no function input is cached
+                std::vector<size_t> m_uncached_functors;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>
                     executor;
-                std::unordered_map<std::string, void*> tensor_data;
-                std::unordered_map<std::string, bool> tensor_stale;
+                std::unordered_map<std::string, size_t> m_buffer_indices;
                 std::unordered_map<std::string, std::string> tensor_alias;
-                std::list<std::pair<std::reference_wrapper<void*>, size_t>> intermediates_offsets;
-                std::list<
-                    std::tuple<std::reference_wrapper<void*>, size_t, std::reference_wrapper<bool>>>
-                    function_input_index;
-                std::list<std::pair<std::reference_wrapper<void*>, size_t>> function_output_index;
+                std::list<std::pair<size_t, size_t>> intermediates_offsets;
+                // Buffer index, data and size of every constant
+                std::list<std::tuple<size_t, void*, size_t>> constant_tensor_data;
+                std::map<int, std::list<std::pair<size_t, void*>>> m_numa_constant_tensor_data;
+                std::vector<std::unique_ptr<AlignedBuffer>> m_numa_constant_replicas;
+                std::mutex m_numa_mutex;
+                std::list<std::pair<size_t, size_t>> function_input_index;
+                std::list<std::pair<size_t, size_t>> function_output_index;
+                // Dependencies between functors used to build the TBB flow graph of
+                // each call frame after the function has been released. Besides data
+                // dependencies these order functors that touch overlapping pool memory.
+                std::vector<std::pair<size_t, size_t>> m_functor_edges;
+                std::vector<size_t> m_functor_heads;
+                // Wavefronts of functor groups; the groups of a wavefront run concurrently
+                std::vector<std::vector<std::vector<size_t>>> m_wavefronts;
+                // Serializes compiled (codegen) entry points that share op states
+                // between call frames
+                std::mutex m_compiled_function_mutex;
+                // Set while a call frame holds the primitives and workspaces of
+                // m_mkldnn_emitter; frames created meanwhile build their own
+                std::atomic<bool> m_mkldnn_primitives_in_use{false};
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
+                std::mutex m_perf_counters_mutex;
+                // Updated by concurrent call frames and read into m_perf_counters
+                std::unique_ptr<std::atomic<size_t>[]> m_perf_microseconds;
+                std::unique_ptr<std::atomic<size_t>[]> m_perf_call_counts;
 
 #if defined(NGRAPH_HALIDE)
                 std::unordered_map<std::string, Halide::Func> halide_functions;
                 std::unordered_map<std::string, Halide::ImageParam> subgraph_params;
                 std::unordered_map<std::string, int> subgraph_param_sizes;
-                std::unordered_map<std::string, std::reference_wrapper<void*>> subgraph_param_ptrs;
+                std::unordered_map<std::string, size_t> subgraph_param_indices;
 #endif
             };
         }
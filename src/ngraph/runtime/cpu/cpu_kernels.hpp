@@ -119,6 +119,8 @@ namespace mkl
                        size_t lda,
                        float* B,
                        size_t ldb);
+    int MKL_Set_Num_Threads_Local(int nth);
+    int MKL_Get_Max_Threads();
     }
 }
 
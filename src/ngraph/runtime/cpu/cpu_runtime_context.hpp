@@ -65,6 +65,10 @@ namespace ngraph
                 State* const* states;
                 std::set<size_t> breakpoints;
                 size_t pc;
+                void** buffer_data;
+                bool* buffer_stale;
+                int arena;
+                int numa_node;
             };
             }
 
@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/runtime/cpu/cpu_shared_arena.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+void runtime::cpu::CPUSharedArena::acquire(CPURuntimeContext* ctx, const vector<size_t>& sizes)
+{
+    Pools* pools;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto& idle = m_idle_pools[ctx->arena];
+        // The set ctx used last, else the idle set with the most memory allocated
+        auto it = find_if(idle.begin(), idle.end(), [ctx](const unique_ptr<Pools>& p) {
+            return p->m_last_user == ctx;
+        });
+        if (it == idle.end())
+        {
+            it = max_element(idle.begin(),
+                             idle.end(),
+                             [](const unique_ptr<Pools>& a, const unique_ptr<Pools>& b) {
+                                 return a->get_size() < b->get_size();
+                             });
+        }
+        auto& used = m_used_pools[ctx];
+        if (it == idle.end())
+        {
+            used.reset(new Pools);
+        }
+        else
+        {
+            used = move(*it);
+            idle.erase(it);
+        }
+        pools = used.get();
+        if (pools->m_buffers.size() < sizes.size())
+        {
+            pools->m_buffers.resize(sizes.size());
+        }
+    }
+
+    // The set is held by this call only, so it grows outside the lock
+    bool grown = false;
+    auto& buffers = pools->m_buffers;
+    for (size_t i = 0; i < sizes.size(); i++)
+    {
+        if (!buffers[i] || buffers[i]->size() < sizes[i])
+        {
+            auto& cpu_executor = executor::GetCPUExecutor();
+            unique_ptr<AlignedBuffer> buffer(
+                new AlignedBuffer(sizes[i],
+                                  runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment,
+                                  cpu_executor.get_allocator()));
+            if (cpu_executor.get_numa_node(ctx->arena) >= 0)
+            {
+                cpu_executor.first_touch(buffer->get_ptr(), nullptr, sizes[i], ctx->arena);
+            }
+            {
+                lock_guard<mutex> lock(m_mutex);
+                buffers[i] = move(buffer);
+            }
+            grown = true;
+        }
+        ctx->memory_buffers[i] = buffers[i].get();
+    }
+
+    if (grown || pools->m_last_user != ctx)
+    {
+        // Pointers into the pools and intermediates cached in them are stale
+        ctx->first_iteration = true;
+        pools->m_last_user = ctx;
+    }
+}
+
+void runtime::cpu::CPUSharedArena::release(CPURuntimeContext* ctx)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_used_pools.find(ctx);
+    if (it != m_used_pools.end())
+    {
+        m_idle_pools[ctx->arena].push_back(move(it->second));
+        m_used_pools.erase(it);
+    }
+}
+
+size_t runtime::cpu::CPUSharedArena::get_allocated_size() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    size_t size = 0;
+    for (const auto& idle : m_idle_pools)
+    {
+        for (const auto& pools : idle.second)
+        {
+            size += pools->get_size();
+        }
+    }
+    for (const auto& used : m_used_pools)
+    {
+        size += used.second->get_size();
+    }
+    return size;
+}
+
+size_t runtime::cpu::CPUSharedArena::Pools::get_size() const
+{
+    size_t size = 0;
+    for (const auto& buffer : m_buffers)
+    {
+        size += buffer ? buffer->size() : 0;
+    }
+    return size;
+}
@@ -0,0 +1,69 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Intermediate memory pools shared by the call frames of all functions of a
+            // backend. Each executor arena (stream) keeps sets of pools, each grown to the
+            // largest sizes any frame using it needed. A call takes an idle set for its
+            // duration, so concurrent calls on a stream each get their own set, and resident
+            // memory scales with the number of calls in flight rather than the number of
+            // compiled functions.
+            class CPUSharedArena
+            {
+            public:
+                // Points ctx->memory_buffers at a set of pools of ctx->arena, grown to at
+                // least sizes, and holds it until release. The set ctx used last is preferred.
+                // If another frame used the set since, ctx->first_iteration is set so that no
+                // intermediate cached in it is reused.
+                void acquire(CPURuntimeContext* ctx, const std::vector<size_t>& sizes);
+                void release(CPURuntimeContext* ctx);
+
+                // Bytes allocated across all streams
+                size_t get_allocated_size() const;
+
+            private:
+                struct Pools
+                {
+                    size_t get_size() const;
+
+                    std::vector<std::unique_ptr<AlignedBuffer>> m_buffers;
+                    const CPURuntimeContext* m_last_user = nullptr;
+                };
+
+                // Idle sets of each arena
+                std::map<int, std::vector<std::unique_ptr<Pools>>> m_idle_pools;
+                // Sets held by a call, by the context of its frame
+                std::map<const CPURuntimeContext*, std::unique_ptr<Pools>> m_used_pools;
+                mutable std::mutex m_mutex;
+            };
+        }
+    }
+}
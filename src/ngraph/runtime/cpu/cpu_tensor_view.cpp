@@ -37,6 +37,7 @@ runtime::cpu::CPUTensorView::CPUTensorView(const ngraph::element::Type& element_
                                            void* memory_pointer,
                                            const string& name)
     : runtime::Tensor(std::make_shared<ngraph::descriptor::Tensor>(element_type, shape, name))
+    , allocator(Allocator::get_default())
     , buffer(nullptr)
     , aligned_buffer(nullptr)
 {
@@ -54,24 +55,8 @@ runtime::cpu::CPUTensorView::CPUTensorView(const ngraph::element::Type& element_
     }
     else if (buffer_size > 0)
     {
-        size_t allocation_size = buffer_size + BufferAlignment;
-        auto ptr = malloc(allocation_size);
-        if (!ptr)
-        {
-            throw ngraph_error("Error allocating CPU Tensor View memory");
-        }
-        buffer = static_cast<char*>(ptr);
-
-// GCC major versions below 5 do not implement C++11 std::align
-#if !defined(__GNUC__) || __GNUC__ >= 5
-        std::align(BufferAlignment, buffer_size, ptr, allocation_size);
-#else
-        ptr = static_cast<char*>(ptr) + (BufferAlignment - 1);
-        ptr = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(ptr) &
-                                      ~(uintptr_t(BufferAlignment - 1)));
-#endif
-
-        aligned_buffer = static_cast<char*>(ptr);
+        buffer = static_cast<char*>(allocator->allocate(buffer_size, BufferAlignment));
+        aligned_buffer = buffer;
     }
 }
 
@@ -84,7 +69,10 @@ runtime::cpu::CPUTensorView::CPUTensorView(const ngraph::element::Type& element_
 
 runtime::cpu::CPUTensorView::~CPUTensorView()
 {
-    free(buffer);
+    if (buffer != nullptr)
+    {
+        allocator->deallocate(buffer, buffer_size, BufferAlignment);
+    }
 }
 
 char* runtime::cpu::CPUTensorView::get_data_ptr()
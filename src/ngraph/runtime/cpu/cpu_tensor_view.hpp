@@ -18,6 +18,7 @@
 
 #include <string>
 
+#include "ngraph/runtime/allocator.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -64,6 +65,7 @@ namespace ngraph
                 CPUTensorView(CPUTensorView&&) = delete;
                 CPUTensorView& operator=(const CPUTensorView&) = delete;
 
+                std::shared_ptr<Allocator> allocator;
                 char* buffer;
                 char* aligned_buffer;
                 size_t buffer_size;
@@ -0,0 +1,210 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace loop_kernel
+                {
+                    enum class Opcode
+                    {
+                        Abs,
+                        Add,
+                        Divide,
+                        Exp,
+                        Maximum,
+                        Minimum,
+                        Multiply,
+                        Negative,
+                        Relu,
+                        Sigmoid,
+                        Sqrt,
+                        Subtract,
+                        Tanh
+                    };
+
+                    /// \brief Where a value of the kernel lives while a block is computed
+                    struct Slot
+                    {
+                        enum class Kind
+                        {
+                            Input,
+                            Output,
+                            Register
+                        };
+                        Kind kind;
+                        /// Input or output (an index into the kernel's arguments or results when
+                        /// compiled, into the function's buffers when run), or scratch register
+                        size_t index;
+                        /// If set, the slot is filled at the start of each block from input
+                        /// source, element i reading (i / inner) % size
+                        bool broadcast;
+                        size_t source;
+                        size_t inner;
+                        size_t size;
+                    };
+
+                    struct Instruction
+                    {
+                        Opcode opcode;
+                        size_t result;
+                        size_t arg0;
+                        size_t arg1;
+                    };
+
+                    /// \brief A fused elementwise expression, evaluated one block of elements at
+                    ///     a time so that intermediate values stay in cache
+                    struct Program
+                    {
+                        std::vector<Slot> slots;
+                        std::vector<Instruction> instructions;
+                        size_t register_count = 0;
+                    };
+
+                    // Elements per block; a multiple of every SIMD width
+                    static const size_t block_size = 2048;
+
+                    template <typename ElementType>
+                    void execute_block(const Program& program,
+                                       void** buffers,
+                                       ElementType* scratch,
+                                       ElementType** values,
+                                       size_t start,
+                                       size_t count)
+                    {
+                        for (size_t s = 0; s < program.slots.size(); s++)
+                        {
+                            const Slot& slot = program.slots[s];
+                            switch (slot.kind)
+                            {
+                            case Slot::Kind::Input:
+                            case Slot::Kind::Output:
+                                values[s] = static_cast<ElementType*>(buffers[slot.index]) + start;
+                                break;
+                            case Slot::Kind::Register:
+                                values[s] = scratch + slot.index * block_size;
+                                break;
+                            }
+                            if (slot.broadcast)
+                            {
+                                const ElementType* source =
+                                    static_cast<const ElementType*>(buffers[slot.source]);
+                                ElementType* target = values[s];
+                                size_t index = (start / slot.inner) % slot.size;
+                                size_t repeat = start % slot.inner;
+                                for (size_t i = 0; i < count; i++)
+                                {
+                                    target[i] = source[index];
+                                    if (++repeat == slot.inner)
+                                    {
+                                        repeat = 0;
+                                        if (++index == slot.size)
+                                        {
+                                            index = 0;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+
+                        using Array = Eigen::Array<ElementType, Eigen::Dynamic, 1>;
+                        for (const Instruction& instruction : program.instructions)
+                        {
+                            Eigen::Map<Array> out(values[instruction.result], count);
+                            Eigen::Map<const Array> in0(values[instruction.arg0], count);
+                            Eigen::Map<const Array> in1(values[instruction.arg1], count);
+                            switch (instruction.opcode)
+                            {
+                            case Opcode::Abs: out = in0.abs(); break;
+                            case Opcode::Add: out = in0 + in1; break;
+                            case Opcode::Divide: out = in0 / in1; break;
+                            case Opcode::Exp: out = in0.exp(); break;
+                            case Opcode::Maximum: out = in0.max(in1); break;
+                            case Opcode::Minimum: out = in0.min(in1); break;
+                            case Opcode::Multiply: out = in0 * in1; break;
+                            case Opcode::Negative: out = -in0; break;
+                            case Opcode::Relu: out = in0.max(ElementType(0)); break;
+                            case Opcode::Sigmoid:
+                                out = ElementType(1) / (ElementType(1) + (-in0).exp());
+                                break;
+                            case Opcode::Sqrt: out = in0.sqrt(); break;
+                            case Opcode::Subtract: out = in0 - in1; break;
+                            case Opcode::Tanh: out = in0.tanh(); break;
+                            }
+                        }
+                    }
+
+                    /// \brief Evaluates program over count elements of buffers, one block per
+                    ///     task
+                    template <typename ElementType>
+                    void loop_kernel(const Program& program,
+                                     void** buffers,
+                                     size_t count,
+                                     int arena)
+                    {
+                        size_t blocks = (count + block_size - 1) / block_size;
+                        auto run_blocks = [&](Eigen::Index first, Eigen::Index last) {
+                            // Each pool thread keeps its scratch space across tasks and calls;
+                            // it only grows for a larger kernel
+                            static thread_local std::vector<ElementType> scratch;
+                            static thread_local std::vector<ElementType*> values;
+                            if (scratch.size() < program.register_count * block_size)
+                            {
+                                scratch.resize(program.register_count * block_size);
+                            }
+                            if (values.size() < program.slots.size())
+                            {
+                                values.resize(program.slots.size());
+                            }
+                            for (Eigen::Index block = first; block < last; block++)
+                            {
+                                size_t start = block * block_size;
+                                execute_block<ElementType>(program,
+                                                           buffers,
+                                                           scratch.data(),
+                                                           values.data(),
+                                                           start,
+                                                           std::min(block_size, count - start));
+                            }
+                        };
+
+                        double bytes = double(program.slots.size()) * block_size *
+                                       sizeof(ElementType);
+                        Eigen::TensorOpCost cost(
+                            bytes, bytes, double(program.instructions.size()) * block_size);
+                        ngraph::runtime::cpu::executor::GetCPUExecutor()
+                            .get_device(arena)
+                            .parallelFor(blocks, cost, run_blocks);
+                    }
+                }
+            }
+        }
+    }
+}
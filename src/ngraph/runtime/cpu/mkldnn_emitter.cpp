@@ -48,12 +48,52 @@ const std::vector<char*>& MKLDNNEmitter::get_mkldnn_workspaces()
     return m_workspace_bufs;
 }
 
-size_t MKLDNNEmitter::insert_primitive(mkldnn::primitive* primitive)
+size_t MKLDNNEmitter::get_mkldnn_workspace_size() const
 {
-    m_mkldnn_primitives.emplace_back(primitive);
+    size_t size = 0;
+    for (const auto& workspace : m_workspaces)
+    {
+        size += workspace->size;
+    }
+    return size;
+}
+
+size_t MKLDNNEmitter::insert_primitive(const PrimitiveFactory& factory)
+{
+    m_mkldnn_primitives.emplace_back(factory(m_mkldnn_primitives));
+    m_primitive_factories.push_back(factory);
     return (m_mkldnn_primitives.size() - 1);
 }
 
+std::vector<mkldnn::primitive*> MKLDNNEmitter::build_primitive_replicas() const
+{
+    std::vector<mkldnn::primitive*> primitives;
+    try
+    {
+        for (const auto& factory : m_primitive_factories)
+        {
+            primitives.push_back(factory(primitives));
+        }
+    }
+    catch (...)
+    {
+        for (auto p : primitives)
+            delete p;
+        throw;
+    }
+    return primitives;
+}
+
+std::vector<std::unique_ptr<MKLDNNWorkspace>> MKLDNNEmitter::build_workspace_replicas() const
+{
+    std::vector<std::unique_ptr<MKLDNNWorkspace>> workspaces;
+    for (const auto& workspace : m_workspaces)
+    {
+        workspaces.emplace_back(new MKLDNNWorkspace(workspace->size));
+    }
+    return workspaces;
+}
+
 size_t MKLDNNEmitter::insert_workspace(std::unique_ptr<MKLDNNWorkspace>& workspace)
 {
     m_workspace_bufs.push_back(workspace.get()->buf);
@@ -119,8 +159,9 @@ mkldnn::memory::desc
 
 size_t MKLDNNEmitter::build_memory_primitive(const mkldnn::memory::desc& desc)
 {
-    size_t index =
-        insert_primitive(new mkldnn::memory({desc, executor::global_cpu_engine}, nullptr));
+    size_t index = insert_primitive([=](const std::vector<mkldnn::primitive*>&) {
+        return new mkldnn::memory({desc, executor::global_cpu_engine}, nullptr);
+    });
     return index;
 }
 
@@ -136,8 +177,9 @@ size_t MKLDNNEmitter::build_quantize_reorder(const mkldnn::memory::desc& input_d
     auto reorder_desc = mkldnn::reorder::primitive_desc({input_desc, executor::global_cpu_engine},
                                                         {result_desc, executor::global_cpu_engine},
                                                         attr);
-    size_t primitive_index = insert_primitive(new mkldnn::reorder(
-        reorder_desc, *m_mkldnn_primitives[input_index], *m_mkldnn_primitives[result_index]));
+    size_t primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::reorder(reorder_desc, *p[input_index], *p[result_index]);
+    });
     m_primitive_deps[primitive_index] = {input_index, result_index};
     return primitive_index;
 }
@@ -243,25 +285,25 @@ size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& inpu
     size_t conv_index = 0;
     try
     {
-        auto conv_prim = new mkldnn::convolution_forward(
-            {{mkldnn::prop_kind::forward,
-              mkldnn::algorithm::convolution_direct,
-              input_data_desc,
-              weights_desc,
-              result_desc,
-              mkldnn::memory::dims(strides.begin(), strides.end()),
-              mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
-              mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-              mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
-              mkldnn::padding_kind::zero},
-
-             conv_attr,
-             executor::global_cpu_engine},
-            *m_mkldnn_primitives[input_data_index],
-            *m_mkldnn_primitives[weights_index],
-            *m_mkldnn_primitives[result_index]);
-
-        conv_index = insert_primitive(conv_prim);
+        conv_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+            return new mkldnn::convolution_forward(
+                {{mkldnn::prop_kind::forward,
+                  mkldnn::algorithm::convolution_direct,
+                  input_data_desc,
+                  weights_desc,
+                  result_desc,
+                  mkldnn::memory::dims(strides.begin(), strides.end()),
+                  mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
+                  mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+                  mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+                  mkldnn::padding_kind::zero},
+
+                 conv_attr,
+                 executor::global_cpu_engine},
+                *p[input_data_index],
+                *p[weights_index],
+                *p[result_index]);
+        });
 
         m_primitive_deps[conv_index] = {input_data_index, weights_index, result_index};
     }
@@ -294,22 +336,24 @@ size_t
     conv_attr.set_int_output_round_mode(mkldnn::round_mode::round_nearest);
     /* Specify the scales array and corresponding mask */
     conv_attr.set_output_scales(0, output_scale);
-    size_t conv_index = insert_primitive(new mkldnn::convolution_forward(
-        {{mkldnn::prop_kind::forward,
-          mkldnn::algorithm::convolution_direct,
-          input_data_desc,
-          weights_desc,
-          result_desc,
-          mkldnn::memory::dims(strides.begin(), strides.end()),
-          mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
-          mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-          mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
-          mkldnn::padding_kind::zero},
-         conv_attr,
-         executor::global_cpu_engine},
-        *m_mkldnn_primitives[input_data_index],
-        *m_mkldnn_primitives[weights_index],
-        *m_mkldnn_primitives[result_index]));
+    size_t conv_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::convolution_forward(
+            {{mkldnn::prop_kind::forward,
+              mkldnn::algorithm::convolution_direct,
+              input_data_desc,
+              weights_desc,
+              result_desc,
+              mkldnn::memory::dims(strides.begin(), strides.end()),
+              mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
+              mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+              mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+              mkldnn::padding_kind::zero},
+             conv_attr,
+             executor::global_cpu_engine},
+            *p[input_data_index],
+            *p[weights_index],
+            *p[result_index]);
+    });
     m_primitive_deps[conv_index] = {input_data_index, weights_index, result_index};
     return conv_index;
 }
@@ -338,24 +382,26 @@ size_t
     conv_attr.set_int_output_round_mode(mkldnn::round_mode::round_nearest);
     /* Specify the scales array and corresponding mask */
     conv_attr.set_output_scales(0, output_scale);
-    size_t conv_index = insert_primitive(new mkldnn::convolution_forward(
-        {{mkldnn::prop_kind::forward,
-          mkldnn::algorithm::convolution_direct,
-          input_data_desc,
-          weights_desc,
-          bias_desc,
-          result_desc,
-          mkldnn::memory::dims(strides.begin(), strides.end()),
-          mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
-          mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-          mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
-          mkldnn::padding_kind::zero},
-         conv_attr,
-         executor::global_cpu_engine},
-        *m_mkldnn_primitives[input_data_index],
-        *m_mkldnn_primitives[weights_index],
-        *m_mkldnn_primitives[bias_index],
-        *m_mkldnn_primitives[result_index]));
+    size_t conv_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::convolution_forward(
+            {{mkldnn::prop_kind::forward,
+              mkldnn::algorithm::convolution_direct,
+              input_data_desc,
+              weights_desc,
+              bias_desc,
+              result_desc,
+              mkldnn::memory::dims(strides.begin(), strides.end()),
+              mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
+              mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+              mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+              mkldnn::padding_kind::zero},
+             conv_attr,
+             executor::global_cpu_engine},
+            *p[input_data_index],
+            *p[weights_index],
+            *p[bias_index],
+            *p[result_index]);
+    });
     m_primitive_deps[conv_index] = {input_data_index, weights_index, bias_index, result_index};
     return conv_index;
 }
@@ -381,24 +427,26 @@ size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& inpu
     size_t conv_index = -1;
     try
     {
-        conv_index = insert_primitive(new mkldnn::convolution_forward(
-            {{mkldnn::prop_kind::forward,
-              mkldnn::algorithm::convolution_direct,
-              input_data_desc,
-              weights_desc,
-              bias_desc,
-              result_desc,
-              mkldnn::memory::dims(strides.begin(), strides.end()),
-              mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
-              mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-              mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
-              mkldnn::padding_kind::zero},
-             conv_attr,
-             executor::global_cpu_engine},
-            *m_mkldnn_primitives[input_data_index],
-            *m_mkldnn_primitives[weights_index],
-            *m_mkldnn_primitives[bias_index],
-            *m_mkldnn_primitives[result_index]));
+        conv_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+            return new mkldnn::convolution_forward(
+                {{mkldnn::prop_kind::forward,
+                  mkldnn::algorithm::convolution_direct,
+                  input_data_desc,
+                  weights_desc,
+                  bias_desc,
+                  result_desc,
+                  mkldnn::memory::dims(strides.begin(), strides.end()),
+                  mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
+                  mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+                  mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+                  mkldnn::padding_kind::zero},
+                 conv_attr,
+                 executor::global_cpu_engine},
+                *p[input_data_index],
+                *p[weights_index],
+                *p[bias_index],
+                *p[result_index]);
+        });
 
         m_primitive_deps[conv_index] = {input_data_index, weights_index, bias_index, result_index};
     }
@@ -455,12 +503,13 @@ size_t MKLDNNEmitter::build_convolution_backward_weights_bias(
         executor::global_cpu_engine,
         fwd_pd};
 
-    const size_t conv_index = insert_primitive(
-        new mkldnn::convolution_backward_weights(bwd_pd,
-                                                 *m_mkldnn_primitives[in_data_index],
-                                                 *m_mkldnn_primitives[in_delta_index],
-                                                 *m_mkldnn_primitives[out_weights_delta_index],
-                                                 *m_mkldnn_primitives[out_bias_delta_index]));
+    const size_t conv_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::convolution_backward_weights(bwd_pd,
+                                                        *p[in_data_index],
+                                                        *p[in_delta_index],
+                                                        *p[out_weights_delta_index],
+                                                        *p[out_bias_delta_index]);
+    });
 
     m_primitive_deps[conv_index] = {
         in_data_index, in_delta_index, out_weights_delta_index, out_bias_delta_index};
@@ -480,32 +529,34 @@ size_t
     size_t delta_index = build_memory_primitive(delta_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
-    size_t primitive_index = insert_primitive(new mkldnn::convolution_backward_weights(
-        {{mkldnn::algorithm::convolution_direct,
-          input_desc,
-          result_desc,
-          delta_desc,
-          mkldnn::memory::dims(strides.begin(), strides.end()),
-          mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
-          mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-          mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
-          mkldnn::padding_kind::zero},
-         executor::global_cpu_engine,
-         // Forward primitive descriptor corresponding to this backward weights descriptor
-         {{mkldnn::prop_kind::forward,
-           mkldnn::algorithm::convolution_direct,
-           input_desc,
-           result_desc,
-           delta_desc,
-           mkldnn::memory::dims(strides.begin(), strides.end()),
-           mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
-           mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-           mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
-           mkldnn::padding_kind::zero},
-          executor::global_cpu_engine}},
-        *m_mkldnn_primitives[input_index],
-        *m_mkldnn_primitives[delta_index],
-        *m_mkldnn_primitives[result_index]));
+    size_t primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::convolution_backward_weights(
+            {{mkldnn::algorithm::convolution_direct,
+              input_desc,
+              result_desc,
+              delta_desc,
+              mkldnn::memory::dims(strides.begin(), strides.end()),
+              mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
+              mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+              mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+              mkldnn::padding_kind::zero},
+             executor::global_cpu_engine,
+             // Forward primitive descriptor corresponding to this backward weights descriptor
+             {{mkldnn::prop_kind::forward,
+               mkldnn::algorithm::convolution_direct,
+               input_desc,
+               result_desc,
+               delta_desc,
+               mkldnn::memory::dims(strides.begin(), strides.end()),
+               mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
+               mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+               mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+               mkldnn::padding_kind::zero},
+              executor::global_cpu_engine}},
+            *p[input_index],
+            *p[delta_index],
+            *p[result_index]);
+    });
 
     m_primitive_deps[primitive_index] = {input_index, delta_index, result_index};
     return primitive_index;
@@ -523,32 +574,34 @@ size_t MKLDNNEmitter::build_convolution_backward_data(const mkldnn::memory::desc
     size_t delta_index = build_memory_primitive(delta_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
-    size_t primitive_index = insert_primitive(new mkldnn::convolution_backward_data(
-        {{mkldnn::algorithm::convolution_direct,
-          result_desc,
-          weights_desc,
-          delta_desc,
-          mkldnn::memory::dims(strides.begin(), strides.end()),
-          mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
-          mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-          mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
-          mkldnn::padding_kind::zero},
-         executor::global_cpu_engine,
-         // Forward primitive descriptor corresponding to this backward data descriptor
-         {{mkldnn::prop_kind::forward,
-           mkldnn::algorithm::convolution_direct,
-           result_desc,
-           weights_desc,
-           delta_desc,
-           mkldnn::memory::dims(strides.begin(), strides.end()),
-           mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
-           mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-           mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
-           mkldnn::padding_kind::zero},
-          executor::global_cpu_engine}},
-        *m_mkldnn_primitives[delta_index],
-        *m_mkldnn_primitives[weights_index],
-        *m_mkldnn_primitives[result_index]));
+    size_t primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::convolution_backward_data(
+            {{mkldnn::algorithm::convolution_direct,
+              result_desc,
+              weights_desc,
+              delta_desc,
+              mkldnn::memory::dims(strides.begin(), strides.end()),
+              mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
+              mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+              mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+              mkldnn::padding_kind::zero},
+             executor::global_cpu_engine,
+             // Forward primitive descriptor corresponding to this backward data descriptor
+             {{mkldnn::prop_kind::forward,
+               mkldnn::algorithm::convolution_direct,
+               result_desc,
+               weights_desc,
+               delta_desc,
+               mkldnn::memory::dims(strides.begin(), strides.end()),
+               mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
+               mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+               mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+               mkldnn::padding_kind::zero},
+              executor::global_cpu_engine}},
+            *p[delta_index],
+            *p[weights_index],
+            *p[result_index]);
+    });
 
     m_primitive_deps[primitive_index] = {weights_index, delta_index, result_index};
     return primitive_index;
@@ -565,19 +618,21 @@ size_t MKLDNNEmitter::build_pooling_forward(mkldnn::algorithm pooling_algorithm,
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
-    size_t primitive_index = insert_primitive(new mkldnn::pooling_forward(
-        {{mkldnn::prop_kind::forward_inference,
-          pooling_algorithm,
-          input_desc,
-          result_desc,
-          mkldnn::memory::dims(window_strides.begin(), window_strides.end()),
-          mkldnn::memory::dims(window_shape.begin(), window_shape.end()),
-          mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-          mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
-          mkldnn::padding_kind::zero},
-         executor::global_cpu_engine},
-        *m_mkldnn_primitives[input_index],
-        *m_mkldnn_primitives[result_index]));
+    size_t primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::pooling_forward(
+            {{mkldnn::prop_kind::forward_inference,
+              pooling_algorithm,
+              input_desc,
+              result_desc,
+              mkldnn::memory::dims(window_strides.begin(), window_strides.end()),
+              mkldnn::memory::dims(window_shape.begin(), window_shape.end()),
+              mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+              mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+              mkldnn::padding_kind::zero},
+             executor::global_cpu_engine},
+            *p[input_index],
+            *p[result_index]);
+    });
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
     return primitive_index;
@@ -594,28 +649,30 @@ size_t MKLDNNEmitter::build_pooling_backward(mkldnn::algorithm pooling_algorithm
     size_t input_index = build_memory_primitive(diff_dst_desc);
     size_t result_index = build_memory_primitive(diff_src_desc);
 
-    size_t primitive_index = insert_primitive(new mkldnn::pooling_backward(
-        {{pooling_algorithm,
-          diff_src_desc,
-          diff_dst_desc,
-          mkldnn::memory::dims(window_strides.begin(), window_strides.end()),
-          mkldnn::memory::dims(window_shape.begin(), window_shape.end()),
-          mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-          mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
-          mkldnn::padding_kind::zero},
-         executor::global_cpu_engine,
-         {{mkldnn::prop_kind::forward_training,
-           pooling_algorithm,
-           diff_src_desc,
-           diff_dst_desc,
-           mkldnn::memory::dims(window_strides.begin(), window_strides.end()),
-           mkldnn::memory::dims(window_shape.begin(), window_shape.end()),
-           mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-           mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
-           mkldnn::padding_kind::zero},
-          executor::global_cpu_engine}},
-        *m_mkldnn_primitives[input_index],
-        *m_mkldnn_primitives[result_index]));
+    size_t primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::pooling_backward(
+            {{pooling_algorithm,
+              diff_src_desc,
+              diff_dst_desc,
+              mkldnn::memory::dims(window_strides.begin(), window_strides.end()),
+              mkldnn::memory::dims(window_shape.begin(), window_shape.end()),
+              mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+              mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+              mkldnn::padding_kind::zero},
+             executor::global_cpu_engine,
+             {{mkldnn::prop_kind::forward_training,
+               pooling_algorithm,
+               diff_src_desc,
+               diff_dst_desc,
+               mkldnn::memory::dims(window_strides.begin(), window_strides.end()),
+               mkldnn::memory::dims(window_shape.begin(), window_shape.end()),
+               mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+               mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+               mkldnn::padding_kind::zero},
+              executor::global_cpu_engine}},
+            *p[input_index],
+            *p[result_index]);
+    });
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
     return primitive_index;
@@ -653,27 +710,30 @@ size_t MKLDNNEmitter::build_max_pooling_backward(mkldnn::algorithm pooling_algor
         new MKLDNNWorkspace(fwd_pd.workspace_primitive_desc().get_size()));
     auto ws_buf_index = insert_workspace(ws);
 
-    size_t fwd_primitive_index = insert_primitive(new mkldnn::pooling_forward(
-        fwd_pd,
-        *m_mkldnn_primitives[fprop_src_index],
-        *m_mkldnn_primitives
-            [diff_src_index], // HACK - Uses diff_src buffer. Safe since diff_src > fprop_dst
-        *m_mkldnn_primitives[ws_index]));
-
-    size_t bwd_primitive_index = insert_primitive(new mkldnn::pooling_backward(
-        {{pooling_algorithm,
-          diff_src_desc,
-          diff_dst_desc,
-          mkldnn::memory::dims(window_strides.begin(), window_strides.end()),
-          mkldnn::memory::dims(window_shape.begin(), window_shape.end()),
-          mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-          mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
-          mkldnn::padding_kind::zero},
-         executor::global_cpu_engine,
-         fwd_pd},
-        *m_mkldnn_primitives[diff_dst_index],
-        *m_mkldnn_primitives[ws_index],
-        *m_mkldnn_primitives[diff_src_index]));
+    size_t fwd_primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::pooling_forward(
+            fwd_pd,
+            *p[fprop_src_index],
+            *p[diff_src_index], // HACK - Uses diff_src buffer. Safe since diff_src > fprop_dst
+            *p[ws_index]);
+    });
+
+    size_t bwd_primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::pooling_backward(
+            {{pooling_algorithm,
+              diff_src_desc,
+              diff_dst_desc,
+              mkldnn::memory::dims(window_strides.begin(), window_strides.end()),
+              mkldnn::memory::dims(window_shape.begin(), window_shape.end()),
+              mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+              mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+              mkldnn::padding_kind::zero},
+             executor::global_cpu_engine,
+             fwd_pd},
+            *p[diff_dst_index],
+            *p[ws_index],
+            *p[diff_src_index]);
+    });
 
     m_primitive_deps[fwd_primitive_index] = {
         fprop_src_index, diff_src_index, ws_index, ws_buf_index};
@@ -707,11 +767,9 @@ size_t MKLDNNEmitter::build_max_pooling_with_indices_forward(mkldnn::algorithm p
 
     auto ws_index = build_memory_primitive(fwd_pd.workspace_primitive_desc().desc());
 
-    size_t fwd_primitive_index =
-        insert_primitive(new mkldnn::pooling_forward(fwd_pd,
-                                                     *m_mkldnn_primitives[src_index],
-                                                     *m_mkldnn_primitives[dst_index],
-                                                     *m_mkldnn_primitives[ws_index]));
+    size_t fwd_primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::pooling_forward(fwd_pd, *p[src_index], *p[dst_index], *p[ws_index]);
+    });
 
     m_primitive_deps[fwd_primitive_index] = {src_index, dst_index, ws_index};
     return fwd_primitive_index;
@@ -743,20 +801,22 @@ size_t MKLDNNEmitter::build_max_pooling_with_indices_backward(
 
     auto fprop_ws_index = build_memory_primitive(fwd_pd.workspace_primitive_desc().desc());
 
-    size_t bwd_primitive_index = insert_primitive(new mkldnn::pooling_backward(
-        {{pooling_algorithm,
-          diff_src_desc,
-          diff_dst_desc,
-          mkldnn::memory::dims(window_strides.begin(), window_strides.end()),
-          mkldnn::memory::dims(window_shape.begin(), window_shape.end()),
-          mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-          mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
-          mkldnn::padding_kind::zero},
-         executor::global_cpu_engine,
-         fwd_pd},
-        *m_mkldnn_primitives[diff_dst_index],
-        *m_mkldnn_primitives[fprop_ws_index],
-        *m_mkldnn_primitives[diff_src_index]));
+    size_t bwd_primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::pooling_backward(
+            {{pooling_algorithm,
+              diff_src_desc,
+              diff_dst_desc,
+              mkldnn::memory::dims(window_strides.begin(), window_strides.end()),
+              mkldnn::memory::dims(window_shape.begin(), window_shape.end()),
+              mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+              mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+              mkldnn::padding_kind::zero},
+             executor::global_cpu_engine,
+             fwd_pd},
+            *p[diff_dst_index],
+            *p[fprop_ws_index],
+            *p[diff_src_index]);
+    });
 
     m_primitive_deps[bwd_primitive_index] = {diff_dst_index, fprop_ws_index, diff_src_index};
     return bwd_primitive_index;
@@ -768,8 +828,9 @@ size_t MKLDNNEmitter::build_reorder(const mkldnn::memory::desc& input_desc,
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
-    size_t primitive_index = insert_primitive(
-        new mkldnn::reorder(*m_mkldnn_primitives[input_index], *m_mkldnn_primitives[result_index]));
+    size_t primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::reorder(*p[input_index], *p[result_index]);
+    });
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
     return primitive_index;
@@ -794,8 +855,9 @@ size_t MKLDNNEmitter::build_lrn_forward(const mkldnn::memory::desc& input_desc,
                                               bias);
     auto lrn_prim_desc = mkldnn::lrn_forward::primitive_desc(lrn_desc, executor::global_cpu_engine);
 
-    size_t primitive_index = insert_primitive(new mkldnn::lrn_forward(
-        lrn_prim_desc, *m_mkldnn_primitives[input_index], *m_mkldnn_primitives[result_index]));
+    size_t primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::lrn_forward(lrn_prim_desc, *p[input_index], *p[result_index]);
+    });
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
     return primitive_index;
@@ -807,11 +869,17 @@ size_t MKLDNNEmitter::build_relu_forward(const mkldnn::memory::desc& input_desc,
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
-    size_t primitive_index = insert_primitive(new mkldnn::relu_forward(
-        {{mkldnn::prop_kind::forward_training, mkldnn::algorithm::eltwise_relu, input_desc, 0, 0},
-         executor::global_cpu_engine},
-        *m_mkldnn_primitives[input_index],
-        *m_mkldnn_primitives[result_index]));
+    size_t primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::relu_forward(
+            {{mkldnn::prop_kind::forward_training,
+              mkldnn::algorithm::eltwise_relu,
+              input_desc,
+              0,
+              0},
+             executor::global_cpu_engine},
+            *p[input_index],
+            *p[result_index]);
+    });
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
     return primitive_index;
@@ -825,14 +893,16 @@ size_t MKLDNNEmitter::build_relu_backward(const mkldnn::memory::desc& input_desc
     size_t delta_index = build_memory_primitive(delta_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
-    size_t primitive_index = insert_primitive(new mkldnn::relu_backward(
-        {{mkldnn::algorithm::eltwise_relu, delta_desc, input_desc, 0, 0},
-         executor::global_cpu_engine,
-         {{mkldnn::prop_kind::forward, mkldnn::algorithm::eltwise_relu, input_desc, 0, 0},
-          executor::global_cpu_engine}},
-        *m_mkldnn_primitives[input_index],
-        *m_mkldnn_primitives[delta_index],
-        *m_mkldnn_primitives[result_index]));
+    size_t primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::relu_backward(
+            {{mkldnn::algorithm::eltwise_relu, delta_desc, input_desc, 0, 0},
+             executor::global_cpu_engine,
+             {{mkldnn::prop_kind::forward, mkldnn::algorithm::eltwise_relu, input_desc, 0, 0},
+              executor::global_cpu_engine}},
+            *p[input_index],
+            *p[delta_index],
+            *p[result_index]);
+    });
 
     m_primitive_deps[primitive_index] = {input_index, delta_index, result_index};
     return primitive_index;
@@ -844,15 +914,16 @@ size_t MKLDNNEmitter::build_sigmoid_forward(const mkldnn::memory::desc& input_de
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
-    size_t primitive_index =
-        insert_primitive(new mkldnn::eltwise_forward({{mkldnn::prop_kind::forward_training,
-                                                       mkldnn::algorithm::eltwise_logistic,
-                                                       input_desc,
-                                                       0,
-                                                       0},
-                                                      executor::global_cpu_engine},
-                                                     *m_mkldnn_primitives[input_index],
-                                                     *m_mkldnn_primitives[result_index]));
+    size_t primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::eltwise_forward({{mkldnn::prop_kind::forward_training,
+                                             mkldnn::algorithm::eltwise_logistic,
+                                             input_desc,
+                                             0,
+                                             0},
+                                            executor::global_cpu_engine},
+                                           *p[input_index],
+                                           *p[result_index]);
+    });
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
     return primitive_index;
@@ -872,13 +943,15 @@ size_t MKLDNNEmitter::build_sigmoid_backward(const mkldnn::memory::desc& input_d
             {mkldnn::prop_kind::forward, mkldnn::algorithm::eltwise_logistic, input_desc, 0, 0},
             executor::global_cpu_engine);
 
-    size_t primitive_index = insert_primitive(new mkldnn::eltwise_backward(
-        {{mkldnn::algorithm::eltwise_logistic, delta_desc, input_desc, 0, 0},
-         executor::global_cpu_engine,
-         sigmoid_fwd_pd},
-        *m_mkldnn_primitives[input_index],
-        *m_mkldnn_primitives[delta_index],
-        *m_mkldnn_primitives[result_index]));
+    size_t primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::eltwise_backward(
+            {{mkldnn::algorithm::eltwise_logistic, delta_desc, input_desc, 0, 0},
+             executor::global_cpu_engine,
+             sigmoid_fwd_pd},
+            *p[input_index],
+            *p[delta_index],
+            *p[result_index]);
+    });
 
     m_primitive_deps[primitive_index] = {input_index, delta_index, result_index};
     return primitive_index;
@@ -892,21 +965,20 @@ size_t MKLDNNEmitter::build_elementwise_add(
     const std::vector<mkldnn::memory::primitive_desc>& inputs_pd)
 
 {
-    std::vector<mkldnn::memory::primitive::at> inputs_primitive;
-
     size_t input0_data_index = build_memory_primitive(input0_data_desc);
     size_t input1_data_index = build_memory_primitive(input1_data_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
-    inputs_primitive.push_back(*m_mkldnn_primitives[input0_data_index]);
-    inputs_primitive.push_back(*m_mkldnn_primitives[input1_data_index]);
-
     // elementwise sum primtive descriptor
     mkldnn::sum::primitive_desc sum_pd =
         mkldnn::sum::primitive_desc(result_desc, scale_vector, inputs_pd);
     // sum primitive
-    size_t add_index = insert_primitive(
-        new mkldnn::sum(sum_pd, inputs_primitive, *m_mkldnn_primitives[result_index]));
+    size_t add_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        std::vector<mkldnn::memory::primitive::at> inputs_primitive;
+        inputs_primitive.push_back(*p[input0_data_index]);
+        inputs_primitive.push_back(*p[input1_data_index]);
+        return new mkldnn::sum(sum_pd, inputs_primitive, *p[result_index]);
+    });
 
     m_primitive_deps[add_index] = {input0_data_index, input1_data_index, result_index};
     return add_index;
@@ -933,18 +1005,20 @@ size_t MKLDNNEmitter::build_batchnorm_forward(const mkldnn::memory::desc& input_
 
     if (bn_training_flag && !use_global_stats)
     {
-        size_t batchnorm_index = insert_primitive(new mkldnn::batch_normalization_forward(
-            {{mkldnn::prop_kind::forward_training,
-              input_desc,
-              eps,
-              mkldnn::batch_normalization_flag::use_scale_shift},
-             bn_attr,
-             executor::global_cpu_engine},
-            mkldnn::primitive::at(*m_mkldnn_primitives[input_index]),
-            mkldnn::primitive::at(*m_mkldnn_primitives[weights_index]),
-            static_cast<mkldnn::memory>(*m_mkldnn_primitives[result_index]),
-            *m_mkldnn_primitives[mean_index],
-            *m_mkldnn_primitives[variance_index]));
+        size_t batchnorm_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+            return new mkldnn::batch_normalization_forward(
+                {{mkldnn::prop_kind::forward_training,
+                  input_desc,
+                  eps,
+                  mkldnn::batch_normalization_flag::use_scale_shift},
+                 bn_attr,
+                 executor::global_cpu_engine},
+                mkldnn::primitive::at(*p[input_index]),
+                mkldnn::primitive::at(*p[weights_index]),
+                static_cast<mkldnn::memory>(*p[result_index]),
+                *p[mean_index],
+                *p[variance_index]);
+        });
 
         m_primitive_deps[batchnorm_index] = {
             input_index, weights_index, result_index, mean_index, variance_index};
@@ -952,19 +1026,21 @@ size_t MKLDNNEmitter::build_batchnorm_forward(const mkldnn::memory::desc& input_
     }
     else
     {
-        size_t batchnorm_index = insert_primitive(new mkldnn::batch_normalization_forward(
-            {{mkldnn::prop_kind::forward_training,
-              input_desc,
-              eps,
-              mkldnn::batch_normalization_flag::use_scale_shift |
-                  mkldnn::batch_normalization_flag::use_global_stats},
-             bn_attr,
-             executor::global_cpu_engine},
-            mkldnn::primitive::at(*m_mkldnn_primitives[input_index]),
-            mkldnn::primitive::at(*m_mkldnn_primitives[mean_index]),
-            mkldnn::primitive::at(*m_mkldnn_primitives[variance_index]),
-            mkldnn::primitive::at(*m_mkldnn_primitives[weights_index]),
-            static_cast<mkldnn::memory>(*m_mkldnn_primitives[result_index])));
+        size_t batchnorm_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+            return new mkldnn::batch_normalization_forward(
+                {{mkldnn::prop_kind::forward_training,
+                  input_desc,
+                  eps,
+                  mkldnn::batch_normalization_flag::use_scale_shift |
+                      mkldnn::batch_normalization_flag::use_global_stats},
+                 bn_attr,
+                 executor::global_cpu_engine},
+                mkldnn::primitive::at(*p[input_index]),
+                mkldnn::primitive::at(*p[mean_index]),
+                mkldnn::primitive::at(*p[variance_index]),
+                mkldnn::primitive::at(*p[weights_index]),
+                static_cast<mkldnn::memory>(*p[result_index]));
+        });
 
         m_primitive_deps[batchnorm_index] = {
             input_index, mean_index, variance_index, weights_index, result_index};
@@ -989,25 +1065,27 @@ size_t MKLDNNEmitter::build_batchnorm_backward(const mkldnn::memory::desc& weigh
     size_t dinput_index = build_memory_primitive(dinput_desc);
     size_t dweights_index = build_memory_primitive(dweights_desc);
 
-    size_t batchnorm_index = insert_primitive(new mkldnn::batch_normalization_backward(
-        {{mkldnn::prop_kind::backward,
-          delta_desc,
-          input_desc,
-          eps,
-          mkldnn::batch_normalization_flag::use_scale_shift},
-         executor::global_cpu_engine,
-         {{mkldnn::prop_kind::forward_training,
-           input_desc,
-           eps,
-           mkldnn::batch_normalization_flag::use_scale_shift},
-          executor::global_cpu_engine}},
-        *m_mkldnn_primitives[input_index],
-        *m_mkldnn_primitives[mean_index],
-        *m_mkldnn_primitives[variance_index],
-        *m_mkldnn_primitives[delta_index],
-        *m_mkldnn_primitives[weights_index],
-        *m_mkldnn_primitives[dinput_index],
-        *m_mkldnn_primitives[dweights_index]));
+    size_t batchnorm_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::batch_normalization_backward(
+            {{mkldnn::prop_kind::backward,
+              delta_desc,
+              input_desc,
+              eps,
+              mkldnn::batch_normalization_flag::use_scale_shift},
+             executor::global_cpu_engine,
+             {{mkldnn::prop_kind::forward_training,
+               input_desc,
+               eps,
+               mkldnn::batch_normalization_flag::use_scale_shift},
+              executor::global_cpu_engine}},
+            *p[input_index],
+            *p[mean_index],
+            *p[variance_index],
+            *p[delta_index],
+            *p[weights_index],
+            *p[dinput_index],
+            *p[dweights_index]);
+    });
 
     m_primitive_deps[batchnorm_index] = {weights_index,
                                          input_index,
@@ -1053,16 +1131,18 @@ size_t MKLDNNEmitter::build_rnn_forward(const mkldnn::memory::desc& src_layer_de
     auto workspace = std::unique_ptr<MKLDNNWorkspace>(
         new MKLDNNWorkspace(rnn_layer_prim_desc.workspace_primitive_desc().get_size()));
     auto workspace_buf_index = insert_workspace(workspace);
-    size_t rnn_index = insert_primitive(new mkldnn::rnn_forward(
-        rnn_layer_prim_desc,
-        mkldnn::primitive::at(*m_mkldnn_primitives[src_layer_index]),
-        mkldnn::primitive::at(*m_mkldnn_primitives[src_iter_index]),
-        mkldnn::primitive::at(*m_mkldnn_primitives[weights_layer_index]),
-        mkldnn::primitive::at(*m_mkldnn_primitives[weights_iter_index]),
-        mkldnn::primitive::at(*m_mkldnn_primitives[bias_index]),
-        static_cast<mkldnn::memory>(*m_mkldnn_primitives[dst_layer_index]),
-        static_cast<mkldnn::memory>(*m_mkldnn_primitives[dst_iter_index]),
-        static_cast<mkldnn::memory>(*m_mkldnn_primitives[workspace_index])));
+    size_t rnn_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::rnn_forward(
+            rnn_layer_prim_desc,
+            mkldnn::primitive::at(*p[src_layer_index]),
+            mkldnn::primitive::at(*p[src_iter_index]),
+            mkldnn::primitive::at(*p[weights_layer_index]),
+            mkldnn::primitive::at(*p[weights_iter_index]),
+            mkldnn::primitive::at(*p[bias_index]),
+            static_cast<mkldnn::memory>(*p[dst_layer_index]),
+            static_cast<mkldnn::memory>(*p[dst_iter_index]),
+            static_cast<mkldnn::memory>(*p[workspace_index]));
+    });
     m_primitive_deps[rnn_index] = {src_layer_index,
                                    src_iter_index,
                                    weights_layer_index,
@@ -1080,7 +1160,6 @@ size_t MKLDNNEmitter::build_concat(const std::vector<mkldnn::memory::desc>& inpu
                                    const mkldnn::memory::desc& result_desc,
                                    const size_t concat_dim)
 {
-    std::vector<mkldnn::memory::primitive::at> inputs_primitive;
     std::vector<size_t> inputs_data_index;
     std::vector<size_t> in_out_index;
     std::vector<mkldnn::memory::primitive_desc> inputs_pd;
@@ -1094,7 +1173,6 @@ size_t MKLDNNEmitter::build_concat(const std::vector<mkldnn::memory::desc>& inpu
     for (size_t i = 0; i < inputs_data_desc.size(); i++)
     {
         inputs_data_index.push_back(build_memory_primitive(inputs_data_desc[i]));
-        inputs_primitive.push_back(*m_mkldnn_primitives[inputs_data_index[i]]);
     }
     size_t result_index = build_memory_primitive(result_desc);
 
@@ -1102,8 +1180,14 @@ size_t MKLDNNEmitter::build_concat(const std::vector<mkldnn::memory::desc>& inpu
     mkldnn::concat::primitive_desc concat_pd =
         mkldnn::concat::primitive_desc(result_desc, static_cast<int>(concat_dim), inputs_pd);
     // concat primitive
-    size_t concat_index = insert_primitive(
-        new mkldnn::concat(concat_pd, inputs_primitive, *m_mkldnn_primitives[result_index]));
+    size_t concat_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        std::vector<mkldnn::memory::primitive::at> inputs_primitive;
+        for (size_t input_index : inputs_data_index)
+        {
+            inputs_primitive.push_back(*p[input_index]);
+        }
+        return new mkldnn::concat(concat_pd, inputs_primitive, *p[result_index]);
+    });
 
     for (size_t i = 0; i < inputs_data_index.size(); i++)
     {
@@ -1136,8 +1220,9 @@ size_t MKLDNNEmitter::build_slice(const mkldnn::memory::desc& input_desc,
     mkldnn::reorder::primitive_desc reorder_pd =
         mkldnn::reorder::primitive_desc(view_pd, result_pd);
     // reorder primitive
-    size_t reorder_index = insert_primitive(new mkldnn::reorder(
-        reorder_pd, *m_mkldnn_primitives[input_index], *m_mkldnn_primitives[result_index]));
+    size_t reorder_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::reorder(reorder_pd, *p[input_index], *p[result_index]);
+    });
 
     in_out_index.push_back(input_index);
     in_out_index.push_back(result_index);
@@ -1152,11 +1237,13 @@ size_t MKLDNNEmitter::build_softmax_forward(const mkldnn::memory::desc& input_de
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
-    size_t primitive_index = insert_primitive(
-        new mkldnn::softmax_forward({{mkldnn::prop_kind::forward_scoring, input_desc, softmax_axis},
-                                     executor::global_cpu_engine},
-                                    *m_mkldnn_primitives[input_index],
-                                    *m_mkldnn_primitives[result_index]));
+    size_t primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::softmax_forward(
+            {{mkldnn::prop_kind::forward_scoring, input_desc, softmax_axis},
+             executor::global_cpu_engine},
+            *p[input_index],
+            *p[result_index]);
+    });
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
     return primitive_index;
@@ -1169,15 +1256,16 @@ size_t MKLDNNEmitter::build_bounded_relu(const mkldnn::memory::desc& input_desc,
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
-    size_t primitive_index =
-        insert_primitive(new mkldnn::eltwise_forward({{mkldnn::prop_kind::forward_training,
-                                                       mkldnn::algorithm::eltwise_bounded_relu,
-                                                       input_desc,
-                                                       alpha,
-                                                       0.0f},
-                                                      executor::global_cpu_engine},
-                                                     *m_mkldnn_primitives[input_index],
-                                                     *m_mkldnn_primitives[result_index]));
+    size_t primitive_index = insert_primitive([=](const std::vector<mkldnn::primitive*>& p) {
+        return new mkldnn::eltwise_forward({{mkldnn::prop_kind::forward_training,
+                                             mkldnn::algorithm::eltwise_bounded_relu,
+                                             input_desc,
+                                             alpha,
+                                             0.0f},
+                                            executor::global_cpu_engine},
+                                           *p[input_index],
+                                           *p[result_index]);
+    });
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
     return primitive_index;
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -52,9 +53,14 @@ namespace ngraph
             class MKLDNNWorkspace
             {
             public:
-                MKLDNNWorkspace(size_t size) { buf = reinterpret_cast<char*>(malloc(size)); }
+                MKLDNNWorkspace(size_t size)
+                    : size(size)
+                {
+                    buf = reinterpret_cast<char*>(malloc(size));
+                }
                 ~MKLDNNWorkspace() { free(buf); }
                 char* buf;
+                size_t size;
 
                 MKLDNNWorkspace(const MKLDNNWorkspace&) = delete;
                 MKLDNNWorkspace(MKLDNNWorkspace&&) = delete;
@@ -69,11 +75,27 @@ namespace ngraph
 
                 const std::vector<mkldnn::primitive*>& get_mkldnn_primitives() const;
                 const std::vector<char*>& get_mkldnn_workspaces();
+                // Total bytes of the workspaces
+                size_t get_mkldnn_workspace_size() const;
 
-                size_t insert_primitive(mkldnn::primitive* primitive);
+                // Creates a primitive from the primitives inserted before it
+                using PrimitiveFactory =
+                    std::function<mkldnn::primitive*(const std::vector<mkldnn::primitive*>&)>;
+
+                size_t insert_primitive(const PrimitiveFactory& factory);
                 size_t insert_workspace(std::unique_ptr<MKLDNNWorkspace>& workspace);
                 const std::vector<size_t>& get_primitive_deps(size_t index) const;
 
+                /// \brief Creates another set of the primitives, for a call frame that runs
+                ///     concurrently with the one using get_mkldnn_primitives().
+                ///
+                /// Kernels set the data handles of memory primitives before submitting them,
+                /// so a set of primitives is only ever used by one call frame at a time. The
+                /// caller owns the returned primitives.
+                std::vector<mkldnn::primitive*> build_primitive_replicas() const;
+                // Workspaces of the same sizes, to go with build_primitive_replicas()
+                std::vector<std::unique_ptr<MKLDNNWorkspace>> build_workspace_replicas() const;
+
                 // TODO(jmenon): Get rid of TensorViewWrappers at some point
                 mkldnn::memory::desc build_memory_descriptor(const TensorViewWrapper& tvw,
                                                              mkldnn::memory::format fmt) const;
@@ -628,6 +650,7 @@ namespace ngraph
 
             private:
                 std::vector<mkldnn::primitive*> m_mkldnn_primitives;
+                std::vector<PrimitiveFactory> m_primitive_factories;
                 std::vector<mkldnn::stream> m_mkldnn_streams;
                 std::unordered_map<size_t, std::vector<size_t>> m_primitive_deps;
                 std::vector<std::unique_ptr<MKLDNNWorkspace>> m_workspaces;
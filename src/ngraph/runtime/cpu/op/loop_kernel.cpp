@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -25,17 +27,16 @@ using namespace ngraph;
 shared_ptr<Node>
     ngraph::runtime::cpu::op::LoopKernel::copy_with_new_args(const NodeVector& new_args) const
 {
-    auto args = get_arguments();
-    if (new_args.size() != args.size())
+    if (new_args.size() != m_input_nodes.size())
     {
         throw ngraph_error("number of arguments don't match");
     }
 
     // map inputs
     NodeMap nm;
-    for (size_t i = 0; i < args.size(); i++)
+    for (size_t i = 0; i < m_input_nodes.size(); i++)
     {
-        nm.add(args.at(i), new_args.at(i));
+        nm.add(m_input_nodes.at(i), new_args.at(i));
     }
 
     NodeVector new_node_list;
@@ -66,6 +67,7 @@ ngraph::runtime::cpu::op::LoopKernel::LoopKernel(const NodeVector& node_list,
     : Op("LoopKernel", check_single_output_args({args}))
     , m_node_list(node_list)
     , m_output_nodes(outputs)
+    , m_input_nodes(args)
 {
     constructor_validate_and_infer_types();
     set_output_size(m_output_nodes.size());
@@ -90,3 +92,41 @@ ngraph::runtime::cpu::op::LoopKernel::LoopKernel(const NodeVector& node_list,
         set_output_type(i, o->get_element_type(), o->get_shape());
     }
 }
+
+bool ngraph::runtime::cpu::op::LoopKernel::is_contiguous_broadcast(
+    const ngraph::op::Broadcast& broadcast, size_t& inner, size_t& size)
+{
+    const Shape& shape = broadcast.get_shape();
+    const AxisSet& axes = broadcast.get_broadcast_axes();
+    size_t first = shape.size();
+    size_t last = 0;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        if (axes.count(i) == 0)
+        {
+            first = std::min(first, i);
+            last = i;
+        }
+    }
+
+    inner = 1;
+    size = 1;
+    if (first == shape.size())
+    {
+        // Scalar broadcast
+        return true;
+    }
+    for (size_t i = first; i <= last; i++)
+    {
+        if (axes.count(i) != 0)
+        {
+            return false;
+        }
+        size *= shape[i];
+    }
+    for (size_t i = last + 1; i < shape.size(); i++)
+    {
+        inner *= shape[i];
+    }
+    return true;
+}
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/op.hpp"
 #include "ngraph/util.hpp"
 
@@ -40,9 +41,21 @@ namespace ngraph
 
                     const NodeVector& get_node_list() const { return m_node_list; }
                     const NodeVector& get_kernel_outputs() const { return m_output_nodes; }
+                    /// \return The nodes read by node_list, in argument order. Unlike
+                    ///     get_arguments(), these are not rewritten when the graph around the
+                    ///     kernel changes.
+                    const NodeVector& get_kernel_inputs() const { return m_input_nodes; }
+                    /// \brief Checks that a broadcast keeps a contiguous block of the axes of its
+                    ///     output, so that element i of the output is element
+                    ///     (i / inner) % size of the input. Such broadcasts can be fused.
+                    static bool is_contiguous_broadcast(const ngraph::op::Broadcast& broadcast,
+                                                        size_t& inner,
+                                                        size_t& size);
+
                 private:
                     NodeVector m_node_list;
                     NodeVector m_output_nodes;
+                    NodeVector m_input_nodes;
                 };
             }
         }
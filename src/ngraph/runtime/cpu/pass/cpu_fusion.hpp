@@ -47,7 +47,7 @@ public:
     };
 
     CPUFusion(int fusions = ALL)
-        : GraphRewrite()
+        : GraphRewrite(true)
     {
         if (fusions & DIFFERENTIABLE_FUSIONS)
         {
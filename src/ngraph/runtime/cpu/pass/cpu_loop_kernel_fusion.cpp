@@ -23,12 +23,19 @@
 #include "ngraph/log.hpp"
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
 #include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
 #include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
@@ -40,13 +47,17 @@ using namespace ngraph;
 
 struct LKGraph
 {
-    LKGraph(const NodeVector& ns, const NodeVector& ins)
+    LKGraph(const NodeVector& ns, const NodeVector& ins, size_t first)
         : m_inputs(ins)
         , m_nodes(ns)
+        , m_first(first)
     {
     }
     NodeVector m_inputs;
     NodeVector m_nodes;
+    // Position of the earliest member in the function's topological order. Every input comes
+    // before it, so no input can depend on a member and fusing the group cannot form a cycle.
+    size_t m_first;
 };
 
 class LoopKernelCollector
@@ -56,38 +67,61 @@ public:
     {
         for (auto n : f->get_ordered_ops())
         {
-            if (is_fusible(n))
+            size_t position = m_positions.size();
+            m_positions[n] = position;
+            if (!is_fusible(n))
             {
-                auto arg_from_fusible_group = collect_fusible_args(n);
-                // create a new group
-                if (!arg_from_fusible_group)
-                {
-                    m_heads.insert(std::make_pair(n, n));
-                    m_graphs.insert(std::make_pair(n, LKGraph{{n}, n->get_arguments()}));
-                    NGRAPH_DEBUG << "Created a new group for " << n->get_name();
-                    log_group(n);
-                }
-                else
+                continue;
+            }
+
+            // Groups holding arguments of n with the same shape and type as n. Broadcasts
+            // read a smaller input, so they always start a group of their own that a later
+            // consumer merges into its group.
+            std::vector<std::shared_ptr<Node>> candidates;
+            for (auto arg : n->get_arguments())
+            {
+                if (m_heads.count(arg) != 0 && arg->get_shape() == n->get_shape() &&
+                    arg->get_element_type() == n->get_element_type())
                 {
-                    auto smallest_head = m_heads.at(arg_from_fusible_group);
-                    auto& lkgraph = m_graphs.at(smallest_head);
-                    lkgraph.m_nodes.push_back(n);
-                    for (auto arg : n->get_arguments())
+                    auto head = m_heads.at(arg);
+                    if (std::find(candidates.begin(), candidates.end(), head) == candidates.end())
                     {
-                        if (is_leaf(arg))
-                        {
-                            lkgraph.m_inputs.push_back(arg);
-                        }
+                        candidates.push_back(head);
                     }
-                    m_heads.insert(std::make_pair(n, smallest_head));
-                    log_group(smallest_head);
                 }
             }
+
+            // Prefer merging every candidate group, then joining one of them
+            std::vector<std::vector<std::shared_ptr<Node>>> choices{candidates};
+            if (candidates.size() > 1)
+            {
+                for (auto head : candidates)
+                {
+                    choices.push_back({head});
+                }
+            }
+
+            bool fused = false;
+            for (auto& heads : choices)
+            {
+                if (!heads.empty() && try_fuse(n, heads))
+                {
+                    fused = true;
+                    break;
+                }
+            }
+
+            if (!fused)
+            {
+                m_heads[n] = n;
+                m_graphs.insert(std::make_pair(n, LKGraph{{n}, n->get_arguments(), position}));
+                NGRAPH_DEBUG << "Created a new group for " << n->get_name();
+                log_group(n);
+            }
         }
 
         prune_graphs(min_nodes_to_fuse);
     }
-
     const std::vector<std::shared_ptr<runtime::cpu::op::LoopKernel>> get_loop_kernels() const
     {
         std::vector<std::shared_ptr<runtime::cpu::op::LoopKernel>> lks;
@@ -107,20 +141,103 @@ private:
     {
         static const std::set<std::type_index> fusible_ops_set{TI(ngraph::op::Abs),
                                                                TI(ngraph::op::Add),
+                                                               TI(ngraph::op::Divide),
+                                                               TI(ngraph::op::Exp),
+                                                               TI(ngraph::op::Maximum),
+                                                               TI(ngraph::op::Minimum),
+                                                               TI(ngraph::op::Multiply),
                                                                TI(ngraph::op::Negative),
-                                                               TI(ngraph::op::Subtract),
                                                                TI(ngraph::op::Relu),
-                                                               TI(ngraph::op::Minimum),
-                                                               TI(ngraph::op::Maximum)};
+                                                               TI(ngraph::op::Sigmoid),
+                                                               TI(ngraph::op::Sqrt),
+                                                               TI(ngraph::op::Subtract),
+                                                               TI(ngraph::op::Tanh)};
 
         const Node& node = *n;
+        if (n->get_output_size() != 1 ||
+            (n->get_element_type() != element::f32 && n->get_element_type() != element::f64))
+        {
+            return false;
+        }
+        if (TI(node) == TI(ngraph::op::Broadcast))
+        {
+            auto broadcast = std::static_pointer_cast<ngraph::op::Broadcast>(n);
+            size_t inner;
+            size_t size;
+            return !broadcast->get_broadcast_axes().empty() &&
+                   runtime::cpu::op::LoopKernel::is_contiguous_broadcast(*broadcast, inner, size);
+        }
         return fusible_ops_set.count(TI(node)) != 0;
+    }
+
+    // Fuses n with the groups led by heads, if the result stays acyclic and every broadcast in
+    // it still reads an input of the group
+    bool try_fuse(std::shared_ptr<Node> n, const std::vector<std::shared_ptr<Node>>& heads)
+    {
+        auto is_member = [&](const std::shared_ptr<Node>& node) {
+            auto it = m_heads.find(node);
+            return it != m_heads.end() &&
+                   std::find(heads.begin(), heads.end(), it->second) != heads.end();
+        };
 
-        // return (std::dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(n) ||
-        //         std::dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(n));
+        auto new_head = heads.front();
+        NodeVector nodes;
+        NodeVector inputs;
+        auto add_inputs = [&](const NodeVector& args) {
+            for (auto arg : args)
+            {
+                if (!is_member(arg) && std::find(inputs.begin(), inputs.end(), arg) == inputs.end())
+                {
+                    inputs.push_back(arg);
+                }
+            }
+        };
+        for (auto head : heads)
+        {
+            auto& lkgraph = m_graphs.at(head);
+            if (lkgraph.m_first < m_graphs.at(new_head).m_first)
+            {
+                new_head = head;
+            }
+            nodes.insert(nodes.end(), lkgraph.m_nodes.begin(), lkgraph.m_nodes.end());
+            add_inputs(lkgraph.m_inputs);
+        }
+        add_inputs(n->get_arguments());
+
+        size_t first = m_graphs.at(new_head).m_first;
+        for (auto input : inputs)
+        {
+            if (m_positions.at(input) > first)
+            {
+                return false;
+            }
+        }
+        for (auto node : nodes)
+        {
+            if (TI(*node) == TI(ngraph::op::Broadcast) && is_member(node->get_argument(0)))
+            {
+                return false;
+            }
+        }
+
+        std::sort(nodes.begin(), nodes.end(), [this](const std::shared_ptr<Node>& a,
+                                                     const std::shared_ptr<Node>& b) {
+            return m_positions.at(a) < m_positions.at(b);
+        });
+        nodes.push_back(n);
+        for (auto head : heads)
+        {
+            m_graphs.erase(head);
+        }
+        for (auto node : nodes)
+        {
+            m_heads[node] = new_head;
+        }
+        m_graphs.insert(std::make_pair(new_head, LKGraph{nodes, inputs, first}));
+        log_group(new_head);
+        return true;
     }
 
-    bool is_leaf(std::shared_ptr<Node> src) { return src->is_parameter() || src->is_constant(); }
     void prune_graphs(size_t min_nodes_to_fuse)
     {
         for (auto it = m_graphs.begin(); it != m_graphs.end();)
@@ -143,33 +260,9 @@ private:
         NGRAPH_DEBUG << "Inputs: " << m_graphs.at(head).m_inputs << std::endl;
     }
 
-    std::shared_ptr<Node> collect_fusible_args(std::shared_ptr<Node> n)
-    {
-        std::shared_ptr<Node> arg_from_fusible_group;
-        for (auto arg : n->get_arguments())
-        {
-            // an argument is fusible and a part of some group
-            NGRAPH_DEBUG << "Considering " << arg->get_name();
-            if (m_heads.count(arg) != 0)
-            {
-                if (!arg_from_fusible_group)
-                {
-                    arg_from_fusible_group = arg;
-                }
-                else
-                {
-                    if (!is_leaf(arg) && m_heads.at(arg) != m_heads.at(arg_from_fusible_group))
-                    {
-                        return {nullptr};
-                    }
-                }
-            }
-        }
-        return arg_from_fusible_group;
-    }
-
     std::unordered_map<std::shared_ptr<Node>, LKGraph> m_graphs;
     std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<Node>> m_heads;
+    std::unordered_map<std::shared_ptr<Node>, size_t> m_positions;
 };
 
 bool ngraph::runtime::cpu::pass::CPULoopKernelFusion::run_on_function(
@@ -28,6 +28,7 @@ runtime::HostTensor::HostTensor(const ngraph::element::Type& element_type,
                                 void* memory_pointer,
                                 const string& name)
     : runtime::Tensor(std::make_shared<ngraph::descriptor::Tensor>(element_type, shape, name))
+    , m_allocator(Allocator::get_default())
     , m_allocated_buffer_pool(nullptr)
     , m_aligned_buffer_pool(nullptr)
 
@@ -43,14 +44,9 @@ runtime::HostTensor::HostTensor(const ngraph::element::Type& element_type,
     }
     else if (m_buffer_size > 0)
     {
-        size_t allocation_size = m_buffer_size + runtime::alignment;
-        m_allocated_buffer_pool = static_cast<char*>(malloc(allocation_size));
+        m_allocated_buffer_pool =
+            static_cast<char*>(m_allocator->allocate(m_buffer_size, runtime::alignment));
         m_aligned_buffer_pool = m_allocated_buffer_pool;
-        size_t mod = size_t(m_aligned_buffer_pool) % alignment;
-        if (mod != 0)
-        {
-            m_aligned_buffer_pool += (alignment - mod);
-        }
     }
 }
 
@@ -65,7 +61,7 @@ runtime::HostTensor::~HostTensor()
 {
     if (m_allocated_buffer_pool != nullptr)
     {
-        free(m_allocated_buffer_pool);
+        m_allocator->deallocate(m_allocated_buffer_pool, m_buffer_size, runtime::alignment);
     }
 }
 
@@ -18,6 +18,7 @@
 
 #include <memory>
 
+#include "ngraph/runtime/allocator.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -75,6 +76,7 @@ private:
     HostTensor(HostTensor&&) = delete;
     HostTensor& operator=(const HostTensor&) = delete;
 
+    std::shared_ptr<Allocator> m_allocator;
     char* m_allocated_buffer_pool;
     char* m_aligned_buffer_pool;
     size_t m_buffer_size;
@@ -14,17 +14,22 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+
 #include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/util/binary_elementwise_comparison.hpp"
 #include "ngraph/pass/assign_layout.hpp"
+#include "ngraph/pass/buffer_aliasing.hpp"
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -58,24 +63,58 @@ shared_ptr<runtime::Tensor> runtime::interpreter::INTBackend::create_tensor(
 
 bool runtime::interpreter::INTBackend::compile(shared_ptr<Function> function)
 {
+    unique_lock<mutex> lock(m_mutex);
     FunctionInstance& instance = m_function_map[function];
     if (!instance.m_is_compiled)
+    {
+        // Only calls running the functions this compile rewrites need to finish first
+        vector<FunctionInstance*> rewritten;
+        traverse_functions(function, [this, &rewritten](shared_ptr<Function> f) {
+            rewritten.push_back(&m_function_map[f]);
+        });
+        m_idle.wait(lock, [&instance, &rewritten]() {
+            return instance.m_is_compiled ||
+                   all_of(rewritten.begin(), rewritten.end(), [](FunctionInstance* i) {
+                       return i->m_active_calls == 0;
+                   });
+        });
+    }
+    if (!instance.m_is_compiled)
     {
         instance.m_is_compiled = true;
         pass::Manager pass_manager;
         pass_manager.register_pass<pass::LikeReplacement>();
         pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
+        pass_manager.register_pass<pass::BufferAliasing>();
+        pass_manager.register_pass<pass::MemorySchedule>(m_alignment);
         pass_manager.register_pass<pass::Liveness>();
-        pass_manager.register_pass<pass::MemoryLayout>(m_alignment);
+        pass_manager.register_pass<pass::MemoryLayout>(m_alignment, false, false, true);
         pass_manager.run_passes(function);
 
         size_t memory_pool_size = function->get_temporary_pool_size();
         instance.m_temporary_memory.reset(new AlignedBuffer(memory_pool_size, m_alignment));
 
-        for (const shared_ptr<Node>& node : function->get_ordered_ops())
-        {
-            instance.m_wrapped_nodes.emplace_back(node);
-        }
+        // The passes also ran on the functions called by ops, which run in their caller's
+        // pool; their own pools are only allocated if they are called directly
+        traverse_functions(function, [this, function](shared_ptr<Function> f) {
+            FunctionInstance& called_instance = m_function_map[f];
+            if (f != function)
+            {
+                called_instance.m_temporary_memory.reset();
+            }
+            called_instance.m_is_compiled = true;
+            called_instance.m_called_functions.clear();
+            traverse_functions(f, [&called_instance](shared_ptr<Function> called) {
+                called_instance.m_called_functions.push_back(called);
+            });
+            called_instance.m_memory_usage = MemoryUsage();
+            called_instance.m_memory_usage.add_function(f);
+            called_instance.m_wrapped_nodes.clear();
+            for (const shared_ptr<Node>& node : f->get_ordered_ops())
+            {
+                called_instance.m_wrapped_nodes.emplace_back(node);
+            }
+        });
     }
 
     return true;
@@ -88,7 +127,61 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
     validate_call(function, outputs, inputs);
 
     compile(function);
-    FunctionInstance& instance = m_function_map[function];
+    vector<FunctionInstance*> running;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        for (const shared_ptr<Function>& f : m_function_map.at(function).m_called_functions)
+        {
+            running.push_back(&m_function_map.at(f));
+            running.back()->m_active_calls++;
+        }
+    }
+    FunctionInstance& instance = get_instance(function);
+    unique_lock<mutex> instance_lock(instance.m_mutex);
+    auto end_call = [this, &instance_lock, &running]() {
+        instance_lock.unlock();
+        lock_guard<mutex> lock(m_mutex);
+        bool idle = false;
+        for (FunctionInstance* f : running)
+        {
+            idle |= --f->m_active_calls == 0;
+        }
+        if (idle)
+        {
+            m_idle.notify_all();
+        }
+    };
+    try
+    {
+        call(function, instance, outputs, inputs);
+    }
+    catch (...)
+    {
+        end_call();
+        throw;
+    }
+    end_call();
+    return true;
+}
+
+runtime::interpreter::INTBackend::FunctionInstance&
+    runtime::interpreter::INTBackend::get_instance(shared_ptr<Function> function)
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_function_map.at(function);
+}
+
+void runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
+                                            FunctionInstance& instance,
+                                            const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                            const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    if (!instance.m_temporary_memory)
+    {
+        instance.m_temporary_memory.reset(
+            new AlignedBuffer(function->get_temporary_pool_size(), m_alignment));
+    }
+    size_t peak_rss = instance.m_is_called ? 0 : get_peak_rss();
 
     // convert inputs to HostTensor
     vector<void*> func_inputs;
@@ -112,6 +205,46 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         func_outputs.push_back(static_cast<void*>(host_tensor->get_data_ptr()));
     }
 
+    execute(function,
+            instance,
+            func_outputs,
+            func_inputs,
+            static_cast<char*>(instance.m_temporary_memory->get_ptr()));
+
+    if (!instance.m_is_called)
+    {
+        // m_memory_usage is read under m_mutex only
+        size_t peak_rss_delta = get_peak_rss() - peak_rss;
+        lock_guard<mutex> lock(m_mutex);
+        instance.m_memory_usage.peak_rss_delta = peak_rss_delta;
+        instance.m_is_called = true;
+    }
+}
+
+void runtime::interpreter::INTBackend::call_nested(const Node& node,
+                                                   size_t index,
+                                                   const vector<void*>& outputs,
+                                                   const vector<void*>& inputs,
+                                                   FunctionInstance& caller)
+{
+    shared_ptr<Function> function = node.get_functions().at(index);
+    FunctionInstance& instance = get_instance(function);
+    lock_guard<mutex> instance_lock(instance.m_mutex);
+    execute(function,
+            instance,
+            outputs,
+            inputs,
+            static_cast<char*>(caller.get_temporary_pointer(node.get_nested_pool_offset())));
+}
+
+void runtime::interpreter::INTBackend::execute(shared_ptr<Function> function,
+                                               FunctionInstance& instance,
+                                               const vector<void*>& func_outputs,
+                                               const vector<void*>& func_inputs,
+                                               char* temporary_pool)
+{
+    instance.m_temporary_pool = temporary_pool;
+
     // map function params -> HostTensor
     unordered_map<descriptor::Tensor*, void*> tensor_map;
     size_t input_count = 0;
@@ -223,8 +356,6 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
             perform_nan_check(htv_outputs, op);
         }
     }
-
-    return true;
 }
 
 void runtime::interpreter::INTBackend::generate_calls(const element::Type& type,
@@ -287,6 +418,7 @@ void runtime::interpreter::INTBackend::generate_calls(const element::Type& type,
 
 void runtime::interpreter::INTBackend::set_nan_check(shared_ptr<Function> func, bool enable)
 {
+    lock_guard<mutex> lock(m_mutex);
     FunctionInstance& instance = m_function_map[func];
     instance.m_nan_check_enabled = enable;
 }
@@ -294,6 +426,7 @@ void runtime::interpreter::INTBackend::set_nan_check(shared_ptr<Function> func,
 void runtime::interpreter::INTBackend::enable_performance_data(shared_ptr<Function> func,
                                                                bool enable)
 {
+    lock_guard<mutex> lock(m_mutex);
     FunctionInstance& instance = m_function_map[func];
     instance.m_performance_counters_enabled = enable;
 }
@@ -302,8 +435,13 @@ vector<runtime::PerformanceCounter>
     runtime::interpreter::INTBackend::get_performance_data(shared_ptr<Function> func) const
 {
     vector<runtime::PerformanceCounter> rc;
-    const FunctionInstance& instance = m_function_map.at(func);
-    for (const pair<const Node*, stopwatch> p : instance.m_timer_map)
+    const FunctionInstance* instance;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        instance = &m_function_map.at(func);
+    }
+    lock_guard<mutex> instance_lock(instance->m_mutex);
+    for (const pair<const Node*, stopwatch> p : instance->m_timer_map)
     {
         rc.emplace_back(p.first->get_name().c_str(),
                         p.second.get_total_microseconds(),
@@ -312,6 +450,14 @@ vector<runtime::PerformanceCounter>
     return rc;
 }
 
+runtime::MemoryUsage
+    runtime::interpreter::INTBackend::get_memory_usage(shared_ptr<Function> func) const
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_function_map.find(func);
+    return it == m_function_map.end() ? MemoryUsage() : it->second.m_memory_usage;
+}
+
 void runtime::interpreter::INTBackend::perform_nan_check(
     const vector<shared_ptr<HostTensor>>& tensors, const Node* op)
 {
@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -166,6 +169,7 @@ public:
     void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
     std::vector<PerformanceCounter>
         get_performance_data(std::shared_ptr<Function> func) const override;
+    MemoryUsage get_memory_usage(std::shared_ptr<Function> func) const override;
 
     bool is_supported(const Node& node) const override { return true; }
 private:
@@ -173,17 +177,56 @@ private:
     class FunctionInstance
     {
     public:
+        // Held while the function runs, directly or called by an op of another function;
+        // the instance's pool, timers and RNG states belong to one call at a time
+        mutable std::mutex m_mutex;
         bool m_is_compiled = false;
-        bool m_nan_check_enabled = false;
-        bool m_performance_counters_enabled = false;
+        std::atomic<bool> m_nan_check_enabled{false};
+        std::atomic<bool> m_performance_counters_enabled{false};
+        bool m_is_called = false;
+        // Guarded by the backend's m_mutex, since it is read without holding the instance
+        MemoryUsage m_memory_usage;
+        // Guarded by the backend's m_mutex: the calls running this function, directly or
+        // through an op, and the functions a call of this one runs, itself included
+        size_t m_active_calls = 0;
+        std::vector<std::shared_ptr<Function>> m_called_functions;
         std::unordered_map<const Node*, stopwatch> m_timer_map;
         std::vector<NodeWrapper> m_wrapped_nodes;
         std::unordered_map<const Node*, std::unique_ptr<RNGState>> m_states;
         std::unique_ptr<AlignedBuffer> m_temporary_memory;
+        // Pool of the running call; functions called by ops run in their caller's pool
+        char* m_temporary_pool = nullptr;
 
-        void* get_temporary_pointer(size_t offset) { return m_temporary_memory->get_ptr(offset); }
+        void* get_temporary_pointer(size_t offset) { return m_temporary_pool + offset; }
     };
     std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+    // Guards m_function_map. Calls of different functions run concurrently, while calls of
+    // the same function, including through call_async, are serialized by its instance.
+    // Compiling rewrites the functions it calls too, so it waits until none of them runs.
+    // m_mutex is never held while waiting for an instance.
+    mutable std::mutex m_mutex;
+    std::condition_variable m_idle;
+
+    FunctionInstance& get_instance(std::shared_ptr<Function> function);
+
+    void call(std::shared_ptr<Function> function,
+              FunctionInstance& instance,
+              const std::vector<std::shared_ptr<Tensor>>& outputs,
+              const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+    void execute(std::shared_ptr<Function> function,
+                 FunctionInstance& instance,
+                 const std::vector<void*>& outputs,
+                 const std::vector<void*>& inputs,
+                 char* temporary_pool);
+
+    /// \brief Runs the index'th function called by node in the memory the caller's pool
+    ///     reserves for it, without wrapping the buffers in tensors
+    void call_nested(const Node& node,
+                     size_t index,
+                     const std::vector<void*>& outputs,
+                     const std::vector<void*>& inputs,
+                     FunctionInstance& caller);
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
@@ -710,30 +753,12 @@ private:
         }
         case OP_TYPEID::FunctionCall:
         {
-            std::shared_ptr<Function> function = node.get_functions()[0];
-
-            std::vector<std::shared_ptr<runtime::Tensor>> outputs;
-            for (size_t i = 0; i < function->get_output_size(); i++)
+            std::vector<void*> inputs;
+            for (const void* arg : args)
             {
-                element::Type et = function->get_output_element_type(i);
-                Shape shape = function->get_output_shape(i);
-                auto host_tensor = std::make_shared<HostTensor>(et, shape, out[i]);
-                outputs.push_back(std::static_pointer_cast<runtime::Tensor>(host_tensor));
+                inputs.push_back(const_cast<void*>(arg));
             }
-
-            std::vector<std::shared_ptr<runtime::Tensor>> inputs;
-            auto parameters = function->get_parameters();
-            for (size_t i = 0; i < parameters.size(); i++)
-            {
-                auto parameter = parameters[i];
-                element::Type et = parameter->get_element_type();
-                Shape shape = parameter->get_shape();
-                auto host_tensor =
-                    std::make_shared<HostTensor>(et, shape, const_cast<void*>(args[i]));
-                inputs.push_back(std::static_pointer_cast<runtime::Tensor>(host_tensor));
-            }
-
-            call(function, outputs, inputs);
+            call_nested(node, 0, out, inputs, instance);
             break;
         }
         case OP_TYPEID::Greater:
@@ -983,17 +1008,11 @@ private:
         case OP_TYPEID::Reduce:
         {
             const op::Reduce* reduce = static_cast<const op::Reduce*>(&node);
-            std::shared_ptr<Function> reduction_function = reduce->get_functions()[0];
 
-            std::function<T(T, T)> f = [this, &node, reduction_function](T x, T y) -> T {
-                auto tx = std::make_shared<HostTensor>(
-                    node.get_inputs().at(0).get_element_type(), Shape{}, &x, "reduce_temp_x");
-                auto ty = std::make_shared<HostTensor>(
-                    node.get_inputs().at(1).get_element_type(), Shape{}, &y, "reduce_temp_y");
-                auto tr = std::make_shared<HostTensor>(
-                    node.get_output_element_type(0), Shape{}, "reduce_temp_r");
-                call(reduction_function, {tr}, {tx, ty});
-                return *(tr->get_data_ptr<T>());
+            std::function<T(T, T)> f = [this, &node, &instance](T x, T y) -> T {
+                T r;
+                call_nested(node, 0, {&r}, {&x, &y}, instance);
+                return r;
             };
 
             reference::reduce(static_cast<const T*>(args[0]),
@@ -1008,21 +1027,11 @@ private:
         case OP_TYPEID::ReduceWindow:
         {
             const op::ReduceWindow* reduce_window = static_cast<const op::ReduceWindow*>(&node);
-            std::shared_ptr<Function> reduction_function = reduce_window->get_functions()[0];
 
-            std::function<T(T, T)> f = [this, &node, reduction_function](T x, T y) -> T {
-                auto tx = std::make_shared<HostTensor>(node.get_inputs().at(0).get_element_type(),
-                                                       Shape{},
-                                                       &x,
-                                                       "reduce_window_temp_x");
-                auto ty = std::make_shared<HostTensor>(node.get_inputs().at(1).get_element_type(),
-                                                       Shape{},
-                                                       &y,
-                                                       "reduce_window_temp_y");
-                auto tr = std::make_shared<HostTensor>(
-                    node.get_output_element_type(0), Shape{}, "reduce_window_temp_r");
-                call(reduction_function, {tr}, {tx, ty});
-                return *(tr->get_data_ptr<T>());
+            std::function<T(T, T)> f = [this, &node, &instance](T x, T y) -> T {
+                T r;
+                call_nested(node, 0, {&r}, {&x, &y}, instance);
+                return r;
             };
 
             reference::reduce_window(static_cast<const T*>(args[0]),
@@ -1126,31 +1135,15 @@ private:
             const ngraph::op::SelectAndScatter* select_and_scatter =
                 static_cast<const ngraph::op::SelectAndScatter*>(&node);
 
-            std::shared_ptr<ngraph::Function> selection_function =
-                select_and_scatter->get_functions()[0];
-            std::function<bool(T, T)> f_selection = [this, &node, selection_function](T x,
-                                                                                      T y) -> bool {
-                auto tx = std::make_shared<runtime::HostTensor>(
-                    node.get_inputs().at(0).get_element_type(), Shape{}, &x, "selection_temp_x");
-                auto ty = std::make_shared<runtime::HostTensor>(
-                    node.get_inputs().at(1).get_element_type(), Shape{}, &y, "selection_temp_y");
-                auto tr = std::make_shared<runtime::HostTensor>(
-                    element::boolean, Shape{}, "selection_temp_r");
-                call(selection_function, {tr}, {tx, ty});
-                return *(tr->get_data_ptr<char>());
+            std::function<bool(T, T)> f_selection = [this, &node, &instance](T x, T y) -> bool {
+                char r;
+                call_nested(node, 0, {&r}, {&x, &y}, instance);
+                return r;
             };
-
-            std::shared_ptr<ngraph::Function> scatter_function =
-                select_and_scatter->get_functions()[1];
-            std::function<T(T, T)> f_scatter = [this, &node, scatter_function](T x, T y) -> T {
-                auto tx = std::make_shared<runtime::HostTensor>(
-                    node.get_inputs().at(0).get_element_type(), Shape{}, &x, "scatter_temp_x");
-                auto ty = std::make_shared<runtime::HostTensor>(
-                    node.get_inputs().at(1).get_element_type(), Shape{}, &y, "scatter_temp_y");
-                auto tr = std::make_shared<runtime::HostTensor>(
-                    node.get_output_element_type(0), Shape{}, "scatter_temp_r");
-                call(scatter_function, {tr}, {tx, ty});
-                return *(tr->get_data_ptr<T>());
+            std::function<T(T, T)> f_scatter = [this, &node, &instance](T x, T y) -> T {
+                T r;
+                call_nested(node, 1, {&r}, {&x, &y}, instance);
+                return r;
             };
 
             reference::select_and_scatter<T>(static_cast<const T*>(args[0]),
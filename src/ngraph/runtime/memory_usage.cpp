@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <sys/resource.h>
+#include <unordered_map>
+
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/memory_usage.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+void runtime::MemoryUsage::add_function(const shared_ptr<Function>& function)
+{
+    temporary_pool_size += function->get_temporary_pool_size();
+
+    unordered_map<descriptor::Tensor*, size_t> first_ops;
+    size_t index = 0;
+    for (const auto& node : function->get_ordered_ops())
+    {
+        if (node->is_constant())
+        {
+            for (size_t i = 0; i < node->get_output_size(); i++)
+            {
+                constant_bytes += node->get_output_tensor(i).size();
+            }
+        }
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            first_ops[tensor] = index;
+        }
+        for (descriptor::Tensor* tensor : node->liveness_free_list)
+        {
+            auto it = first_ops.find(tensor);
+            if (it != first_ops.end())
+            {
+                tensors.push_back({tensor->get_name(),
+                                   tensor->size(),
+                                   tensor->get_pool_offset(),
+                                   it->second,
+                                   index});
+            }
+        }
+        index++;
+    }
+}
+
+void runtime::MemoryUsage::merge(const MemoryUsage& other)
+{
+    temporary_pool_size += other.temporary_pool_size;
+    constant_bytes += other.constant_bytes;
+    workspace_bytes += other.workspace_bytes;
+    layout_conversion_bytes += other.layout_conversion_bytes;
+    peak_rss_delta = max(peak_rss_delta, other.peak_rss_delta);
+    tensors.insert(tensors.end(), other.tensors.begin(), other.tensors.end());
+}
+
+size_t runtime::get_peak_rss()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return usage.ru_maxrss;
+#else
+    // Linux reports kilobytes
+    return usage.ru_maxrss * 1024;
+#endif
+}
+
+ostream& runtime::operator<<(ostream& out, const MemoryUsage& usage)
+{
+    out << "temporary pool: " << usage.temporary_pool_size << " bytes\n";
+    out << "constants: " << usage.constant_bytes << " bytes\n";
+    out << "workspaces: " << usage.workspace_bytes << " bytes\n";
+    out << "layout conversions: " << usage.layout_conversion_bytes << " bytes\n";
+    out << "total: " << usage.get_total_bytes() << " bytes\n";
+    out << "peak RSS growth during first call: " << usage.peak_rss_delta << " bytes\n";
+    return out;
+}
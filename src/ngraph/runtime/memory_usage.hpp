@@ -0,0 +1,78 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ngraph
+{
+    class Function;
+
+    namespace runtime
+    {
+        /// \brief Lifetime of an intermediate tensor in the memory pool of a compiled Function
+        struct TensorLiveRange
+        {
+            std::string name;
+            size_t size;
+            size_t pool_offset;
+            /// Position in the execution order of the op that writes the tensor
+            size_t first_op;
+            /// Position in the execution order of the last op that reads the tensor
+            size_t last_op;
+        };
+
+        /// \brief Memory used by a compiled Function, as reported by Backend::get_memory_usage.
+        ///     Sizes are in bytes.
+        struct MemoryUsage
+        {
+            /// Pools holding the intermediate tensors of one call
+            size_t temporary_pool_size = 0;
+            /// Data of Constant ops
+            size_t constant_bytes = 0;
+            /// Scratch memory kept by kernels between calls, such as MKLDNN workspaces
+            size_t workspace_bytes = 0;
+            /// Intermediate tensors written by layout conversions; part of the pools
+            size_t layout_conversion_bytes = 0;
+            /// Growth of the peak resident set size of the process during the first call, or 0
+            /// if the function has not been called
+            size_t peak_rss_delta = 0;
+            std::vector<TensorLiveRange> tensors;
+
+            /// Memory held by the compiled function: pools, constants and workspaces
+            size_t get_total_bytes() const
+            {
+                return temporary_pool_size + constant_bytes + workspace_bytes;
+            }
+
+            /// Adds the pool size, constants and live ranges of a function that has been
+            /// through pass::Liveness and pass::MemoryLayout
+            void add_function(const std::shared_ptr<Function>& function);
+            /// Adds the usage of another compiled function, such as another specialization
+            void merge(const MemoryUsage& other);
+        };
+
+        /// \returns The peak resident set size of this process in bytes
+        size_t get_peak_rss();
+
+        std::ostream& operator<<(std::ostream& out, const MemoryUsage& usage);
+    }
+}
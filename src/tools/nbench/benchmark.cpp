@@ -250,6 +250,18 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
     float time = t1.get_milliseconds();
     cout << time / iterations << "ms per iteration" << endl;
 
+    runtime::MemoryUsage memory_usage = backend->get_memory_usage(f);
+    cout << "\n---- Memory usage ----\n" << memory_usage;
+    if (timing_detail)
+    {
+        for (const runtime::TensorLiveRange& tensor : memory_usage.tensors)
+        {
+            cout << tensor.name << ": " << tensor.size << " bytes at offset "
+                 << tensor.pool_offset << ", live from op " << tensor.first_op << " to op "
+                 << tensor.last_op << endl;
+        }
+    }
+
     vector<runtime::PerformanceCounter> perf_data = backend->get_performance_data(f);
     return perf_data;
 }
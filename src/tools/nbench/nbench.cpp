@@ -30,6 +30,7 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/cost_model.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
@@ -158,6 +159,47 @@ void print_results(vector<PerfShape> perf_data, bool timing_detail)
     }
 }
 
+void print_cost_comparison(shared_ptr<Function> f,
+                           const vector<runtime::PerformanceCounter>& perf_data,
+                           const runtime::CostModel& cost_model)
+{
+    auto node_map = get_node_map(f);
+    map<string, pair<double, double>> times;
+    for (const runtime::PerformanceCounter& p : perf_data)
+    {
+        auto it = node_map.find(p.name());
+        if (it != node_map.end())
+        {
+            pair<double, double>& t = times[it->second->description()];
+            t.first += p.microseconds();
+            t.second += cost_model.get_cost(*it->second).microseconds;
+        }
+    }
+
+    size_t name_width = 2;
+    for (const pair<const string, pair<double, double>>& t : times)
+    {
+        name_width = max(name_width, t.first.size());
+    }
+    cout << "\n---- Measured vs predicted times per op type ----\n";
+    cout << setw(name_width + 2) << left << "Op" << setw(14) << right << "measured"
+         << setw(14) << "predicted" << setw(10) << "ratio\n";
+    double total_measured = 0;
+    double total_predicted = 0;
+    for (const pair<const string, pair<double, double>>& t : times)
+    {
+        total_measured += t.second.first;
+        total_predicted += t.second.second;
+        cout << setw(name_width + 2) << left << t.first << setw(12) << right << fixed
+             << setprecision(1) << t.second.first << "us" << setw(12) << t.second.second << "us"
+             << setw(9) << setprecision(2)
+             << (t.second.first > 0 ? t.second.second / t.second.first : 0) << "\n";
+    }
+    cout << setw(name_width + 2) << left << "Total" << setw(12) << right << setprecision(1)
+         << total_measured << "us" << setw(12) << total_predicted << "us\n";
+    cout.unsetf(ios_base::floatfield);
+}
+
 element::Type get_op_element_type(const Node& op)
 {
     element::Type type;
@@ -193,6 +235,8 @@ int main(int argc, char** argv)
     bool visualize = false;
     int warmup_iterations = 1;
     bool copy_data = true;
+    string cost_model_file;
+    string calibrate_file;
 
     for (size_t i = 1; i < argc; i++)
     {
@@ -233,6 +277,14 @@ int main(int argc, char** argv)
         {
             visualize = true;
         }
+        else if (arg == "--cost_model" || arg == "--cost-model")
+        {
+            cost_model_file = argv[++i];
+        }
+        else if (arg == "--calibrate")
+        {
+            calibrate_file = argv[++i];
+        }
         else if (arg == "-d" || arg == "--directory")
         {
             directory = argv[++i];
@@ -255,6 +307,33 @@ int main(int argc, char** argv)
             failed = true;
         }
     }
+    if (!calibrate_file.empty())
+    {
+        if (backend.empty())
+        {
+            cout << "--calibrate requires a backend\n";
+            return 1;
+        }
+        cout << "Calibrating the " << backend << " cost model\n";
+        runtime::CostModel::calibrate(backend, iterations)->save(calibrate_file);
+        cout << "Cost model written to " << calibrate_file << "\n";
+        if (directory.empty() && model_arg.empty())
+        {
+            return 0;
+        }
+    }
+
+    shared_ptr<runtime::CostModel> cost_model;
+    if (!cost_model_file.empty())
+    {
+        if (!file_util::exists(cost_model_file))
+        {
+            cout << "File " << cost_model_file << " not found\n";
+            return 1;
+        }
+        cost_model = runtime::CostModel::load(cost_model_file);
+    }
+
     if (!model_arg.empty() && !file_util::exists(model_arg))
     {
         cout << "File " << model_arg << " not found\n";
@@ -290,6 +369,8 @@ OPTIONS
         --timing_detail           Gather detailed timing
         -w|--warmup_iterations    Number of warm-up iterations
         --no_copy_data            Disable copy of input/result data every iteration
+        --calibrate <file>        Calibrate a cost model for the backend and save it to file
+        --cost_model <file>       Compare per op times with the predictions of a cost model
 )###";
         return 1;
     }
@@ -386,12 +467,20 @@ OPTIONS
             {
                 cout << "\n---- Benchmark ----\n";
                 shared_ptr<Function> f = deserialize(model);
-                auto perf_data = run_benchmark(
-                    f, backend, iterations, timing_detail, warmup_iterations, copy_data);
+                auto perf_data = run_benchmark(f,
+                                               backend,
+                                               iterations,
+                                               timing_detail || cost_model,
+                                               warmup_iterations,
+                                               copy_data);
                 auto perf_shape = to_perf_shape(f, perf_data);
                 aggregate_perf_data.insert(
                     aggregate_perf_data.end(), perf_shape.begin(), perf_shape.end());
                 print_results(perf_shape, timing_detail);
+                if (cost_model)
+                {
+                    print_cost_comparison(f, perf_data, *cost_model);
+                }
             }
         }
         catch (ngraph::unsupported_op& ue)
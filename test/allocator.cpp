@@ -0,0 +1,110 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint>
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/allocator.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(allocator, alignment)
+{
+    runtime::Allocator allocator;
+    for (size_t alignment : {8, 64, 4096})
+    {
+        void* ptr = allocator.allocate(100, alignment);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0);
+        allocator.deallocate(ptr, 100, alignment);
+    }
+    EXPECT_THROW(allocator.allocate(100, 48), ngraph_error);
+}
+
+TEST(allocator, pool_reuse)
+{
+    auto allocator = make_shared<runtime::Allocator>(false, 1 << 20);
+    void* ptr;
+    {
+        runtime::AlignedBuffer buffer(1000, 64, allocator);
+        ptr = buffer.get_ptr();
+        auto stats = allocator->get_statistics();
+        EXPECT_EQ(stats.allocations, 1);
+        EXPECT_GE(stats.bytes_in_use, 1000);
+        EXPECT_EQ(stats.bytes_pooled, 0);
+    }
+    auto stats = allocator->get_statistics();
+    EXPECT_EQ(stats.deallocations, 1);
+    EXPECT_EQ(stats.bytes_in_use, 0);
+    EXPECT_GT(stats.bytes_pooled, 0);
+
+    // A slightly smaller buffer falls in the same size class
+    {
+        runtime::AlignedBuffer buffer(990, 64, allocator);
+        EXPECT_EQ(buffer.get_ptr(), ptr);
+        EXPECT_EQ(allocator->get_statistics().pool_hits, 1);
+    }
+    EXPECT_EQ(allocator->get_statistics().peak_bytes_in_use, stats.peak_bytes_in_use);
+
+    allocator->release_pool();
+    EXPECT_EQ(allocator->get_statistics().bytes_pooled, 0);
+}
+
+TEST(allocator, pool_limit)
+{
+    auto allocator = make_shared<runtime::Allocator>(false, 1024);
+    {
+        runtime::AlignedBuffer buffer(4096, 64, allocator);
+    }
+    EXPECT_EQ(allocator->get_statistics().bytes_pooled, 0);
+}
+
+TEST(allocator, huge_pages)
+{
+    auto allocator = make_shared<runtime::Allocator>(true);
+    size_t huge_page_size = 2 * 1024 * 1024;
+    {
+        runtime::AlignedBuffer buffer(8 * huge_page_size + 1, 64, allocator);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer.get_ptr()) % huge_page_size, 0);
+        EXPECT_EQ(allocator->get_statistics().huge_page_bytes, 9 * huge_page_size);
+
+        runtime::AlignedBuffer small(1024, 64, allocator);
+        EXPECT_EQ(allocator->get_statistics().huge_page_bytes, 9 * huge_page_size);
+
+        // Rounding these up to whole huge pages would waste more than 1/8 of them
+        runtime::AlignedBuffer just_over(huge_page_size + 1, 64, allocator);
+        runtime::AlignedBuffer seven_over(7 * huge_page_size + 1, 64, allocator);
+        EXPECT_EQ(allocator->get_statistics().huge_page_bytes, 9 * huge_page_size);
+    }
+    EXPECT_EQ(allocator->get_statistics().huge_page_bytes, 0);
+}
+
+TEST(allocator, default_allocator)
+{
+    auto previous = runtime::Allocator::get_default();
+    auto allocator = make_shared<runtime::Allocator>();
+    runtime::Allocator::set_default(allocator);
+    {
+        runtime::HostTensor tensor(element::f32, Shape{2, 3});
+        EXPECT_EQ(allocator->get_statistics().bytes_in_use, 2 * 3 * sizeof(float));
+    }
+    EXPECT_EQ(allocator->get_statistics().deallocations, 1);
+    runtime::Allocator::set_default(previous);
+}
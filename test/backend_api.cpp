@@ -18,6 +18,7 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/util.hpp"
+#include "util/test_tools.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -34,3 +35,49 @@ TEST(backend_api, invalid_name)
 {
     ASSERT_ANY_THROW(ngraph::runtime::Backend::create("COMPLETELY-BOGUS-NAME"));
 }
+
+TEST(backend_api, memory_usage)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>((A + B) * C - A, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    EXPECT_EQ(0, backend->get_memory_usage(f).get_total_bytes());
+    backend->compile(f);
+
+    runtime::MemoryUsage usage = backend->get_memory_usage(f);
+    EXPECT_EQ(f->get_temporary_pool_size(), usage.temporary_pool_size);
+    EXPECT_EQ(16, usage.constant_bytes);
+    EXPECT_EQ(usage.temporary_pool_size + 16, usage.get_total_bytes());
+    EXPECT_EQ(0, usage.peak_rss_delta);
+    // A + B, its product with C and the difference live in the pool
+    ASSERT_EQ(3, usage.tensors.size());
+    for (const runtime::TensorLiveRange& tensor : usage.tensors)
+    {
+        EXPECT_EQ(16, tensor.size);
+        EXPECT_LT(tensor.first_op, tensor.last_op);
+        EXPECT_LE(tensor.pool_offset + tensor.size, usage.temporary_pool_size);
+    }
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    backend->call_with_validate(f, {result}, {a, b});
+    EXPECT_EQ((vector<float>{5, 14, 27, 44}), read_vector<float>(result));
+
+    // Calling does not add to what the compiled function holds
+    runtime::MemoryUsage called_usage = backend->get_memory_usage(f);
+    EXPECT_EQ(usage.temporary_pool_size, called_usage.temporary_pool_size);
+    EXPECT_EQ(usage.get_total_bytes(), called_usage.get_total_bytes());
+    ASSERT_EQ(3, called_usage.tensors.size());
+    for (const runtime::TensorLiveRange& tensor : called_usage.tensors)
+    {
+        EXPECT_EQ(16, tensor.size);
+        EXPECT_LE(tensor.pool_offset + tensor.size, called_usage.temporary_pool_size);
+    }
+}
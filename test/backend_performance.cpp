@@ -16,6 +16,7 @@
 
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -23,9 +24,25 @@
 #include "ngraph/codegen/compiler.hpp"
 #include "ngraph/codegen/execution_engine.hpp"
 #include "ngraph/file_util.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/pass/buffer_aliasing.hpp"
+#include "ngraph/pass/core_fusion.hpp"
+#include "ngraph/pass/cse.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/batching_server.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "util/random.hpp"
@@ -139,3 +156,379 @@ TEST(benchmark, concat_32x1x200_axis1_6)
         }
     }
 }
+
+//
+// Measures the per-op dispatch overhead of the CPU backend on a chain of adds of
+// single-element tensors. Marking one input as not stale makes every op check its inputs
+// for staleness, although all of them still run because the other input is stale.
+//
+TEST(benchmark, DISABLED_cpu_dispatch_overhead_add_chain_1000)
+{
+    const size_t n_ops = 1000;
+    const int n_runs = 2000;
+    Shape shape{1};
+
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> chain = A;
+    for (size_t i = 0; i < n_ops; i++)
+    {
+        chain = make_shared<op::Add>(chain, B);
+    }
+    auto f = make_shared<Function>(chain, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1.0f});
+    copy_data(b, vector<float>{1.0f});
+    backend->call_with_validate(f, {result}, {a, b});
+    EXPECT_EQ(vector<float>{static_cast<float>(n_ops + 1)}, read_vector<float>(result));
+
+    for (bool track_stale : {false, true})
+    {
+        a->set_stale(!track_stale);
+        stopwatch sw;
+        sw.start();
+        for (int i = 0; i < n_runs; i++)
+        {
+            backend->call(f, {result}, {a, b});
+        }
+        sw.stop();
+        std::cout << (track_stale ? "stale tracking: " : "no stale tracking: ")
+                  << (sw.get_nanoseconds() / (n_runs * n_ops)) << " ns/op" << std::endl;
+    }
+    EXPECT_EQ(vector<float>{static_cast<float>(n_ops + 1)}, read_vector<float>(result));
+}
+
+//
+// Compares the throughput of single-row requests from concurrent clients executed one call
+// each against the same requests batched by a BatchingServer on a dynamic batch dimension.
+//
+TEST(benchmark, DISABLED_cpu_batching_server_dot_256)
+{
+    const size_t n_features = 256;
+    const size_t n_clients = 8;
+    const size_t n_requests = 250;
+    const size_t max_batch_size = 32;
+
+    auto make_function = [n_features](const PartialShape& shape) {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto W = op::Constant::create(element::f32,
+                                      Shape{n_features, n_features},
+                                      vector<float>(n_features * n_features, 1.0f / n_features));
+        return make_shared<Function>(make_shared<op::Dot>(A, W), op::ParameterVector{A});
+    };
+    auto f = make_function(PartialShape{1, n_features});
+    auto batched_f = make_function(PartialShape{Dimension::dynamic(), n_features});
+
+    auto backend = runtime::Backend::create("CPU");
+    vector<shared_ptr<runtime::Tensor>> args, results;
+    for (size_t i = 0; i < n_clients; i++)
+    {
+        args.push_back(backend->create_tensor(element::f32, Shape{1, n_features}));
+        results.push_back(backend->create_tensor(element::f32, Shape{1, n_features}));
+        copy_data(args.back(), vector<float>(n_features, static_cast<float>(i)));
+    }
+
+    auto run_clients = [&](const string& name, function<void(size_t)> request) {
+        // Compile outside of the timed region
+        request(0);
+        stopwatch sw;
+        sw.start();
+        vector<thread> clients;
+        for (size_t i = 0; i < n_clients; i++)
+        {
+            clients.emplace_back([&request, i]() {
+                for (size_t j = 0; j < n_requests; j++)
+                {
+                    request(i);
+                }
+            });
+        }
+        for (auto& client : clients)
+        {
+            client.join();
+        }
+        sw.stop();
+        cout << name << ": " << (n_clients * n_requests * 1000000.0 / sw.get_microseconds())
+             << " requests/s" << endl;
+        for (size_t i = 0; i < n_clients; i++)
+        {
+            EXPECT_EQ(vector<float>(n_features, static_cast<float>(i)),
+                      read_vector<float>(results[i]));
+        }
+    };
+
+    run_clients("unbatched", [&](size_t i) { backend->call(f, {results[i]}, {args[i]}); });
+
+    runtime::BatchingServer server(
+        backend.get(), batched_f, max_batch_size, chrono::microseconds(200));
+    run_clients("batched", [&](size_t i) { server.submit({results[i]}, {args[i]}).get(); });
+
+    // Every request was served, and concurrent requests shared batches
+    auto statistics = server.get_statistics();
+    EXPECT_EQ(n_clients * n_requests + 1, statistics.requests);
+    EXPECT_EQ(statistics.requests, statistics.rows);
+    EXPECT_GT(statistics.get_mean_batch_size(), 1.0);
+    EXPECT_LE(statistics.get_mean_batch_size(), max_batch_size);
+    cout << "batches: " << statistics.batches
+         << ", mean batch size: " << statistics.get_mean_batch_size()
+         << ", mean queue latency: " << statistics.get_mean_queue_latency_us() << " us"
+         << ", max queue latency: " << statistics.max_queue_latency.count() << " us" << endl;
+}
+
+//
+// Compares the temporary pool sizes that first fit in op order and offline packing give the
+// serialized models, and their gap to the lower bound of the most bytes live at once.
+//
+TEST(benchmark, DISABLED_memory_layout_offline_packing)
+{
+    const size_t alignment = 64;
+    size_t total_first_fit = 0;
+    size_t total_packed = 0;
+    size_t total_lower_bound = 0;
+    file_util::iterate_files(
+        SERIALIZED_ZOO,
+        [&](const string& file, bool is_dir) {
+            if (is_dir || file_util::get_file_ext(file) != ".json")
+            {
+                return;
+            }
+            stringstream ss(file_util::read_file_to_string(file));
+            shared_ptr<Function> f = deserialize(ss);
+
+            pass::Liveness().run_on_function(f);
+            pass::MemoryLayout first_fit(alignment);
+            first_fit.run_on_function(f);
+            size_t first_fit_size = f->get_temporary_pool_size();
+            pass::MemoryLayout(alignment, false, true).run_on_function(f);
+            size_t packed_size = f->get_temporary_pool_size();
+            size_t lower_bound = first_fit.get_lower_bound();
+            EXPECT_GE(packed_size, lower_bound);
+
+            cout << file_util::get_file_name(file) << ": first fit " << first_fit_size
+                 << ", packed " << packed_size << ", lower bound " << lower_bound << endl;
+            total_first_fit += first_fit_size;
+            total_packed += packed_size;
+            total_lower_bound += lower_bound;
+        },
+        true);
+    cout << "total: first fit " << total_first_fit << ", packed " << total_packed
+         << ", lower bound " << total_lower_bound << endl;
+    EXPECT_LE(total_packed, total_first_fit);
+}
+
+//
+// Reports the copies that views remove and the bytes computed in place when
+// pass::BufferAliasing runs before the memory layout of the serialized models.
+//
+TEST(benchmark, DISABLED_buffer_aliasing)
+{
+    const size_t alignment = 64;
+    size_t total_views = 0;
+    size_t total_in_place = 0;
+    size_t total_original_size = 0;
+    size_t total_aliased_size = 0;
+    file_util::iterate_files(
+        SERIALIZED_ZOO,
+        [&](const string& file, bool is_dir) {
+            if (is_dir || file_util::get_file_ext(file) != ".json")
+            {
+                return;
+            }
+            stringstream ss(file_util::read_file_to_string(file));
+            shared_ptr<Function> f = deserialize(ss);
+
+            pass::Liveness().run_on_function(f);
+            pass::MemoryLayout(alignment).run_on_function(f);
+            size_t original_size = f->get_temporary_pool_size();
+            pass::BufferAliasing().run_on_function(f);
+            pass::Liveness().run_on_function(f);
+            pass::MemoryLayout layout(alignment);
+            layout.run_on_function(f);
+
+            cout << file_util::get_file_name(file) << ": " << layout.get_view_bytes()
+                 << " bytes of copies removed, " << layout.get_in_place_bytes()
+                 << " bytes computed in place, pool " << original_size << " -> "
+                 << f->get_temporary_pool_size() << endl;
+            total_views += layout.get_view_bytes();
+            total_in_place += layout.get_in_place_bytes();
+            total_original_size += original_size;
+            total_aliased_size += f->get_temporary_pool_size();
+        },
+        true);
+    cout << "total: " << total_views << " bytes of copies removed, " << total_in_place
+         << " bytes computed in place, pool " << total_original_size << " -> "
+         << total_aliased_size << endl;
+    EXPECT_GT(total_views, 0);
+    EXPECT_GT(total_in_place, 0);
+    // A view can keep a buffer alive longer, so a small pool may grow, but not the total
+    EXPECT_LE(total_aliased_size, total_original_size);
+}
+
+//
+// Measures the cost of the topological order of a 50k-op graph computed from scratch, as
+// get_ordered_ops did on every call, against the cached order and the order patched after
+// a rewrite, and the time the CPU backend takes to compile the graph.
+//
+TEST(benchmark, DISABLED_cached_ordered_ops_50k)
+{
+    const size_t n_layers = 12500;
+    const int n_runs = 20;
+    Shape shape{2};
+
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> x = A;
+    for (size_t i = 0; i < n_layers; i++)
+    {
+        auto y = make_shared<op::Multiply>(x, B);
+        x = make_shared<op::Add>(make_shared<op::Negative>(y), y) + x;
+    }
+    auto f = make_shared<Function>(x, op::ParameterVector{A, B});
+    size_t n_ops = f->get_ops().size();
+    cout << n_ops << " ops" << endl;
+
+    stopwatch sw;
+    sw.start();
+    for (int i = 0; i < n_runs; i++)
+    {
+        topological_sort(f->get_ops(false), true);
+    }
+    sw.stop();
+    size_t from_scratch_us = sw.get_microseconds() / n_runs;
+    cout << "from scratch: " << from_scratch_us << " us" << endl;
+
+    f->get_ordered_ops();
+    sw.start();
+    for (int i = 0; i < n_runs; i++)
+    {
+        f->get_ordered_ops();
+    }
+    sw.stop();
+    size_t cached_us = sw.get_microseconds() / n_runs;
+    cout << "cached: " << cached_us << " us" << endl;
+
+    sw.start();
+    for (int i = 0; i < n_runs; i++)
+    {
+        auto root = f->get_results().at(0)->get_argument(0);
+        replace_node(root, root->copy_with_new_args(root->get_arguments()));
+        f->get_ordered_ops();
+    }
+    sw.stop();
+    size_t patched_us = sw.get_microseconds() / n_runs;
+    cout << "patched after a rewrite: " << patched_us << " us" << endl;
+
+    // The cache only copies the order, and a rewrite only touches the ops around it
+    EXPECT_LT(cached_us, from_scratch_us);
+    EXPECT_LT(patched_us, from_scratch_us);
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(n_ops, ordered_ops.size());
+    EXPECT_TRUE(validate_list(ordered_ops));
+
+    auto backend = runtime::Backend::create("CPU");
+    sw.start();
+    backend->compile(f);
+    sw.stop();
+    cout << "CPU compile: " << sw.get_milliseconds() << " ms" << endl;
+}
+
+//
+// Measures CoreFusion on a 30k-op graph of 10k layers that each hold a relu written as a
+// maximum with a broadcast zero, and again once the relus are fused.
+//
+TEST(benchmark, DISABLED_core_fusion_relu_10k)
+{
+    const size_t n_layers = 10000;
+    Shape shape{2};
+
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto zero = op::Constant::create(element::f32, Shape{}, {0});
+    shared_ptr<Node> x = A;
+    for (size_t i = 0; i < n_layers; i++)
+    {
+        auto broadcast_zero = make_shared<op::Broadcast>(zero, shape, AxisSet{0});
+        x = make_shared<op::Maximum>(broadcast_zero, x * B);
+    }
+    auto f = make_shared<Function>(x, op::ParameterVector{A, B});
+    cout << f->get_ops().size() << " ops" << endl;
+
+    stopwatch sw;
+    sw.start();
+    pass::CoreFusion().run_on_function(f);
+    sw.stop();
+    size_t n_relus = 0;
+    for (auto node : f->get_ordered_ops())
+    {
+        n_relus += dynamic_pointer_cast<op::Relu>(node) ? 1 : 0;
+    }
+    EXPECT_EQ(n_layers, n_relus);
+    cout << "CoreFusion: " << sw.get_milliseconds() << " ms" << endl;
+
+    // Nothing is left to fuse, so this is the cost of the sweep alone
+    size_t n_ops = f->get_ops().size();
+    sw.start();
+    pass::CoreFusion().run_on_function(f);
+    sw.stop();
+    EXPECT_EQ(n_ops, f->get_ops().size());
+    cout << "CoreFusion on the fused graph: " << sw.get_milliseconds() << " ms" << endl;
+}
+
+//
+// Measures a cold compile of a deployment of 16 models of 20k ops each through CSE and
+// Liveness, with the models' functions passed over serially and then across all cores.
+//
+TEST(benchmark, DISABLED_parallel_passes_16_models)
+{
+    const size_t n_models = 16;
+    const size_t n_layers = 5000;
+    Shape shape{2};
+
+    auto make_models = [&]() {
+        vector<shared_ptr<Function>> models;
+        for (size_t m = 0; m < n_models; m++)
+        {
+            auto A = make_shared<op::Parameter>(element::f32, shape);
+            auto B = make_shared<op::Parameter>(element::f32, shape);
+            shared_ptr<Node> x = A;
+            for (size_t i = 0; i < n_layers; i++)
+            {
+                x = make_shared<op::Negative>(x * B) + make_shared<op::Negative>(x * B);
+            }
+            models.push_back(make_shared<Function>(x, op::ParameterVector{A, B}));
+        }
+        return models;
+    };
+
+    // Ops left in each model by the serial run, which the parallel run must reproduce
+    vector<size_t> serial_op_counts;
+    for (size_t threads : {size_t(1), size_t(std::thread::hardware_concurrency())})
+    {
+        auto models = make_models();
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+        pass_manager.register_pass<pass::Liveness>();
+        pass_manager.set_function_pass_threads(threads);
+
+        stopwatch sw;
+        sw.start();
+        pass_manager.run_passes(models);
+        sw.stop();
+        vector<size_t> op_counts;
+        for (auto model : models)
+        {
+            EXPECT_EQ(count_ops_of_type<op::Negative>(model), n_layers);
+            op_counts.push_back(model->get_ops().size());
+        }
+        if (serial_op_counts.empty())
+        {
+            serial_op_counts = op_counts;
+        }
+        EXPECT_EQ(serial_op_counts, op_counts);
+        cout << threads << " threads: " << sw.get_milliseconds() << " ms" << endl;
+    }
+}
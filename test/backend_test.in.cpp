@@ -16,11 +16,13 @@
 
 #include <algorithm>
 #include <algorithm>
+#include <atomic>
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
 #include <random>
 #include <string>
+#include <thread>
 #include "gtest/gtest.h"
 
 #include "ngraph/autodiff/adjoints.hpp"
@@ -171,6 +173,140 @@ NGRAPH_TEST(${BACKEND_NAME}, aliased_output)
     EXPECT_EQ(expectedE, read_vector<float>(out7));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, call_async)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Two requests in flight on separate tensors
+    auto a1 = backend->create_tensor(element::f32, shape);
+    auto b1 = backend->create_tensor(element::f32, shape);
+    auto result1 = backend->create_tensor(element::f32, shape);
+    auto a2 = backend->create_tensor(element::f32, shape);
+    auto b2 = backend->create_tensor(element::f32, shape);
+    auto result2 = backend->create_tensor(element::f32, shape);
+
+    copy_data(a1, vector<float>{1, 2, 3, 4});
+    copy_data(b1, vector<float>{5, 6, 7, 8});
+    auto future1 = backend->call_async(f, {result1}, {a1, b1});
+
+    copy_data(a2, vector<float>{0, 1, 0, 1});
+    copy_data(b2, vector<float>{2, 2, 3, 3});
+    auto future2 = backend->call_async(f, {result2}, {a2, b2});
+
+    EXPECT_TRUE(future1.get());
+    EXPECT_TRUE(future2.get());
+    EXPECT_EQ((vector<float>{30, 48, 70, 96}), read_vector<float>(result1));
+    EXPECT_EQ((vector<float>{4, 6, 9, 12}), read_vector<float>(result2));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, call_async_shared_callee)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B, op::ParameterVector{A, B});
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto Y = make_shared<op::Parameter>(element::f32, shape);
+    auto g = make_shared<Function>(make_shared<op::FunctionCall>(f, NodeVector{X + Y, Y}),
+                                   op::ParameterVector{X, Y});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    backend->compile(f);
+    backend->compile(g);
+
+    // f runs directly and as called by g at the same time
+    vector<shared_ptr<runtime::Tensor>> results;
+    vector<future<bool>> futures;
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    for (size_t i = 0; i < 16; i++)
+    {
+        results.push_back(backend->create_tensor(element::f32, shape));
+        futures.push_back(backend->call_async(i % 2 ? g : f, {results.back()}, {a, b}));
+    }
+    for (size_t i = 0; i < futures.size(); i++)
+    {
+        EXPECT_TRUE(futures[i].get());
+        EXPECT_EQ(i % 2 ? (vector<float>{55, 84, 119, 160}) : (vector<float>{30, 48, 70, 96}),
+                  read_vector<float>(results[i]));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, compile_during_calls)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + B, op::ParameterVector{A, B});
+    auto g = make_shared<Function>(A * B, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    backend->compile(f);
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+
+    // Several threads keep a call of f running at all times; compiling and calling g must not
+    // wait for them to stop
+    atomic<bool> done{false};
+    vector<thread> threads;
+    for (size_t i = 0; i < 8; i++)
+    {
+        threads.emplace_back([&]() {
+            auto result = backend->create_tensor(element::f32, shape);
+            while (!done)
+            {
+                backend->call(f, {result}, {a, b});
+            }
+        });
+    }
+    auto result = backend->create_tensor(element::f32, shape);
+    backend->call_with_validate(g, {result}, {a, b});
+    done = true;
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    EXPECT_EQ((vector<float>{5, 12, 21, 32}), read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, bind_run)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto bound = backend->bind(f, {result}, {a, b});
+
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    EXPECT_TRUE(bound->run());
+    EXPECT_EQ((vector<float>{30, 48, 70, 96}), read_vector<float>(result));
+
+    // New data in the bound tensors is picked up by the next run
+    copy_data(a, vector<float>{0, 1, 0, 1});
+    copy_data(b, vector<float>{2, 2, 3, 3});
+    EXPECT_TRUE(bound->run());
+    EXPECT_EQ((vector<float>{4, 6, 9, 12}), read_vector<float>(result));
+
+    // Binding validates the tensors once
+    EXPECT_ANY_THROW(backend->bind(f, {result}, {a}));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, parameter_as_output)
 {
     Shape shape{3, 4};
@@ -0,0 +1,125 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <future>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/batching_server.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<Function> make_batched_add(const PartialShape& shape)
+{
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    return make_shared<Function>(make_shared<op::Add>(A, B), op::ParameterVector{A, B});
+}
+
+TEST(batching_server, padded_batches)
+{
+    const size_t max_batch_size = 4;
+    auto f = make_batched_add(PartialShape{max_batch_size, 2});
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    vector<size_t> request_rows{1, 3, 2, 2, 1};
+    vector<shared_ptr<runtime::Tensor>> as, bs, results;
+    vector<vector<float>> expected;
+    float value = 0;
+    for (size_t rows : request_rows)
+    {
+        Shape shape{rows, 2};
+        vector<float> a_data, b_data, result_data;
+        for (size_t i = 0; i < shape_size(shape); i++)
+        {
+            a_data.push_back(value);
+            b_data.push_back(100 * value);
+            result_data.push_back(101 * value);
+            value++;
+        }
+        as.push_back(backend->create_tensor(element::f32, shape));
+        bs.push_back(backend->create_tensor(element::f32, shape));
+        results.push_back(backend->create_tensor(element::f32, shape));
+        copy_data(as.back(), a_data);
+        copy_data(bs.back(), b_data);
+        expected.push_back(result_data);
+    }
+
+    vector<future<void>> futures;
+    {
+        runtime::BatchingServer server(backend.get(), f, max_batch_size, chrono::milliseconds(10));
+        for (size_t i = 0; i < request_rows.size(); i++)
+        {
+            futures.push_back(server.submit({results[i]}, {as[i], bs[i]}));
+        }
+        for (auto& result : futures)
+        {
+            result.get();
+        }
+
+        auto statistics = server.get_statistics();
+        EXPECT_EQ(request_rows.size(), statistics.requests);
+        EXPECT_EQ(9u, statistics.rows);
+        EXPECT_GE(statistics.batches, 3u);
+        EXPECT_LE(statistics.get_mean_batch_size(), max_batch_size);
+    }
+    for (size_t i = 0; i < request_rows.size(); i++)
+    {
+        EXPECT_EQ(expected[i], read_vector<float>(results[i]));
+    }
+}
+
+TEST(batching_server, timeout_flushes_partial_batch)
+{
+    auto f = make_batched_add(PartialShape{8, 1});
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatchingServer server(backend.get(), f, 8, chrono::milliseconds(1));
+
+    auto a = backend->create_tensor(element::f32, Shape{1, 1});
+    auto b = backend->create_tensor(element::f32, Shape{1, 1});
+    auto result = backend->create_tensor(element::f32, Shape{1, 1});
+    copy_data(a, vector<float>{1});
+    copy_data(b, vector<float>{2});
+    server.submit({result}, {a, b}).get();
+    EXPECT_EQ(vector<float>{3}, read_vector<float>(result));
+    EXPECT_EQ(1u, server.get_statistics().batch_size_histogram.at(1));
+}
+
+TEST(batching_server, invalid_requests)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    EXPECT_THROW(runtime::BatchingServer(
+                     backend.get(), make_batched_add(PartialShape{2, 3}), 4, chrono::seconds(1)),
+                 ngraph_error);
+    EXPECT_THROW(runtime::BatchingServer(backend.get(),
+                                         make_batched_add(PartialShape{4, Dimension::dynamic()}),
+                                         4,
+                                         chrono::seconds(1)),
+                 ngraph_error);
+
+    auto f = make_batched_add(PartialShape{4, 3});
+    runtime::BatchingServer server(backend.get(), f, 4, chrono::seconds(1));
+    auto small = backend->create_tensor(element::f32, Shape{2, 3});
+    auto large = backend->create_tensor(element::f32, Shape{5, 3});
+    auto wrong = backend->create_tensor(element::f32, Shape{2, 2});
+    EXPECT_THROW(server.submit({small}, {large, large}), ngraph_error);
+    EXPECT_THROW(server.submit({small}, {small, wrong}), ngraph_error);
+    EXPECT_THROW(server.submit({small}, {small}), ngraph_error);
+}
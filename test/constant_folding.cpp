@@ -285,3 +285,89 @@ TEST(constant_folding, const_quantize)
     vector<output_c_type> values_quantize{2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5};
     ASSERT_EQ(values_quantize, values_out);
 }
+
+TEST(constant_folding, constant_evaluate)
+{
+    auto a = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto b = op::Constant::create(element::f32, Shape{3, 2}, {1, 0, 0, 1, 1, 1});
+    auto c = op::Constant::create(element::f32, Shape{2, 3}, {3, 3, 3, 3, 3, 3});
+    auto indices = op::Constant::create(element::i32, Shape{3}, {2, 0, 1});
+
+    auto dot = make_shared<op::Dot>(a, b);
+    auto concat = make_shared<op::Concat>(NodeVector{dot, dot}, 0);
+    auto slice = make_shared<op::Slice>(concat, Coordinate{1, 0}, Coordinate{3, 2});
+    auto sum = make_shared<op::Sum>(slice, AxisSet{1});
+    auto convert = make_shared<op::Convert>(sum, element::i32);
+    auto reverse = make_shared<op::Reverse>(convert, AxisSet{0});
+    auto one_hot = make_shared<op::OneHot>(indices, Shape{3, 3}, 1);
+    auto select = make_shared<op::Select>(
+        make_shared<op::Greater>(a, c), a, make_shared<op::Negative>(a));
+
+    auto f = make_shared<Function>(NodeVector{reverse, one_hot, select}, op::ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    // Only the results and the constants they return are left
+    ASSERT_EQ(f->get_ops().size(), 6);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 3);
+
+    // dot is {{4, 5}, {10, 11}}; rows 1 and 2 of it stacked twice are summed and reversed
+    vector<int> reverse_expected{9, 21};
+    vector<int> one_hot_expected{0, 0, 1, 1, 0, 0, 0, 1, 0};
+    vector<float> select_expected{-1, -2, -3, 4, 5, 6};
+    ASSERT_EQ(get_result_constant<int>(f, 0), reverse_expected);
+    ASSERT_EQ(get_result_constant<int>(f, 1), one_hot_expected);
+    ASSERT_EQ(get_result_constant<float>(f, 2), select_expected);
+}
+
+TEST(constant_folding, constant_evaluate_size_cap)
+{
+    auto a = op::Constant::create(element::f32, Shape{}, {1});
+    auto broadcast = make_shared<op::Broadcast>(a, Shape{64, 64}, AxisSet{0, 1});
+    auto f = make_shared<Function>(make_shared<op::Exp>(broadcast), op::ParameterVector{});
+
+    // The broadcast is folded by its own matcher, but the 16KB exp stays an op
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(1024);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Exp>(f), 1);
+}
+
+TEST(constant_folding, constant_evaluate_integer_divide_by_zero)
+{
+    auto a = op::Constant::create(element::i32, Shape{2}, {4, 6});
+    auto b = op::Constant::create(element::i32, Shape{2}, {2, 0});
+    auto f = make_shared<Function>(make_shared<op::Convert>(a / b, element::f32),
+                                   op::ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(
+        vector<pass::ConstantFolding::CFTransformations>{
+            pass::ConstantFolding::CFTransformations::EVALUATE});
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Divide>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f), 1);
+}
+
+TEST(constant_folding, constant_evaluate_integer_divide_overflow)
+{
+    auto a = op::Constant::create(
+        element::i32, Shape{2}, vector<int32_t>{4, numeric_limits<int32_t>::min()});
+    auto b = op::Constant::create(element::i32, Shape{2}, {2, -1});
+    auto f = make_shared<Function>(make_shared<op::Convert>(a / b, element::f32),
+                                   op::ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(
+        vector<pass::ConstantFolding::CFTransformations>{
+            pass::ConstantFolding::CFTransformations::EVALUATE});
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Divide>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f), 1);
+}
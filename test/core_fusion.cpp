@@ -83,6 +83,30 @@ TEST(core_fusion, sigmoid_bprop_fusion)
     ASSERT_EQ(ccg, 1);
 }
 
+TEST(core_fusion, fused_op_counts)
+{
+    // Fused ops in serialized models after one CoreFusion run. Fusions cascade within the
+    // run, so a second run finds nothing left to fuse.
+    vector<tuple<string, size_t, size_t>> models{
+        make_tuple("mxnet/Graph_fprop_sigmoid.json", 0, 1),
+        make_tuple("mxnet/mnist_mlp_forward.json", 2, 0),
+        make_tuple("mxnet/LSTM_forward.json", 0, 360),
+        make_tuple("mxnet/Seq2Seq_forward.json", 0, 75),
+        make_tuple("mxnet/Sockeye_Seq2Seq_forward.json", 0, 180)};
+    for (const auto& model : models)
+    {
+        const string json_path = file_util::path_join(SERIALIZED_ZOO, get<0>(model));
+        stringstream ss(file_util::read_file_to_string(json_path));
+        shared_ptr<Function> func = ngraph::deserialize(ss);
+        pass::CoreFusion().run_on_function(func);
+        EXPECT_EQ(get<1>(model), count_ops_of_type<op::Relu>(func)) << get<0>(model);
+        EXPECT_EQ(get<2>(model), count_ops_of_type<op::Sigmoid>(func)) << get<0>(model);
+
+        size_t n_ops = func->get_ops().size();
+        EXPECT_EQ(n_ops, func->get_ops().size()) << get<0>(model);
+    }
+}
+
 TEST(core_fusion, sparsity_opt_56x56)
 {
     Shape win_size_3{1, 1, 3, 3};
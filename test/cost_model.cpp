@@ -0,0 +1,195 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include "gtest/gtest.h"
+#include "ngraph/file_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/cost_model.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(cost_model, flops_and_bytes)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto dot = make_shared<op::Dot>(A, B);
+    EXPECT_EQ(runtime::CostModel::get_flops(*dot), 2 * 8 * 3);
+    EXPECT_EQ(runtime::CostModel::get_bytes_moved(*dot), (6 + 12 + 8) * 4);
+
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, 2, 5, 5});
+    auto filters = make_shared<op::Parameter>(element::f32, Shape{3, 2, 3, 3});
+    auto conv = make_shared<op::Convolution>(data, filters);
+    EXPECT_EQ(runtime::CostModel::get_flops(*conv), 2 * 27 * 18);
+
+    auto C = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto add = make_shared<op::Add>(C, C);
+    EXPECT_EQ(runtime::CostModel::get_flops(*add), 4);
+    EXPECT_EQ(runtime::CostModel::get_bytes_moved(*add), 3 * 16);
+
+    auto reshape = make_shared<op::Reshape>(A, AxisVector{1, 0}, Shape{3, 2});
+    EXPECT_EQ(runtime::CostModel::get_flops(*reshape), 0);
+    EXPECT_EQ(runtime::CostModel::get_bytes_moved(*reshape), 2 * 24);
+
+    auto dynamic = make_shared<op::Parameter>(element::f32, PartialShape::dynamic());
+    auto dynamic_add = make_shared<op::Add>(dynamic, dynamic);
+    EXPECT_EQ(runtime::CostModel::get_bytes_moved(*dynamic_add), 0);
+}
+
+TEST(cost_model, default_coefficients)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto add = make_shared<op::Add>(A, A);
+    auto f = make_shared<Function>(add, op::ParameterVector{A});
+
+    runtime::CostModel model;
+    EXPECT_EQ(model.get_cost(*A).microseconds, 0);
+    runtime::OpCost cost = model.get_cost(*add);
+    const runtime::CostModel::Coefficients& c = model.get_coefficients("Add");
+    EXPECT_DOUBLE_EQ(cost.microseconds,
+                     c.overhead_us + cost.flops * c.us_per_flop + cost.bytes * c.us_per_byte);
+
+    model.set_coefficients("Add", {2, 0, 0});
+    EXPECT_TRUE(model.has_coefficients("Add"));
+    EXPECT_DOUBLE_EQ(model.get_cost(*add).microseconds, 2);
+    EXPECT_GE(model.get_cost(f).microseconds, 2);
+}
+
+TEST(cost_model, fit)
+{
+    runtime::CostModel model;
+
+    // Independent flops and bytes
+    vector<runtime::CostModel::Sample> samples;
+    for (double flops : {1e3, 1e5, 1e7})
+    {
+        for (size_t bytes : {1000, 100000})
+        {
+            samples.push_back({flops, bytes, 2 + flops * 1e-3 + bytes * 5e-4});
+        }
+    }
+    model.fit("Dot", samples);
+    const runtime::CostModel::Coefficients& dot = model.get_coefficients("Dot");
+    EXPECT_NEAR(dot.overhead_us, 2, 1e-3);
+    EXPECT_NEAR(dot.us_per_flop, 1e-3, 1e-8);
+    EXPECT_NEAR(dot.us_per_byte, 5e-4, 1e-8);
+
+    // Bytes proportional to flops, as for elementwise ops
+    samples.clear();
+    for (double n : {1e3, 1e4, 1e5, 1e6})
+    {
+        samples.push_back({n, size_t(12 * n), 1 + n * 1e-3});
+    }
+    model.fit("Add", samples);
+    const runtime::CostModel::Coefficients& add = model.get_coefficients("Add");
+    EXPECT_GE(add.us_per_flop, 0);
+    EXPECT_GE(add.us_per_byte, 0);
+    for (const runtime::CostModel::Sample& sample : samples)
+    {
+        double predicted =
+            add.overhead_us + sample.flops * add.us_per_flop + sample.bytes * add.us_per_byte;
+        EXPECT_NEAR(predicted / sample.microseconds, 1, 1e-3);
+    }
+
+    EXPECT_THROW(model.fit("Abs", {}), ngraph_error);
+}
+
+TEST(cost_model, save_load)
+{
+    runtime::CostModel model("TEST");
+    model.set_default_coefficients({3, 1e-5, 2e-5});
+    model.set_coefficients("Dot", {1, 2e-4, 3e-4});
+
+    string dir = file_util::get_temp_directory_path();
+    string path = file_util::path_join(dir, "TEST.json");
+    model.save(path);
+
+    auto loaded = runtime::CostModel::load(path);
+    EXPECT_EQ(loaded->get_backend_name(), "TEST");
+    EXPECT_DOUBLE_EQ(loaded->get_coefficients("Dot").us_per_flop, 2e-4);
+    EXPECT_DOUBLE_EQ(loaded->get_coefficients("Add").overhead_us, 3);
+
+    setenv("NGRAPH_COST_MODEL_DIR", dir.c_str(), 1);
+    EXPECT_TRUE(runtime::CostModel::get_default("TEST")->has_coefficients("Dot"));
+    EXPECT_FALSE(runtime::CostModel::get_default("MISSING")->has_coefficients("Dot"));
+    unsetenv("NGRAPH_COST_MODEL_DIR");
+    remove(path.c_str());
+
+    EXPECT_THROW(runtime::CostModel::load(path), ngraph_error);
+}
+
+TEST(cost_model, get_default)
+{
+    string dir = file_util::get_temp_directory_path();
+    string path = file_util::path_join(dir, "CACHED.json");
+    runtime::CostModel model("CACHED");
+    model.set_coefficients("Dot", {1, 2e-4, 3e-4});
+    model.save(path);
+    string malformed_path = file_util::path_join(dir, "MALFORMED.json");
+    {
+        ofstream out(malformed_path);
+        out << "{\"backend\": ";
+    }
+
+    setenv("NGRAPH_COST_MODEL_DIR", dir.c_str(), 1);
+    auto loaded = runtime::CostModel::get_default("CACHED");
+    EXPECT_TRUE(loaded->has_coefficients("Dot"));
+
+    // The file is not read again, and changes to a returned model stay out of the cache
+    remove(path.c_str());
+    loaded->set_coefficients("Add", {1, 0, 0});
+    auto cached = runtime::CostModel::get_default("CACHED");
+    EXPECT_TRUE(cached->has_coefficients("Dot"));
+    EXPECT_FALSE(cached->has_coefficients("Add"));
+
+    // A malformed file falls back to the default coefficients
+    shared_ptr<runtime::CostModel> fallback;
+    EXPECT_NO_THROW(fallback = runtime::CostModel::get_default("MALFORMED"));
+    ASSERT_NE(fallback, nullptr);
+    EXPECT_EQ(fallback->get_backend_name(), "MALFORMED");
+    EXPECT_FALSE(fallback->has_coefficients("Dot"));
+    unsetenv("NGRAPH_COST_MODEL_DIR");
+    remove(malformed_path.c_str());
+}
+
+TEST(cost_model, manager_state)
+{
+    pass::Manager pass_manager;
+    ASSERT_NE(pass_manager.get_state().get_cost_model(), nullptr);
+
+    auto model = make_shared<runtime::CostModel>("TEST");
+    pass_manager.get_state().set_cost_model(model);
+    EXPECT_EQ(pass_manager.get_state().get_cost_model(), model);
+}
+
+TEST(cost_model, calibrate)
+{
+    auto model = runtime::CostModel::calibrate("INTERPRETER", 1);
+    EXPECT_EQ(model->get_backend_name(), "INTERPRETER");
+    EXPECT_TRUE(model->has_coefficients("Add"));
+    EXPECT_TRUE(model->has_coefficients("Convolution"));
+
+    auto small_a = make_shared<op::Parameter>(element::f32, Shape{16, 16});
+    auto large_a = make_shared<op::Parameter>(element::f32, Shape{256, 256});
+    auto small = make_shared<op::Dot>(small_a, small_a);
+    auto large = make_shared<op::Dot>(large_a, large_a);
+    EXPECT_GT(model->get_cost(*large).microseconds, model->get_cost(*small).microseconds);
+}
@@ -45,6 +45,7 @@
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
+#include "ngraph/runtime/cost_model.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
@@ -2284,8 +2285,6 @@ TEST(DISABLED_cpu_fusion, rnn_fusion_inter_vs_cpu_2rnn_layer_3lstm_cell)
     }
 }
 
-#if 0
-
 TEST(cpu_fusion, loop_kernel_fusion_multiple_groups_pruned)
 {
     auto make_function = []() -> std::shared_ptr<Function> {
@@ -2478,7 +2477,89 @@ TEST(cpu_fusion, loop_kernel_fusion_one_group)
     }
 }
 
-#endif
+TEST(cpu_fusion, loop_kernel_fusion_broadcast_multiple_outputs)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        Shape shape{4, 3, 5};
+        auto a = make_shared<op::Parameter>(element::f32, shape);
+        auto b = make_shared<op::Parameter>(element::f32, shape);
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{3});
+        auto scale = make_shared<op::Parameter>(element::f32, Shape{});
+        auto bias_bcast = make_shared<op::Broadcast>(bias, shape, AxisSet{0, 2});
+        auto scale_bcast = make_shared<op::Broadcast>(scale, shape, AxisSet{0, 1, 2});
+        auto mul_ab = a * b;
+        auto add_bias = mul_ab + bias_bcast;
+        auto tanh = make_shared<op::Tanh>(add_bias);
+        auto sigmoid = make_shared<op::Sigmoid>(add_bias);
+        auto scaled = scale_bcast * tanh;
+        auto exp = make_shared<op::Exp>(make_shared<op::Negative>(sigmoid));
+        auto div = scaled / exp;
+        auto f = make_shared<Function>(NodeVector{div, sigmoid},
+                                       op::ParameterVector{a, b, bias, scale});
+        return f;
+    };
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>(2);
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    pass_manager.run_passes(cpu_f);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+
+    size_t lkn = count_ops_of_type<runtime::cpu::op::LoopKernel>(cpu_f);
+    ASSERT_EQ(lkn, 1);
+
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_fusion, loop_kernel_fusion_default_pipeline)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        Shape shape{8, 16, 3};
+        auto a = make_shared<op::Parameter>(element::f32, shape);
+        auto b = make_shared<op::Parameter>(element::f32, shape);
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{16});
+        auto bias_bcast = make_shared<op::Broadcast>(bias, shape, AxisSet{0, 2});
+        auto add_bias = a * b + bias_bcast;
+        auto tanh = make_shared<op::Tanh>(add_bias);
+        auto exp = make_shared<op::Exp>(make_shared<op::Negative>(tanh));
+        auto f = make_shared<Function>(NodeVector{exp / (a + b)},
+                                       op::ParameterVector{a, b, bias});
+        return f;
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(1.0f, 2.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    // No explicit pass: the CPU backend's own pipeline must fuse the kernel
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    ASSERT_GT(count_ops_of_type<runtime::cpu::op::LoopKernel>(cpu_f), 0);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
 
 TEST(cpu_fusion, sigmoid_multiply_fusion)
 {
@@ -3130,3 +3211,31 @@ TEST(cpu_fusion, rnn_input_fusion_inter_vs_cpu)
         EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
     }
 }
+
+TEST(cpu_fusion, fused_op_flops)
+{
+    // Fused convolutions and matrix products do the arithmetic of the ops they replace
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8, 8});
+    auto filters = make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+    auto bias = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto conv = make_shared<op::Convolution>(data, filters);
+    auto conv_bias = make_shared<op::ConvolutionBias>(data,
+                                                      filters,
+                                                      bias,
+                                                      conv->get_window_movement_strides(),
+                                                      conv->get_window_dilation_strides(),
+                                                      conv->get_padding_below(),
+                                                      conv->get_padding_above(),
+                                                      conv->get_data_dilation_strides());
+    EXPECT_GT(runtime::CostModel::get_flops(*conv), 0);
+    EXPECT_EQ(runtime::CostModel::get_flops(*conv), runtime::CostModel::get_flops(*conv_bias));
+
+    auto W = make_shared<op::Parameter>(element::f32, Shape{5, 6});
+    auto x = make_shared<op::Parameter>(element::f32, Shape{7, 6});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{5, 7});
+    auto dot = make_shared<op::Dot>(W, make_shared<op::Reshape>(x, AxisVector{1, 0}, Shape{6, 7}));
+    auto matmul_bias =
+        make_shared<op::MatmulBias>(W, x, b, W->get_shape(), x->get_shape(), false, true);
+    EXPECT_DOUBLE_EQ(runtime::CostModel::get_flops(*dot),
+                     runtime::CostModel::get_flops(*matmul_bias));
+}
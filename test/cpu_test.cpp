@@ -16,12 +16,18 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <fstream>
+#include <future>
 #include <iostream>
 #include <list>
 #include <memory>
+#include <numeric>
+#include <set>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "ngraph/autodiff/adjoints.hpp"
+#include "ngraph/codegen/compiler.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -31,6 +37,11 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/cpu_shared_arena.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -140,6 +151,77 @@ TEST(cpu_test, abc_tbb)
 }
 #endif // NGRAPH_TBB_ENABLE
 
+#if !defined(NGRAPH_DEX_ONLY)
+TEST(cpu_test, codegen_cache)
+{
+    string cache_dir =
+        file_util::path_join(file_util::get_temp_directory_path(), "ngraph_codegen_cache_test");
+    file_util::remove_directory(cache_dir);
+    bool use_codegen = (getenv("NGRAPH_CODEGEN") != nullptr);
+    if (!use_codegen)
+    {
+        setenv("NGRAPH_CODEGEN", "1", 1);
+    }
+    setenv("NGRAPH_CODEGEN_CACHE_DIR", cache_dir.c_str(), 1);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto K = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>(A * K, op::ParameterVector{A});
+
+    // The second backend compiles the same source and reuses the first one's entry
+    // instead of running clang
+    for (int i = 0; i < 2; i++)
+    {
+        size_t compile_count = codegen::Compiler::get_compile_count();
+        auto backend = runtime::Backend::create("CPU");
+        auto a = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{2, 2, 2, 2});
+        backend->call_with_validate(f, {result}, {a});
+        EXPECT_EQ((vector<float>{2, 4, 6, 8}), read_vector<float>(result));
+
+        // Source, bitcode and object code
+        size_t num_files = 0;
+        file_util::iterate_files(cache_dir, [&](const string& file, bool is_dir) {
+            if (!is_dir)
+            {
+                num_files++;
+            }
+        });
+        EXPECT_EQ(3u, num_files);
+        EXPECT_EQ(i == 0 ? 1u : 0u, codegen::Compiler::get_compile_count() - compile_count);
+    }
+
+    // Object code stored for another source is not loaded; the bitcode is still reused
+    file_util::iterate_files(cache_dir, [&](const string& file, bool is_dir) {
+        if (!is_dir && file.substr(file.size() - 2) == ".o")
+        {
+            ofstream out(file, ios::binary);
+            out << "0000000000000000\n"
+                << "not object code";
+        }
+    });
+    {
+        size_t compile_count = codegen::Compiler::get_compile_count();
+        auto backend = runtime::Backend::create("CPU");
+        auto a = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{2, 2, 2, 2});
+        backend->call_with_validate(f, {result}, {a});
+        EXPECT_EQ((vector<float>{2, 4, 6, 8}), read_vector<float>(result));
+        EXPECT_EQ(0u, codegen::Compiler::get_compile_count() - compile_count);
+    }
+
+    unsetenv("NGRAPH_CODEGEN_CACHE_DIR");
+    if (!use_codegen)
+    {
+        unsetenv("NGRAPH_CODEGEN");
+    }
+    file_util::remove_directory(cache_dir);
+}
+#endif
+
 TEST(cpu_test, mkldnn_layouts)
 {
     Shape shape_a{1, 16, 2, 2};
@@ -578,3 +660,423 @@ TEST(cpu_test, convert_layout)
         EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
     }
 }
+
+TEST(cpu_test, concurrent_calls)
+{
+    Shape shape{2, 64};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto relu = make_shared<op::Relu>((A + B) * C);
+    auto f = make_shared<Function>(relu - A, op::ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    backend->compile(f);
+
+    const size_t num_threads = 4;
+    const size_t num_iterations = 50;
+    vector<int> passed(num_threads, 1);
+    vector<thread> threads;
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            auto c = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+            for (size_t i = 0; i < num_iterations; i++)
+            {
+                float value = static_cast<float>(t * num_iterations + i);
+                copy_data(a, vector<float>(shape_size(shape), value));
+                copy_data(b, vector<float>(shape_size(shape), 1.0f));
+                copy_data(c, vector<float>(shape_size(shape), 2.0f));
+                backend->call_with_validate(f, {result}, {a, b, c});
+                if (read_vector<float>(result) != vector<float>(shape_size(shape), value + 2.0f))
+                {
+                    passed[t] = 0;
+                }
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        EXPECT_TRUE(passed[t]);
+    }
+}
+
+TEST(cpu_test, concurrent_mkldnn_calls)
+{
+    Shape shape_a{1, 2, 5, 5};
+    Shape shape_b{2, 2, 1, 1};
+    Shape shape_r{1, 2, 5, 5};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto conv = make_shared<op::Convolution>(A, B);
+    auto f = make_shared<Function>(make_shared<op::Relu>(conv), op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    backend->enable_performance_data(f, true);
+    backend->compile(f);
+
+    // Every thread runs the convolution on its own copy of the MKLDNN primitives
+    const size_t num_threads = 4;
+    const size_t num_iterations = 20;
+    vector<int> passed(num_threads, 1);
+    vector<thread> threads;
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            auto a = backend->create_tensor(element::f32, shape_a);
+            auto b = backend->create_tensor(element::f32, shape_b);
+            auto result = backend->create_tensor(element::f32, shape_r);
+            // Identity weights
+            copy_data(b, vector<float>{1, 0, 0, 1});
+            for (size_t i = 0; i < num_iterations; i++)
+            {
+                float value = static_cast<float>(t * num_iterations + i);
+                copy_data(a, vector<float>(shape_size(shape_a), value));
+                backend->call_with_validate(f, {result}, {a, b});
+                if (read_vector<float>(result) != vector<float>(shape_size(shape_r), value))
+                {
+                    passed[t] = 0;
+                }
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        EXPECT_TRUE(passed[t]);
+    }
+
+    // Counters are updated by all call frames without losing calls
+    auto counters = backend->get_performance_data(f);
+    ASSERT_FALSE(counters.empty());
+    for (const auto& counter : counters)
+    {
+        EXPECT_EQ(counter.call_count(), num_threads * num_iterations) << counter.name();
+    }
+}
+
+TEST(cpu_test, executor_streams_partition_cores)
+{
+    runtime::cpu::executor::CPUExecutor cpu_executor(2, true);
+    ASSERT_GE(cpu_executor.get_num_thread_pools(), 1);
+
+    set<int> cores;
+    size_t num_cores = 0;
+    for (int arena = 0; arena < cpu_executor.get_num_thread_pools(); arena++)
+    {
+        const auto& stream_cores = cpu_executor.get_cores(arena);
+        EXPECT_FALSE(stream_cores.empty());
+        cores.insert(stream_cores.begin(), stream_cores.end());
+        num_cores += stream_cores.size();
+    }
+    // Streams never share a core
+    EXPECT_EQ(cores.size(), num_cores);
+
+    // Calls from threads outside the executor are spread over the streams
+    set<int> arenas;
+    for (int i = 0; i < cpu_executor.get_num_thread_pools(); i++)
+    {
+        arenas.insert(cpu_executor.select_arena());
+    }
+    EXPECT_EQ(arenas.size(), static_cast<size_t>(cpu_executor.get_num_thread_pools()));
+
+    // MKL kernels called on a stream thread use no more threads than the stream has cores
+    for (int arena = 0; arena < cpu_executor.get_num_thread_pools(); arena++)
+    {
+        promise<int> max_threads;
+        cpu_executor.schedule(
+            [&max_threads]() { max_threads.set_value(mkl::MKL_Get_Max_Threads()); }, arena);
+        EXPECT_EQ(static_cast<int>(cpu_executor.get_cores(arena).size()),
+                  max_threads.get_future().get());
+    }
+}
+
+TEST(cpu_test, executor_numa_first_touch)
+{
+    runtime::cpu::executor::CPUExecutor cpu_executor(2, true, true);
+    for (int arena = 0; arena < cpu_executor.get_num_thread_pools(); arena++)
+    {
+        EXPECT_GE(cpu_executor.get_numa_node(arena), 0);
+    }
+
+    vector<char> src(1 << 20);
+    for (size_t i = 0; i < src.size(); i++)
+    {
+        src[i] = static_cast<char>(i);
+    }
+    vector<char> dst(src.size(), 1);
+    cpu_executor.first_touch(dst.data(), src.data(), dst.size(), 0);
+    EXPECT_EQ(src, dst);
+    cpu_executor.first_touch(dst.data(), nullptr, dst.size(), 0);
+    EXPECT_EQ(vector<char>(dst.size(), 0), dst);
+
+    // Buffers placed by first touch are never handed out again from a pool, even when
+    // the default allocator pools
+    auto previous = runtime::Allocator::get_default();
+    runtime::Allocator::set_default(make_shared<runtime::Allocator>(false, 1 << 30));
+    auto allocator = cpu_executor.get_allocator();
+    EXPECT_NE(allocator, runtime::Allocator::get_default());
+    {
+        runtime::AlignedBuffer buffer(1 << 20, 64, allocator);
+    }
+    EXPECT_EQ(0u, allocator->get_statistics().bytes_pooled);
+    runtime::Allocator::set_default(previous);
+}
+
+TEST(cpu_test, executor_run_parallel)
+{
+    setenv("NGRAPH_CPU_WAVEFRONT_WIDTH", "3", 1);
+    runtime::cpu::executor::CPUExecutor cpu_executor(1);
+    unsetenv("NGRAPH_CPU_WAVEFRONT_WIDTH");
+    ASSERT_EQ(cpu_executor.get_wavefront_width(), 3);
+
+    vector<int> groups(3, 0);
+    cpu_executor.run_parallel(groups.size(), [&](size_t group) { groups[group] = 1; }, 0);
+    EXPECT_EQ(vector<int>(groups.size(), 1), groups);
+
+    // The first failing group's exception reaches the caller once all groups finish
+    EXPECT_THROW(cpu_executor.run_parallel(groups.size(),
+                                           [&](size_t group) {
+                                               if (group == 2)
+                                               {
+                                                   throw ngraph_error("group failed");
+                                               }
+                                               groups[group] = 2;
+                                           },
+                                           0),
+                 ngraph_error);
+    EXPECT_EQ(2, groups[0]);
+    EXPECT_EQ(2, groups[1]);
+}
+
+TEST(cpu_test, dynamic_batch)
+{
+    PartialShape shape{Dimension::dynamic(), 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * A, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    backend->compile(f);
+
+    // Batch sizes seen before reuse their compiled specialization
+    for (size_t batch : {1, 3, 1, 3})
+    {
+        Shape batch_shape{batch, 2};
+        auto a = backend->create_tensor(element::f32, batch_shape);
+        auto b = backend->create_tensor(element::f32, batch_shape);
+        auto result = backend->create_tensor(element::f32, batch_shape);
+        copy_data(a, vector<float>(shape_size(batch_shape), 2));
+        copy_data(b, vector<float>(shape_size(batch_shape), 3));
+        backend->call_with_validate(f, {result}, {a, b});
+        EXPECT_EQ(vector<float>(shape_size(batch_shape), 10), read_vector<float>(result));
+    }
+
+    auto a = backend->create_tensor(element::f32, Shape{2, 3});
+    auto result = backend->create_tensor(element::f32, Shape{2, 3});
+    EXPECT_ANY_THROW(backend->call_with_validate(f, {result}, {a, a}));
+}
+
+TEST(cpu_test, dynamic_batch_bucketing)
+{
+    PartialShape shape{Dimension::dynamic(), 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * A, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    cpu_backend->set_shape_bucketing(true);
+    // Only one specialization is kept, so alternating buckets evict each other
+    cpu_backend->set_max_specializations(1);
+    backend->compile(f);
+
+    for (size_t batch : {3, 4, 5, 1, 3})
+    {
+        Shape batch_shape{batch, 2};
+        auto a = backend->create_tensor(element::f32, batch_shape);
+        auto b = backend->create_tensor(element::f32, batch_shape);
+        auto result = backend->create_tensor(element::f32, batch_shape);
+        vector<float> a_data(shape_size(batch_shape));
+        iota(a_data.begin(), a_data.end(), 1);
+        copy_data(a, a_data);
+        copy_data(b, vector<float>(shape_size(batch_shape), 3));
+        backend->call_with_validate(f, {result}, {a, b});
+        vector<float> expected;
+        for (float x : a_data)
+        {
+            expected.push_back((x + 3) * x);
+        }
+        EXPECT_EQ(expected, read_vector<float>(result));
+    }
+}
+
+TEST(cpu_test, dynamic_batch_compile_count)
+{
+    PartialShape shape{Dimension::dynamic(), 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * A, op::ParameterVector{A, B});
+    // Sums over the batch, so it cannot be padded and is compiled per batch size
+    auto g = make_shared<Function>(make_shared<op::Sum>(A * B, AxisSet{0}),
+                                   op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    backend->compile(f);
+    backend->compile(g);
+
+    auto call = [&](shared_ptr<Function> func, size_t batch) {
+        Shape batch_shape{batch, 2};
+        auto a = backend->create_tensor(element::f32, batch_shape);
+        auto b = backend->create_tensor(element::f32, batch_shape);
+        copy_data(a, vector<float>(shape_size(batch_shape), 2));
+        copy_data(b, vector<float>(shape_size(batch_shape), 3));
+        Shape result_shape = func == f ? batch_shape : Shape{2};
+        auto result = backend->create_tensor(element::f32, result_shape);
+        backend->call_with_validate(func, {result}, {a, b});
+        return read_vector<float>(result);
+    };
+
+    // Batches 1 to 32 share the specializations for 1, 2, 4, 8, 16 and 32, which all
+    // fit in the default specialization limit, so no batch size compiles again
+    size_t compile_count = cpu_backend->get_compile_count();
+    for (size_t pass = 0; pass < 2; pass++)
+    {
+        for (size_t batch = 1; batch <= 32; batch++)
+        {
+            EXPECT_EQ(vector<float>(batch * 2, 10), call(f, batch));
+        }
+        EXPECT_EQ(6u, cpu_backend->get_compile_count() - compile_count);
+    }
+
+    compile_count = cpu_backend->get_compile_count();
+    EXPECT_EQ(vector<float>(2, 18), call(g, 3));
+    EXPECT_EQ(vector<float>(2, 24), call(g, 4));
+    EXPECT_EQ(2u, cpu_backend->get_compile_count() - compile_count);
+}
+
+TEST(cpu_test, shared_arena)
+{
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    cpu_backend->set_shared_arena(true);
+
+    vector<Shape> shapes{Shape{2, 2}, Shape{16, 16}};
+    vector<shared_ptr<Function>> functions;
+    vector<shared_ptr<runtime::Tensor>> as, bs, results;
+    for (const auto& shape : shapes)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        functions.push_back(make_shared<Function>((A + B) * (A - B), op::ParameterVector{A, B}));
+        backend->compile(functions.back());
+        as.push_back(backend->create_tensor(element::f32, shape));
+        bs.push_back(backend->create_tensor(element::f32, shape));
+        results.push_back(backend->create_tensor(element::f32, shape));
+    }
+
+    for (float value : {3.0f, 5.0f})
+    {
+        for (size_t i = 0; i < functions.size(); i++)
+        {
+            copy_data(as[i], vector<float>(shape_size(shapes[i]), value));
+            copy_data(bs[i], vector<float>(shape_size(shapes[i]), 2.0f));
+            backend->call_with_validate(functions[i], {results[i]}, {as[i], bs[i]});
+            EXPECT_EQ(vector<float>(shape_size(shapes[i]), value * value - 4),
+                      read_vector<float>(results[i]));
+        }
+    }
+
+    // Intermediates the other function overwrote are recomputed even if the inputs did not
+    // change
+    as[0]->set_stale(false);
+    bs[0]->set_stale(false);
+    backend->call_with_validate(functions[0], {results[0]}, {as[0], bs[0]});
+    EXPECT_EQ(vector<float>(shape_size(shapes[0]), 21), read_vector<float>(results[0]));
+
+    // The pools are sized to the larger function rather than to both
+    size_t pool_size = functions[1]->get_temporary_pool_size();
+    size_t num_streams = runtime::cpu::executor::GetCPUExecutor().get_num_thread_pools();
+    auto allocated_size = cpu_backend->get_shared_arena()->get_allocated_size();
+    EXPECT_GE(allocated_size, pool_size);
+    EXPECT_LE(allocated_size, pool_size * num_streams);
+}
+
+TEST(cpu_test, shared_arena_concurrent_calls)
+{
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    cpu_backend->set_shared_arena(true);
+
+    Shape shape{16, 16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * (A - B), op::ParameterVector{A, B});
+    backend->compile(f);
+
+    // Calls in flight together take separate sets of pools
+    vector<shared_ptr<runtime::Tensor>> as, results;
+    vector<future<bool>> futures;
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>(shape_size(shape), 2.0f));
+    for (size_t i = 0; i < 8; i++)
+    {
+        as.push_back(backend->create_tensor(element::f32, shape));
+        copy_data(as.back(), vector<float>(shape_size(shape), float(i)));
+        results.push_back(backend->create_tensor(element::f32, shape));
+        futures.push_back(backend->call_async(f, {results.back()}, {as.back(), b}));
+    }
+    for (size_t i = 0; i < futures.size(); i++)
+    {
+        EXPECT_TRUE(futures[i].get());
+        EXPECT_EQ(vector<float>(shape_size(shape), float(i * i) - 4),
+                  read_vector<float>(results[i]));
+    }
+
+    size_t pool_size = f->get_temporary_pool_size();
+    auto allocated_size = cpu_backend->get_shared_arena()->get_allocated_size();
+    EXPECT_GE(allocated_size, pool_size);
+    EXPECT_LE(allocated_size, pool_size * futures.size());
+}
+
+TEST(cpu_test, memory_usage)
+{
+    Shape shape{4, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, vector<float>(16, 2));
+    auto f = make_shared<Function>((A + B) * C, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    backend->compile(f);
+    runtime::MemoryUsage usage = backend->get_memory_usage(f);
+    EXPECT_GT(usage.temporary_pool_size, 0);
+    EXPECT_EQ(64, usage.constant_bytes);
+    EXPECT_FALSE(usage.tensors.empty());
+    EXPECT_EQ(0, usage.peak_rss_delta);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(16, 1));
+    copy_data(b, vector<float>(16, 2));
+    backend->call_with_validate(f, {result}, {a, b});
+    EXPECT_EQ(vector<float>(16, 6), read_vector<float>(result));
+    EXPECT_EQ(usage.get_total_bytes(), backend->get_memory_usage(f).get_total_bytes());
+
+    // Each bound call holds a call frame, and the second one has pools of its own
+    auto bound = backend->bind(f, {result}, {a, b});
+    auto other_bound = backend->bind(f, {result}, {a, b});
+    EXPECT_EQ(2 * usage.temporary_pool_size, backend->get_memory_usage(f).temporary_pool_size);
+}
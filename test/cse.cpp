@@ -24,9 +24,15 @@
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/lrn.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
@@ -307,3 +313,118 @@ TEST(CSE, constant)
     ASSERT_NE(abs0->get_argument(0), absf->get_argument(0));
     ASSERT_NE(abs111->get_argument(0), abs112->get_argument(0));
 }
+
+TEST(CSE, subtract_not_commutative)
+{
+    Shape shape{2};
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto B = std::make_shared<op::Parameter>(element::f32, shape);
+    auto sub1 = std::make_shared<op::Subtract>(A, B);
+    auto sub2 = std::make_shared<op::Subtract>(B, A);
+    auto sub3 = std::make_shared<op::Subtract>(A, B);
+    auto f = std::make_shared<Function>(NodeVector{sub1, sub2, sub3}, op::ParameterVector{A, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(2)->get_argument(0));
+}
+
+TEST(CSE, slice_attributes)
+{
+    Shape shape{4, 4};
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto slice1 = std::make_shared<op::Slice>(A, Coordinate{0, 0}, Coordinate{2, 4});
+    auto slice2 = std::make_shared<op::Slice>(A, Coordinate{0, 0}, Coordinate{2, 4});
+    auto slice3 = std::make_shared<op::Slice>(A, Coordinate{2, 0}, Coordinate{4, 4});
+    auto slice4 = std::make_shared<op::Slice>(A, Coordinate{0, 0}, Coordinate{2, 4}, Strides{1, 2});
+    auto f = std::make_shared<Function>(NodeVector{slice1, slice2, slice3, slice4},
+                                        op::ParameterVector{A});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(2)->get_argument(0));
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(3)->get_argument(0));
+}
+
+TEST(CSE, reshape_attributes)
+{
+    Shape shape{2, 3};
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto reshape1 = std::make_shared<op::Reshape>(A, AxisVector{0, 1}, Shape{6});
+    auto reshape2 = std::make_shared<op::Reshape>(A, AxisVector{1, 0}, Shape{6});
+    auto reshape3 = std::make_shared<op::Reshape>(A, AxisVector{0, 1}, Shape{6});
+    auto f = std::make_shared<Function>(NodeVector{reshape1, reshape2, reshape3},
+                                        op::ParameterVector{A});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(2)->get_argument(0));
+}
+
+TEST(CSE, convolution_dot)
+{
+    auto data = std::make_shared<op::Parameter>(element::f32, Shape{1, 2, 5, 5});
+    auto filters = std::make_shared<op::Parameter>(element::f32, Shape{3, 2, 3, 3});
+    auto conv1 = std::make_shared<op::Convolution>(data, filters);
+    auto conv2 = std::make_shared<op::Convolution>(data, filters);
+    auto conv3 = std::make_shared<op::Convolution>(data, filters, Strides{2, 2});
+
+    auto A = std::make_shared<op::Parameter>(element::f32, Shape{4, 4});
+    auto dot1 = std::make_shared<op::Dot>(A, A);
+    auto dot2 = std::make_shared<op::Dot>(A, A);
+    auto dot3 = std::make_shared<op::Dot>(A, A, 0);
+
+    auto f = std::make_shared<Function>(NodeVector{conv1, conv2, conv3, dot1, dot2, dot3},
+                                        op::ParameterVector{data, filters, A});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(2)->get_argument(0));
+    ASSERT_EQ(f->get_results().at(3)->get_argument(0), f->get_results().at(4)->get_argument(0));
+    ASSERT_NE(f->get_results().at(3)->get_argument(0), f->get_results().at(5)->get_argument(0));
+}
+
+TEST(CSE, elementwise_attributes)
+{
+    // Elementwise ops only match when their own attributes do
+    auto A = make_shared<op::Parameter>(element::f32, Shape{1, 3, 2, 2});
+    auto abs1 = make_shared<op::Abs>(A);
+    auto abs2 = make_shared<op::Abs>(A);
+    ASSERT_TRUE(abs1->is_structurally_equal(*abs2));
+    auto lrn1 = make_shared<op::LRN>(A, 1.0, 0.75, 1.0, 3);
+    auto lrn2 = make_shared<op::LRN>(A, 1.0, 0.75, 1.0, 3);
+    auto lrn3 = make_shared<op::LRN>(A, 2.0, 0.75, 1.0, 3);
+    ASSERT_TRUE(lrn1->is_structurally_equal(*lrn2));
+    ASSERT_FALSE(lrn1->is_structurally_equal(*lrn3));
+    auto softmax1 = make_shared<op::Softmax>(A, AxisSet{1});
+    auto softmax2 = make_shared<op::Softmax>(A, AxisSet{2});
+    ASSERT_FALSE(softmax1->is_structurally_equal(*softmax2));
+}
+
+TEST(CSE, constant_contents)
+{
+    auto c1 = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto c2 = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto c3 = op::Constant::create(element::f32, Shape{4}, {1, 2, 3, 4});
+    auto c4 = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 5});
+    ASSERT_TRUE(c1->is_structurally_equal(*c2));
+    ASSERT_EQ(c1->get_structural_hash(), c2->get_structural_hash());
+    ASSERT_FALSE(c1->is_structurally_equal(*c3));
+    ASSERT_FALSE(c1->is_structurally_equal(*c4));
+
+    auto f = std::make_shared<Function>(NodeVector{c1, c2, c3, c4}, op::ParameterVector{});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(3)->get_argument(0));
+}
@@ -95,3 +95,16 @@ TEST(file_util, get_temp_directory_path)
     string tmp = file_util::get_temp_directory_path();
     EXPECT_NE(0, tmp.size());
 }
+
+TEST(file_util, tmp_filename_beside)
+{
+    string file = file_util::path_join(file_util::get_temp_directory_path(), "ngraph_entry.o");
+    string tmp1 = file_util::tmp_filename_beside(file);
+    string tmp2 = file_util::tmp_filename_beside(file);
+    EXPECT_NE(tmp1, tmp2);
+    EXPECT_EQ(file_util::get_directory(file), file_util::get_directory(tmp1));
+    EXPECT_TRUE(file_util::exists(tmp1));
+    EXPECT_TRUE(file_util::exists(tmp2));
+    file_util::remove_file(tmp1);
+    file_util::remove_file(tmp2);
+}
@@ -15,14 +15,18 @@
 //*****************************************************************************
 
 #include <memory>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/cse.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "util/test_tools.hpp"
 
@@ -59,3 +63,103 @@ TEST(pass_manager, module_add_function)
                                        make_shared<op::FunctionCall>(f, NodeVector{X, Y, Z}),
                                    op::ParameterVector{X, Y, Z});
 }
+
+TEST(pass_manager, parallel_function_passes)
+{
+    Shape shape{2, 2};
+    vector<shared_ptr<Function>> models;
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>((A + B) * (A + B), op::ParameterVector{A, B});
+
+        auto X = make_shared<op::Parameter>(element::f32, shape);
+        auto Y = make_shared<op::Parameter>(element::f32, shape);
+        auto call = make_shared<op::FunctionCall>(f, NodeVector{X, Y});
+        models.push_back(
+            make_shared<Function>((X - Y) * (X - Y) + call, op::ParameterVector{X, Y}));
+    }
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+    pass_manager.set_function_pass_threads(4);
+    pass_manager.run_passes(models);
+
+    EXPECT_EQ(pass_manager.get_state().get_functions().size(), 16);
+    for (auto f : pass_manager.get_state().get_functions())
+    {
+        for (auto node : f->get_ops())
+        {
+            if (auto multiply = dynamic_pointer_cast<op::Multiply>(node))
+            {
+                EXPECT_EQ(multiply->get_argument(0), multiply->get_argument(1));
+            }
+        }
+    }
+}
+
+TEST(pass_manager, inputs_version_tracks_replacement)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto B = make_shared<op::Parameter>(element::i32, Shape{3});
+    auto neg = make_shared<op::Negative>(A);
+    auto abs = make_shared<op::Abs>(neg);
+    auto f = make_shared<Function>(abs, op::ParameterVector{A, B});
+
+    // Only nodes whose inputs were replaced after a pass started need revalidation
+    size_t version = Node::get_graph_version();
+    EXPECT_LE(neg->get_inputs_version(), version);
+    neg->get_inputs().at(0).replace_output(B, 0);
+    EXPECT_GT(neg->get_inputs_version(), version);
+    EXPECT_LE(abs->get_inputs_version(), version);
+    f->validate_nodes_and_infer_types(version);
+    EXPECT_EQ(neg->get_argument(0), B);
+
+    // The new type is inferred for the replaced node and those downstream of it
+    EXPECT_EQ(neg->get_element_type(), element::i32);
+    EXPECT_EQ(neg->get_shape(), Shape{3});
+    EXPECT_EQ(abs->get_element_type(), element::i32);
+    EXPECT_EQ(abs->get_shape(), Shape{3});
+    EXPECT_EQ(f->get_output_shape(0), Shape{3});
+}
+
+namespace
+{
+    class RecordThreads : public pass::FunctionPass
+    {
+    public:
+        bool run_on_function(shared_ptr<Function> f) override
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_threads.insert(this_thread::get_id());
+            return false;
+        }
+        bool is_function_parallel() const override { return true; }
+        static mutex m_mutex;
+        static set<thread::id> m_threads;
+    };
+
+    mutex RecordThreads::m_mutex;
+    set<thread::id> RecordThreads::m_threads;
+}
+
+TEST(pass_manager, functions_sharing_nodes_run_serially)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto shared = make_shared<op::Negative>(A);
+    vector<shared_ptr<Function>> models;
+    for (size_t i = 0; i < 8; i++)
+    {
+        models.push_back(make_shared<Function>(make_shared<op::Abs>(shared),
+                                               op::ParameterVector{A}));
+    }
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<RecordThreads>();
+    pass_manager.set_function_pass_threads(4);
+    RecordThreads::m_threads.clear();
+    pass_manager.run_passes(models);
+    EXPECT_EQ(RecordThreads::m_threads, set<thread::id>{this_thread::get_id()});
+}
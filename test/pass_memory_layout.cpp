@@ -14,7 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cmath>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -23,11 +25,15 @@
 
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/dump_sorted.hpp"
+#include "ngraph/pass/buffer_aliasing.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
+#include "ngraph/pass/rematerialization.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -236,3 +242,381 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_packer, overlapping_lifetimes)
+{
+    pass::MemoryPacker packer;
+    size_t a = packer.add_buffer(4, 0);
+    size_t b = packer.add_buffer(8, 0);
+    packer.extend_buffer(b, 1);
+    size_t c = packer.add_buffer(8, 1);
+    packer.pack();
+
+    // First fit in order would place c above a and b, for a pool of 20
+    EXPECT_EQ(16, packer.get_lower_bound());
+    EXPECT_EQ(16, packer.max_allocated());
+    EXPECT_EQ(0, packer.get_offset(b));
+    EXPECT_EQ(8, packer.get_offset(c));
+    EXPECT_EQ(8, packer.get_offset(a));
+}
+
+TEST(memory_packer, disjoint_lifetimes_share)
+{
+    pass::MemoryPacker packer{64};
+    for (size_t step = 0; step < 4; step++)
+    {
+        packer.add_buffer(100, step);
+    }
+    packer.pack();
+    EXPECT_EQ(128, packer.get_lower_bound());
+    EXPECT_EQ(128, packer.max_allocated());
+}
+
+TEST(memory_layout, offline_packing)
+{
+    auto f = make_test_graph();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(1, false, true);
+    pass_manager.run_passes(f);
+    size_t packed_pool_size = f->get_temporary_pool_size();
+
+    pass::Liveness().run_on_function(f);
+    pass::MemoryLayout first_fit;
+    first_fit.run_on_function(f);
+    EXPECT_LE(first_fit.get_lower_bound(), packed_pool_size);
+    EXPECT_LE(packed_pool_size, f->get_temporary_pool_size());
+}
+
+TEST(memory_layout, nested_function_pools)
+{
+    Shape shape{100};
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto Y = make_shared<op::Parameter>(element::f32, shape);
+    auto g = make_shared<Function>((X + Y) * (X - Y), op::ParameterVector{X, Y});
+
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto t = A * B;
+    auto call = make_shared<op::FunctionCall>(g, NodeVector{t, B});
+    auto f = make_shared<Function>(call + t, op::ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(64, false, false, true);
+    pass_manager.run_passes(f);
+
+    // The called function's pool must not overlap the tensors live during the call
+    size_t nested_size = g->get_temporary_pool_size();
+    size_t nested_offset = call->get_nested_pool_offset();
+    EXPECT_GT(nested_size, 0);
+    for (descriptor::Tensor* tensor : {&t->get_output_tensor(), &call->get_output_tensor()})
+    {
+        size_t offset = tensor->get_pool_offset();
+        EXPECT_TRUE(offset + tensor->size() <= nested_offset ||
+                    nested_offset + nested_size <= offset);
+    }
+    EXPECT_GE(f->get_temporary_pool_size(), nested_offset + nested_size);
+
+    // Tensors created after the call reuse the memory lent to it
+    size_t nested_pool_size = f->get_temporary_pool_size();
+    pass::MemoryLayout(64).run_on_function(f);
+    EXPECT_GT(nested_pool_size, f->get_temporary_pool_size());
+    EXPECT_LT(nested_pool_size, f->get_temporary_pool_size() + nested_size);
+}
+
+// Branches that each reduce a large temporary to a scalar. The default topological order
+// computes every large temporary before reducing any of them.
+static shared_ptr<Function> make_reduction_branches(size_t n_branches)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{1000});
+    shared_ptr<Node> sum;
+    for (size_t i = 0; i < n_branches; i++)
+    {
+        auto branch = make_shared<op::Sum>(make_shared<op::Negative>(A), AxisSet{0});
+        if (sum)
+        {
+            sum = make_shared<op::Add>(sum, branch);
+        }
+        else
+        {
+            sum = branch;
+        }
+    }
+    return make_shared<Function>(sum, op::ParameterVector{A});
+}
+
+TEST(memory_schedule, reduces_pool_size)
+{
+    auto f = make_reduction_branches(8);
+    auto original_ops = f->get_ordered_ops();
+
+    pass::MemorySchedule schedule;
+    schedule.run_on_function(f);
+
+    EXPECT_GE(schedule.get_original_peak_bytes(), 8 * 4000);
+    EXPECT_LT(schedule.get_scheduled_peak_bytes(), 2 * 4000);
+    EXPECT_GE(schedule.get_original_pool_size(), 8 * 4000);
+    EXPECT_LT(schedule.get_pool_size(), 2 * 4000);
+    EXPECT_GE(schedule.get_pool_size(), schedule.get_scheduled_peak_bytes());
+    EXPECT_EQ(schedule.get_pool_size(), f->get_temporary_pool_size());
+
+    // The schedule is a different order of the same ops
+    auto scheduled_ops = f->get_ordered_ops();
+    EXPECT_NE(original_ops, scheduled_ops);
+    ASSERT_EQ(original_ops.size(), scheduled_ops.size());
+    EXPECT_TRUE(is_permutation(original_ops.begin(), original_ops.end(), scheduled_ops.begin()));
+}
+
+TEST(memory_schedule, independent_of_original_order)
+{
+    // Any topological order of the same graph gives the same schedule
+    auto f = make_reduction_branches(8);
+    pass::MemorySchedule schedule;
+    schedule.run_on_function(f);
+    auto scheduled_ops = f->get_ordered_ops();
+    size_t pool_size = schedule.get_pool_size();
+
+    // Run the branches last one first, then the adds
+    list<shared_ptr<Node>> reordered{f->get_parameters().at(0)};
+    list<shared_ptr<Node>> adds;
+    for (auto node : scheduled_ops)
+    {
+        if (dynamic_pointer_cast<op::Sum>(node))
+        {
+            reordered.insert(next(reordered.begin()), {node->get_argument(0), node});
+        }
+        else if (dynamic_pointer_cast<op::Add>(node) || node->is_output())
+        {
+            adds.push_back(node);
+        }
+    }
+    reordered.splice(reordered.end(), adds);
+    f->set_ordered_ops(reordered);
+
+    schedule.run_on_function(f);
+    EXPECT_EQ(scheduled_ops, f->get_ordered_ops());
+    EXPECT_EQ(pool_size, schedule.get_pool_size());
+}
+
+TEST(memory_schedule, memory_budget)
+{
+    auto f = make_reduction_branches(8);
+    auto original_ops = f->get_ordered_ops();
+
+    pass::MemorySchedule schedule(1, 10 * 4000);
+    schedule.run_on_function(f);
+
+    // The original order fits in the budget and is kept
+    EXPECT_LE(schedule.get_original_pool_size(), 10 * 4000);
+    EXPECT_EQ(schedule.get_original_pool_size(), schedule.get_pool_size());
+    EXPECT_EQ(original_ops, f->get_ordered_ops());
+}
+
+TEST(memory_schedule, invalidated_by_rewrite)
+{
+    auto f = make_reduction_branches(2);
+    pass::MemorySchedule schedule;
+    schedule.run_on_function(f);
+
+    // A rewrite drops the replaced ops from the stored schedule and places the new ones
+    // before their user
+    auto result = f->get_results().at(0);
+    auto A = f->get_parameters().at(0);
+    auto negative = make_shared<op::Negative>(A);
+    auto sum = make_shared<op::Sum>(negative, AxisSet{0});
+    replace_node(result->get_argument(0), sum);
+    EXPECT_EQ((list<shared_ptr<Node>>{A, negative, sum, result}), f->get_ordered_ops());
+}
+
+TEST(rematerialization, recompute_idle_activation)
+{
+    // a is used right away and again at the end, like an activation used in backprop
+    auto X = make_shared<op::Parameter>(element::f32, Shape{1000});
+    auto a = make_shared<op::Negative>(X);
+    auto f1 = make_shared<op::Abs>(a);
+    auto f2 = make_shared<op::Negative>(f1);
+    auto f3 = make_shared<op::Abs>(f2);
+    auto f4 = make_shared<op::Negative>(f3);
+    auto dot = make_shared<op::Dot>(f4, a);
+    auto f = make_shared<Function>(dot, op::ParameterVector{X});
+
+    pass::Rematerialization rematerialization(9000);
+    rematerialization.run_on_function(f);
+
+    EXPECT_EQ(1, rematerialization.get_recomputed_count());
+    EXPECT_LT(rematerialization.get_pool_size(), rematerialization.get_original_pool_size());
+    EXPECT_EQ(rematerialization.get_pool_size(), f->get_temporary_pool_size());
+
+    auto copy = dot->get_argument(1);
+    EXPECT_NE(copy, a);
+    EXPECT_TRUE(dynamic_pointer_cast<op::Negative>(copy));
+    EXPECT_EQ(copy->get_argument(0), X);
+    EXPECT_EQ(f1->get_argument(0), a);
+
+    // The copy runs right before its user
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(*next(find(ops.begin(), ops.end(), copy)), dot);
+}
+
+TEST(rematerialization, within_budget)
+{
+    auto X = make_shared<op::Parameter>(element::f32, Shape{1000});
+    auto a = make_shared<op::Negative>(X);
+    auto dot = make_shared<op::Dot>(make_shared<op::Abs>(make_shared<op::Abs>(a)), a);
+    auto f = make_shared<Function>(dot, op::ParameterVector{X});
+
+    pass::Rematerialization rematerialization(1000000);
+    rematerialization.run_on_function(f);
+    EXPECT_EQ(0, rematerialization.get_recomputed_count());
+    EXPECT_EQ(a, dot->get_argument(1));
+}
+
+TEST(buffer_aliasing, elementwise_chain)
+{
+    Shape shape{100};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto neg = make_shared<op::Negative>(add);
+    auto reshape = make_shared<op::Reshape>(neg, AxisVector{0}, Shape{10, 10});
+    auto transpose = make_shared<op::Reshape>(reshape, AxisVector{1, 0}, Shape{10, 10});
+    auto abs = make_shared<op::Abs>(transpose);
+    auto mul = make_shared<op::Multiply>(abs, abs);
+    auto f = make_shared<Function>(mul, op::ParameterVector{A, B});
+
+    pass::BufferAliasing aliasing;
+    aliasing.run_on_function(f);
+    EXPECT_FALSE(add->get_op_annotations());
+    EXPECT_FALSE(transpose->get_op_annotations());
+    EXPECT_FALSE(reshape->get_op_annotations()->get_in_place_oi_pairs().at(0).destructive);
+    EXPECT_TRUE(mul->get_op_annotations()->get_in_place_oi_pairs().at(0).destructive);
+
+    pass::Liveness().run_on_function(f);
+    pass::MemoryLayout layout;
+    layout.run_on_function(f);
+    EXPECT_EQ(3 * 400, layout.get_in_place_bytes());
+    EXPECT_EQ(400, layout.get_view_bytes());
+    EXPECT_EQ(add->get_output_tensor().get_pool_offset(),
+              reshape->get_output_tensor().get_pool_offset());
+    EXPECT_EQ(transpose->get_output_tensor().get_pool_offset(),
+              mul->get_output_tensor().get_pool_offset());
+    EXPECT_EQ(800, f->get_temporary_pool_size());
+}
+
+TEST(buffer_aliasing, shared_input_not_overwritten)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{100});
+    auto neg = make_shared<op::Negative>(A);
+    auto abs = make_shared<op::Abs>(neg);
+    auto add = make_shared<op::Add>(neg, abs);
+    auto f = make_shared<Function>(add, op::ParameterVector{A});
+
+    pass::BufferAliasing aliasing;
+    aliasing.run_on_function(f);
+    EXPECT_FALSE(neg->get_op_annotations());
+    EXPECT_FALSE(abs->get_op_annotations());
+    auto oi_pairs = add->get_op_annotations()->get_in_place_oi_pairs();
+    ASSERT_EQ(1, oi_pairs.size());
+    EXPECT_EQ(1, oi_pairs[0].input);
+}
+
+TEST(buffer_aliasing, lrn_not_in_place)
+{
+    // LRN reads neighbouring channels of its input while it writes its output
+    Shape shape{1, 4, 2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto relu = make_shared<op::Relu>(A);
+    auto lrn = make_shared<op::LRN>(relu, 1., 0.75, 1., 3);
+    auto f = make_shared<Function>(lrn, op::ParameterVector{A});
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto g = make_shared<Function>(make_shared<op::LRN>(B, 1., 0.75, 1., 3),
+                                   op::ParameterVector{B});
+
+    // Relu leaves positive inputs unchanged
+    vector<float> a(shape_size(shape));
+    iota(a.begin(), a.end(), 1);
+    auto result = execute<float>(f, {a}, "INTERPRETER");
+    auto expected = execute<float>(g, {a}, "INTERPRETER");
+    EXPECT_FALSE(lrn->get_op_annotations());
+    EXPECT_TRUE(test::all_close_f(expected.at(0), result.at(0)));
+}
+
+TEST(buffer_aliasing, views)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto neg = make_shared<op::Negative>(A);
+    auto slice = make_shared<op::Slice>(neg, Coordinate{1, 0}, Coordinate{3, 3});
+    auto exp = make_shared<op::Exp>(slice);
+    auto abs = make_shared<op::Abs>(B);
+    auto concat = make_shared<op::Concat>(NodeVector{abs, exp}, 0);
+    auto sigmoid = make_shared<op::Sigmoid>(C);
+    auto zero = op::Constant::create(element::f32, Shape{}, {0});
+    auto pad = make_shared<op::Pad>(sigmoid, zero, Shape{1, 0}, Shape{0, 0}, Shape{0, 0});
+    // Padding on an inner axis leaves the interior strided
+    auto strided_pad = make_shared<op::Pad>(
+        make_shared<op::Negative>(C), zero, Shape{0, 1}, Shape{0, 0}, Shape{0, 0});
+    auto f = make_shared<Function>(NodeVector{concat, pad, strided_pad},
+                                   op::ParameterVector{A, B, C});
+
+    pass::BufferAliasing().run_on_function(f);
+    auto slice_views = slice->get_op_annotations()->get_output_views();
+    ASSERT_EQ(1, slice_views.size());
+    EXPECT_EQ(12, slice_views[0].offset);
+    auto concat_views = concat->get_op_annotations()->get_input_views();
+    ASSERT_EQ(2, concat_views.size());
+    EXPECT_EQ(0, concat_views[0].offset);
+    EXPECT_EQ(24, concat_views[1].offset);
+    auto pad_views = pad->get_op_annotations()->get_input_views();
+    ASSERT_EQ(1, pad_views.size());
+    EXPECT_EQ(12, pad_views[0].offset);
+    EXPECT_FALSE(strided_pad->get_op_annotations());
+    // exp is computed in the concat output rather than over the slice
+    EXPECT_FALSE(exp->get_op_annotations());
+
+    for (bool offline_packing : {false, true})
+    {
+        pass::Liveness().run_on_function(f);
+        pass::MemoryLayout layout(1, false, offline_packing);
+        layout.run_on_function(f);
+        EXPECT_EQ(4 * 24, layout.get_view_bytes());
+        EXPECT_EQ(neg->get_output_tensor().get_pool_offset() + 12,
+                  slice->get_output_tensor().get_pool_offset());
+        EXPECT_EQ(concat->get_output_tensor().get_pool_offset(),
+                  abs->get_output_tensor().get_pool_offset());
+        EXPECT_EQ(concat->get_output_tensor().get_pool_offset() + 24,
+                  exp->get_output_tensor().get_pool_offset());
+        EXPECT_EQ(pad->get_output_tensor().get_pool_offset() + 12,
+                  sigmoid->get_output_tensor().get_pool_offset());
+    }
+
+    vector<float> a{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    vector<float> b{-1, 2, -3, 4, -5, 6};
+    vector<float> c{0, 1, -1, 2, -2, 3};
+    vector<float> expected_concat;
+    for (float x : b)
+    {
+        expected_concat.push_back(std::abs(x));
+    }
+    for (size_t i = 3; i < 9; i++)
+    {
+        expected_concat.push_back(std::exp(-a[i]));
+    }
+    vector<float> expected_pad{0, 0, 0};
+    vector<float> expected_strided_pad;
+    for (size_t i = 0; i < c.size(); i++)
+    {
+        expected_pad.push_back(1 / (1 + std::exp(-c[i])));
+        if (i % 3 == 0)
+        {
+            expected_strided_pad.push_back(0);
+        }
+        expected_strided_pad.push_back(-c[i]);
+    }
+    auto results = execute<float>(f, {a, b, c}, "INTERPRETER");
+    EXPECT_TRUE(test::all_close_f(expected_concat, results.at(0)));
+    EXPECT_TRUE(test::all_close_f(expected_pad, results.at(1)));
+    EXPECT_TRUE(test::all_close_f(expected_strided_pad, results.at(2)));
+}
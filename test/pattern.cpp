@@ -402,6 +402,45 @@ std::ostream& operator<<(std::ostream& os, const ngraph::NodeVector& nv)
     return os;
 }
 
+TEST(pattern, graph_rewrite_cascades)
+{
+    // sqrt(x) -> abs(x) and abs(x) -> -x. With cascading on, the abs the first rewrite creates
+    // is rewritten in the same pass although its matcher was added first. With it off, the pass
+    // only visits the ops it started with.
+    for (bool cascade : {true, false})
+    {
+        auto abs_label = make_shared<pattern::op::Label>(element::f32, Shape{2});
+        auto sqrt_label = make_shared<pattern::op::Label>(element::f32, Shape{2});
+        pass::GraphRewrite rewrite(cascade);
+        rewrite.add_matcher(make_shared<pattern::Matcher>(
+            make_shared<op::Abs>(abs_label), [abs_label](pattern::Matcher& m) {
+                auto x = m.get_pattern_map()[abs_label];
+                replace_node(m.get_match_root(), make_shared<op::Negative>(x));
+                return true;
+            }));
+        rewrite.add_matcher(make_shared<pattern::Matcher>(
+            make_shared<op::Sqrt>(sqrt_label), [sqrt_label](pattern::Matcher& m) {
+                auto x = m.get_pattern_map()[sqrt_label];
+                replace_node(m.get_match_root(), make_shared<op::Abs>(x));
+                return true;
+            }));
+
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+        auto f = make_shared<Function>(make_shared<op::Sqrt>(A), op::ParameterVector{A});
+        rewrite.run_on_function(f);
+        auto root = f->get_results().at(0)->get_argument(0);
+        if (cascade)
+        {
+            ASSERT_TRUE(dynamic_pointer_cast<op::Negative>(root));
+        }
+        else
+        {
+            ASSERT_TRUE(dynamic_pointer_cast<op::Abs>(root));
+        }
+        EXPECT_EQ(A, root->get_argument(0));
+    }
+}
+
 TEST(pattern, matcher)
 {
     Shape shape{};
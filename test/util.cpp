@@ -404,3 +404,62 @@ TEST(graph_util, test_subgraph_topological_sort_control_dependencies)
     std::list<std::shared_ptr<Node>> expected{A, D, add, mul};
     ASSERT_EQ(expected, sorted);
 }
+
+TEST(graph_util, ordered_ops_repaired_after_rewrite)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto neg_a = make_shared<op::Negative>(A);
+    auto neg_b = make_shared<op::Negative>(B);
+    auto add = neg_a + neg_b;
+    auto f = make_shared<Function>(add, op::ParameterVector{A, B});
+    auto result = f->get_results().at(0);
+
+    // A schedule that computes neg_b first is kept while the graph does not change
+    f->set_ordered_ops({B, neg_b, A, neg_a, add, result});
+    EXPECT_EQ((list<shared_ptr<Node>>{B, neg_b, A, neg_a, add, result}), f->get_ordered_ops());
+
+    // Replacing neg_a keeps the order of the other ops and places the new ops before their
+    // first user
+    auto abs_a = make_shared<op::Abs>(A);
+    auto sqrt_a = make_shared<op::Sqrt>(abs_a);
+    replace_node(neg_a, sqrt_a);
+    EXPECT_EQ((list<shared_ptr<Node>>{B, neg_b, A, abs_a, sqrt_a, add, result}),
+              f->get_ordered_ops());
+    EXPECT_EQ(7, f->get_ops().size());
+
+    // So does a new control dependency
+    auto abs_b = make_shared<op::Abs>(B);
+    add->add_control_dependency(abs_b);
+    EXPECT_EQ((list<shared_ptr<Node>>{B, neg_b, A, abs_a, sqrt_a, abs_b, add, result}),
+              f->get_ordered_ops());
+}
+
+TEST(graph_util, ordered_ops_patched_after_rewrite)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto neg_a = make_shared<op::Negative>(A);
+    auto neg_b = make_shared<op::Negative>(B);
+    auto add = neg_a + neg_b;
+    auto f = make_shared<Function>(add, op::ParameterVector{A, B});
+    auto result = f->get_results().at(0);
+    f->set_ordered_ops({A, neg_a, B, neg_b, add, result});
+
+    // Edits of a graph outside the function leave its order alone
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto g = make_shared<Function>(make_shared<op::Negative>(C), op::ParameterVector{C});
+    replace_node(g->get_results().at(0)->get_argument(0), make_shared<op::Abs>(C));
+    EXPECT_EQ((list<shared_ptr<Node>>{A, neg_a, B, neg_b, add, result}), f->get_ordered_ops());
+
+    // Linking an op to one placed after it sorts the ops again
+    neg_a->get_inputs().at(0).replace_output(neg_b->get_outputs().at(0));
+    EXPECT_EQ((list<shared_ptr<Node>>{A, B, neg_b, neg_a, add, result}), f->get_ordered_ops());
+
+    // Ops left without users are dropped, but not the parameters
+    replace_node(neg_a, neg_b);
+    EXPECT_EQ((list<shared_ptr<Node>>{A, B, neg_b, add, result}), f->get_ordered_ops());
+    EXPECT_EQ(f->get_ops().size(), 5);
+}